@@ -544,6 +544,8 @@ namespace hpx
         ///
         /// \return This returns the hpx::future of type void
         ///
+        future<void> set_values(std::vector<std::size_t> const& pos,
+            std::vector<T> && val);
         future<void> set_values(std::vector<std::size_t> const& pos,
             std::vector<T> const& val);
 
@@ -472,6 +472,16 @@ namespace hpx
         set_values(pos, val).get();
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::set_values(
+        std::vector<std::size_t> const& pos, std::vector<T>&& val)
+    {
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::set_values_action>(
+            this->get_id(), pos, std::move(val));
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
     partitioned_vector_partition<T, Data>::set_values(
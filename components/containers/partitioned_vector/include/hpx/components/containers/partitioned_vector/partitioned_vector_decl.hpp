@@ -611,9 +611,82 @@ namespace hpx
                 .get_values(pos);
         }
 
+    private:
+        // Group the given global positions by partition. On return, parts
+        // holds the sequence numbers of all referenced partitions in
+        // ascending order. For each of those, local_pos holds the local
+        // positions of the referenced elements and origins (if given) the
+        // indices of these elements in pos_vec, both in their original order.
+        void group_by_partition(std::vector<size_type> const& pos_vec,
+            std::vector<size_type>& parts,
+            std::vector<std::vector<size_type> >& local_pos,
+            std::vector<std::vector<size_type> >* origins) const
+        {
+            std::size_t const num_parts = partitions_.size();
+
+            // count the number of elements referenced in each partition
+            std::vector<size_type> counts(num_parts, 0);
+            for (size_type pos : pos_vec)
+            {
+                size_type part = get_partition(pos);
+                HPX_ASSERT(part < num_parts);
+                ++counts[part];
+            }
+
+            // allocate one group for each referenced partition
+            std::vector<size_type> group(num_parts, size_type(-1));
+            for (std::size_t part = 0; part != num_parts; ++part)
+            {
+                if (counts[part] == 0)
+                    continue;
+
+                group[part] = parts.size();
+                parts.push_back(part);
+
+                local_pos.emplace_back();
+                local_pos.back().reserve(counts[part]);
+
+                if (origins != nullptr)
+                {
+                    origins->emplace_back();
+                    origins->back().reserve(counts[part]);
+                }
+            }
+
+            for (std::size_t i = 0; i != pos_vec.size(); ++i)
+            {
+                size_type g = group[get_partition(pos_vec[i])];
+                local_pos[g].push_back(get_local_index(pos_vec[i]));
+                if (origins != nullptr)
+                    (*origins)[g].push_back(i);
+            }
+        }
+
+        // Asynchronously fetch the values of all groups, issuing exactly one
+        // request per partition. All requests are in flight before any of the
+        // results is waited for.
+        std::vector<future<std::vector<T> > > get_grouped_values(
+            std::vector<size_type> const& parts,
+            std::vector<std::vector<size_type> > const& local_pos) const
+        {
+            std::vector<future<std::vector<T> > > part_values_future;
+            part_values_future.reserve(parts.size());
+
+            for (std::size_t i = 0; i != parts.size(); ++i)
+            {
+                part_values_future.push_back(
+                    get_values(parts[i], local_pos[i]));
+            }
+            return part_values_future;
+        }
+
+    public:
         /// Returns the elements at the positions \a pos
         /// in the vector container.
         ///
+        /// The positions are grouped by partition, exactly one request is
+        /// sent to each of the referenced partitions.
+        ///
         /// \param pos   Global position of the element in the vector
         ///
         /// \return Returns the value of the element at position represented by
@@ -627,69 +700,60 @@ namespace hpx
             if (pos_vec.empty())
                 return make_ready_future(std::vector<T>());
 
-            // current partition index of the block
-            size_type part_cur = get_partition(pos_vec[0]);
+            std::vector<size_type> parts;
+            std::vector<std::vector<size_type> > local_pos;
+            std::vector<std::vector<size_type> > origins;
+            group_by_partition(pos_vec, parts, local_pos, &origins);
 
-            // iterator to the begin of current block
-            typename std::vector<size_type>::const_iterator part_begin =
-                pos_vec.begin();
+            std::vector<future<std::vector<T> > > part_values_future =
+                get_grouped_values(parts, local_pos);
 
-            // vector holding futures of the values for all blocks
-            std::vector<future<std::vector<T> > > part_values_future;
-            for (typename std::vector<size_type>::const_iterator it =
-                    pos_vec.begin(); it != pos_vec.end(); ++it)
-            {
-                // get the partition of the current position
-                size_type part = get_partition(*it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
-                    continue;
-
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-                else
-                {
-                    // this is the end of a block containing indexes ('pos')
-                    // of the same partition ('part').
-                    // get async values for this block
-                    part_values_future.push_back(get_values(part_cur,
-                        get_local_indices(std::vector<size_type>(part_begin, it))));
-
-                    // reset block variables to start a new one from here
-                    part_cur = part;
-                    part_begin = it;
-                }
-            }
-
-            // the end of the vector is also an end of a block
-            // get async values for this block
-            part_values_future.push_back(get_values(part_cur,
-                get_local_indices(std::vector<size_type>(
-                    part_begin, pos_vec.end()))));
+            // the values of a single partition are returned in the requested
+            // order already
+            if (part_values_future.size() == 1)
+                return std::move(part_values_future[0]);
 
             // This helper function unwraps the vectors from each partition
-            // and merge them to one vector
+            // and moves the values to their original positions
+            std::size_t const size = pos_vec.size();
             auto merge_func =
-                [&pos_vec](std::vector<future<std::vector<T> > > && part_values_f)
+                [size, origins = std::move(origins)](
+                    std::vector<future<std::vector<T> > > && part_values_f)
                     -> std::vector<T>
                 {
-                    std::vector<T> values;
-                    values.reserve(pos_vec.size());
+                    // find the partition and the index in the partition of
+                    // each of the requested values, this avoids requiring T
+                    // to be default constructible
+                    std::vector<std::vector<T> > part_values;
+                    part_values.reserve(part_values_f.size());
+
+                    std::vector<std::pair<std::size_t, std::size_t> > source(
+                        size);
+                    for (std::size_t i = 0; i != part_values_f.size(); ++i)
+                    {
+                        part_values.push_back(part_values_f[i].get());
+                        std::vector<size_type> const& origin = origins[i];
+
+                        HPX_ASSERT(part_values[i].size() == origin.size());
+                        for (std::size_t j = 0; j != origin.size(); ++j)
+                        {
+                            source[origin[j]] = std::make_pair(i, j);
+                        }
+                    }
 
-                    for (future<std::vector<T> >& part_f: part_values_f)
+                    std::vector<T> values;
+                    values.reserve(size);
+                    for (auto const& p : source)
                     {
-                        std::vector<T> part_values = part_f.get();
-                        std::move(part_values.begin(), part_values.end(),
-                            std::back_inserter(values));
+                        values.push_back(
+                            std::move(part_values[p.first][p.second]));
                     }
                     return values;
                 };
 
             // when all values are here merge them to one vector
             // and return a future to this vector
-            return dataflow(launch::async, merge_func,
+            return dataflow(launch::async, std::move(merge_func),
                 std::move(part_values_future));
         }
 
@@ -708,6 +772,86 @@ namespace hpx
             return get_values(pos_vec).get();
         }
 
+        /// Returns the elements at the positions \a pos in the vector
+        /// container, grouped by partition.
+        ///
+        /// Other than \a get_values, this does not restore the order of the
+        /// requested positions, which avoids reordering the received values.
+        /// The values of each partition are moved into the result as a whole.
+        ///
+        /// \param pos   Global position of the element in the vector
+        /// \param order On return, holds the indices into \a pos of the
+        ///              positions in the order the values are returned
+        ///              (i.e. the i-th value is the element at position
+        ///              pos[order[i]]).
+        ///
+        /// \return Returns the hpx::future to values of the elements at the
+        ///         given positions represented by \a pos.
+        ///
+        future<std::vector<T> >
+        get_values_unordered(std::vector<size_type> const& pos_vec,
+            std::vector<size_type>& order) const
+        {
+            order.clear();
+            if (pos_vec.empty())
+                return make_ready_future(std::vector<T>());
+
+            std::vector<size_type> parts;
+            std::vector<std::vector<size_type> > local_pos;
+            std::vector<std::vector<size_type> > origins;
+            group_by_partition(pos_vec, parts, local_pos, &origins);
+
+            order.reserve(pos_vec.size());
+            for (std::vector<size_type> const& origin : origins)
+            {
+                order.insert(order.end(), origin.begin(), origin.end());
+            }
+
+            std::vector<future<std::vector<T> > > part_values_future =
+                get_grouped_values(parts, local_pos);
+
+            if (part_values_future.size() == 1)
+                return std::move(part_values_future[0]);
+
+            std::size_t const size = pos_vec.size();
+            auto merge_func =
+                [size](std::vector<future<std::vector<T> > > && part_values_f)
+                    -> std::vector<T>
+                {
+                    std::vector<T> values = part_values_f[0].get();
+                    values.reserve(size);
+
+                    for (std::size_t i = 1; i != part_values_f.size(); ++i)
+                    {
+                        std::vector<T> part_values = part_values_f[i].get();
+                        std::move(part_values.begin(), part_values.end(),
+                            std::back_inserter(values));
+                    }
+                    return values;
+                };
+
+            return dataflow(launch::async, std::move(merge_func),
+                std::move(part_values_future));
+        }
+
+        /// Returns the elements at the positions \a pos in the vector
+        /// container, grouped by partition.
+        ///
+        /// \param pos   Global position of the element in the vector
+        /// \param order On return, holds the indices into \a pos of the
+        ///              positions in the order the values are returned.
+        ///
+        /// \return Returns the value of the element at position represented by
+        ///         \a pos.
+        ///
+        std::vector<T>
+        get_values_unordered(launch::sync_policy,
+            std::vector<size_type> const& pos_vec,
+            std::vector<size_type>& order) const
+        {
+            return get_values_unordered(pos_vec, order).get();
+        }
+
 //         //FRONT (never throws exception)
 //         /** @brief Access the value of first element in the vector.
 //          *
@@ -930,7 +1074,7 @@ namespace hpx
         void set_values(launch::sync_policy, size_type part,
             std::vector<size_type> const& pos, std::vector<T> const& val)
         {
-            set_values(pos, val).get();
+            set_values(part, pos, val).get();
         }
 
         /// Asynchronously set the element at position \a pos in
@@ -959,9 +1103,38 @@ namespace hpx
                 partitions_[part].partition_).set_values(pos, val);
         }
 
+        /// Asynchronously set the element at position \a pos in
+        /// the partition \part to the given value \a val.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param pos   Position of the element in the partition
+        /// \param val   The values to be moved
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void>
+        set_values(size_type part, std::vector<size_type> const& pos,
+            std::vector<T> && val)
+        {
+            HPX_ASSERT(pos.size() == val.size());
+
+            if (partitions_[part].local_data_)
+            {
+                partitions_[part].local_data_->set_values(pos, val);
+                return make_ready_future();
+            }
+
+            return partitioned_vector_partition_client(
+                partitions_[part].partition_).set_values(pos, std::move(val));
+        }
+
         /// Asynchronously set the element at position \a pos
         /// to the given value \a val.
         ///
+        /// The positions are grouped by partition, exactly one request is
+        /// sent to each of the referenced partitions.
+        ///
         /// \param pos   Global position of the element in the vector
         /// \param val   The value to be copied
         ///
@@ -978,55 +1151,28 @@ namespace hpx
             if (pos.empty())
                 return make_ready_future();
 
-            // partition index of the current block
-            size_type part_cur = get_partition(pos[0]);
-
-            // iterator to the begin of current block
-            typename std::vector<size_type>::const_iterator pos_block_begin =
-                pos.begin();
-            typename std::vector<T>::const_iterator val_block_begin = val.begin();
+            std::vector<size_type> parts;
+            std::vector<std::vector<size_type> > local_pos;
+            std::vector<std::vector<size_type> > origins;
+            group_by_partition(pos, parts, local_pos, &origins);
 
-            // vector holding futures of the state for all blocks
+            // vector holding futures of the state for all partitions
             std::vector<future<void> > part_futures;
+            part_futures.reserve(parts.size());
 
-            // going through the position vector
-            typename std::vector<size_type>::const_iterator pos_it = pos.begin();
-            typename std::vector<T>::const_iterator val_it = val.begin();
-            for (/**/; pos_it != pos.end(); ++pos_it, ++val_it)
+            for (std::size_t i = 0; i != parts.size(); ++i)
             {
-                // get the partition of the current position
-                size_type part = get_partition(*pos_it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
-                    continue;
-
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-                else
+                // gather the values destined to this partition
+                std::vector<T> part_values;
+                part_values.reserve(origins[i].size());
+                for (size_type origin : origins[i])
                 {
-                    // this is the end of a block containing indexes ('pos')
-                    // of the same partition ('part').
-                    // set asynchronous values for this block
-                    part_futures.push_back(set_values(part_cur,
-                        get_local_indices(std::vector<size_type>(
-                            pos_block_begin, pos_it)),
-                        std::vector<T>(val_block_begin, val_it)));
-
-                    // reset block variables to start a new one from here
-                    part_cur = part;
-                    pos_block_begin = pos_it;
-                    val_block_begin = val_it;
+                    part_values.push_back(val[origin]);
                 }
-            }
 
-            // the end of the vector is also an end of a block
-            // get asynchronous values for this block
-            part_futures.push_back(set_values(part_cur,
-                get_local_indices(std::vector<size_type>(
-                    pos_block_begin, pos.end())),
-                std::vector<T>(val_block_begin, val.end())));
+                part_futures.push_back(set_values(
+                    parts[i], local_pos[i], std::move(part_values)));
+            }
 
             return when_all(part_futures);
         }
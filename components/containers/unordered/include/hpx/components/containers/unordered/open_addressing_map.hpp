@@ -0,0 +1,561 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/unordered/open_addressing_map.hpp
+///
+/// \brief A concurrent open-addressing hash map which can be used as the
+///        storage backend of the partitions of a hpx::unordered_map.
+///
+/// The map is split into a number of independently locked stripes, each of
+/// which is a Robin Hood hash table storing its elements in a flat array.
+/// Lookups do not allocate and touch (almost) only contiguous memory, which
+/// makes them significantly cheaper than lookups in a std::unordered_map.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Scramble the bits of the given hash value, std::hash is the identity for
+    // integral types on most platforms.
+    inline std::uint64_t mix_hash(std::uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A (non-thread-safe) Robin Hood hash table. Key and T have to be default
+    /// constructible.
+    template <typename Key, typename T, typename KeyEqual>
+    class robin_hood_table
+    {
+    public:
+        typedef std::pair<Key, T> value_type;
+
+    private:
+        // per slot meta data, kept separate from the elements to make probing
+        // cache friendly
+        struct slot_info
+        {
+            std::uint32_t distance;    // probe distance + 1, 0 means empty
+            std::uint32_t hash;        // upper bits of the hash value
+        };
+
+        static constexpr std::size_t npos = std::size_t(-1);
+
+        // maximal load factor is 7/8
+        static bool needs_rehash(std::size_t size, std::size_t capacity)
+        {
+            return (size + 1) * 8 > capacity * 7;
+        }
+
+        std::size_t find_index(
+            Key const& key, std::uint64_t h, KeyEqual const& equal) const
+        {
+            if (slots_.empty())
+                return npos;
+
+            std::size_t const mask = slots_.size() - 1;
+            std::uint32_t const hash = std::uint32_t(h >> 32);
+
+            std::size_t i = std::size_t(h) & mask;
+            for (std::uint32_t distance = 1; /**/; ++distance)
+            {
+                slot_info const& s = slots_[i];
+
+                // the element would have displaced any richer element
+                if (s.distance < distance)
+                    return npos;
+
+                if (s.hash == hash && equal(values_[i].first, key))
+                    return i;
+
+                i = (i + 1) & mask;
+            }
+        }
+
+        void insert_new(value_type&& value, std::uint64_t h)
+        {
+            std::size_t const mask = slots_.size() - 1;
+            slot_info current = {1, std::uint32_t(h >> 32)};
+
+            std::size_t i = std::size_t(h) & mask;
+            while (true)
+            {
+                slot_info& s = slots_[i];
+                if (s.distance == 0)
+                {
+                    s = current;
+                    values_[i] = std::move(value);
+                    ++size_;
+                    return;
+                }
+
+                // steal the slot from richer elements
+                if (s.distance < current.distance)
+                {
+                    std::swap(s, current);
+                    std::swap(values_[i], value);
+                }
+
+                i = (i + 1) & mask;
+                ++current.distance;
+            }
+        }
+
+        // remove the element at the given position by shifting all following
+        // elements of the same probe sequence backwards
+        void erase_index(std::size_t i)
+        {
+            std::size_t const mask = slots_.size() - 1;
+            std::size_t next = (i + 1) & mask;
+            while (slots_[next].distance > 1)
+            {
+                slots_[i] = slots_[next];
+                --slots_[i].distance;
+                values_[i] = std::move(values_[next]);
+
+                i = next;
+                next = (next + 1) & mask;
+            }
+
+            slots_[i].distance = 0;
+            values_[i] = value_type();
+            --size_;
+        }
+
+    public:
+        robin_hood_table()
+          : size_(0)
+        {}
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        template <typename Hasher>
+        void reserve(std::size_t count, Hasher const& hasher)
+        {
+            std::size_t capacity = slots_.empty() ? 8 : slots_.size();
+            while (needs_rehash(count, capacity))
+                capacity *= 2;
+
+            if (capacity != slots_.size())
+                rehash(capacity, hasher);
+        }
+
+        template <typename Hasher>
+        void rehash(std::size_t capacity, Hasher const& hasher)
+        {
+            HPX_ASSERT((capacity & (capacity - 1)) == 0);
+
+            std::vector<slot_info> slots(capacity, slot_info{0, 0});
+            std::vector<value_type> values(capacity);
+
+            std::swap(slots, slots_);
+            std::swap(values, values_);
+            size_ = 0;
+
+            for (std::size_t i = 0; i != slots.size(); ++i)
+            {
+                if (slots[i].distance != 0)
+                {
+                    std::uint64_t const h = hasher(values[i].first);
+                    insert_new(std::move(values[i]), h);
+                }
+            }
+        }
+
+        T const* find(Key const& key, std::uint64_t h,
+            KeyEqual const& equal) const
+        {
+            std::size_t const i = find_index(key, h, equal);
+            return i == npos ? nullptr : &values_[i].second;
+        }
+
+        bool extract(Key const& key, std::uint64_t h, KeyEqual const& equal,
+            T& value)
+        {
+            std::size_t const i = find_index(key, h, equal);
+            if (i == npos)
+                return false;
+
+            value = std::move(values_[i].second);
+            erase_index(i);
+            return true;
+        }
+
+        template <typename Hasher, typename T_>
+        void insert_or_assign(Key const& key, T_&& value, std::uint64_t h,
+            Hasher const& hasher, KeyEqual const& equal)
+        {
+            std::size_t const i = find_index(key, h, equal);
+            if (i != npos)
+            {
+                values_[i].second = std::forward<T_>(value);
+                return;
+            }
+
+            if (slots_.empty() || needs_rehash(size_, slots_.size()))
+                rehash(slots_.empty() ? 8 : 2 * slots_.size(), hasher);
+
+            insert_new(value_type(key, std::forward<T_>(value)), h);
+        }
+
+        std::size_t erase(Key const& key, std::uint64_t h,
+            KeyEqual const& equal)
+        {
+            std::size_t const i = find_index(key, h, equal);
+            if (i == npos)
+                return 0;
+
+            erase_index(i);
+            return 1;
+        }
+
+        void clear()
+        {
+            slots_.clear();
+            values_.clear();
+            size_ = 0;
+        }
+
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for (std::size_t i = 0; i != slots_.size(); ++i)
+            {
+                if (slots_[i].distance != 0)
+                    f(values_[i]);
+            }
+        }
+
+    private:
+        std::vector<slot_info> slots_;
+        std::vector<value_type> values_;
+        std::size_t size_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A concurrent open-addressing hash map. The elements are distributed
+    /// over a fixed number of stripes, each of which is a Robin Hood hash table
+    /// protected by its own spinlock. The map does not expose iterators, all
+    /// operations are safe to be invoked concurrently.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key> >
+    class open_addressing_map
+    {
+    private:
+        typedef hpx::lcos::local::spinlock mutex_type;
+        typedef robin_hood_table<Key, T, KeyEqual> table_type;
+
+        struct stripe
+        {
+            mutable mutex_type mtx_;
+            table_type table_;
+        };
+        typedef util::cache_line_data<stripe> stripe_type;
+
+        // the hash value used for a key, the upper bits select the stripe,
+        // the lower bits select the slot in the stripe
+        struct hasher
+        {
+            std::uint64_t operator()(Key const& key) const
+            {
+                return mix_hash(hash_(key));
+            }
+
+            Hash hash_;
+        };
+
+        stripe& get_stripe(std::uint64_t h) const
+        {
+            return stripes_[std::size_t(h >> 48) % stripes_.size()].data_;
+        }
+
+    public:
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef std::pair<Key, T> value_type;
+        typedef std::size_t size_type;
+
+        static constexpr std::size_t default_num_stripes = 16;
+
+        open_addressing_map()
+          : stripes_(default_num_stripes)
+        {}
+
+        explicit open_addressing_map(size_type bucket_count,
+                Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual(),
+                std::size_t num_stripes = default_num_stripes)
+          : stripes_(num_stripes == 0 ? 1 : num_stripes),
+            hasher_{hash}, equal_(equal)
+        {
+            reserve(bucket_count);
+        }
+
+        open_addressing_map(open_addressing_map const& rhs)
+          : stripes_(rhs.stripes_.size()),
+            hasher_(rhs.hasher_), equal_(rhs.equal_)
+        {
+            copy_from(rhs);
+        }
+
+        open_addressing_map(open_addressing_map&& rhs)
+          : stripes_(rhs.stripes_.size()),
+            hasher_(rhs.hasher_), equal_(rhs.equal_)
+        {
+            swap_with(rhs);
+        }
+
+        open_addressing_map& operator=(open_addressing_map const& rhs)
+        {
+            if (this != &rhs)
+            {
+                open_addressing_map tmp(rhs);
+                swap_with(tmp);
+            }
+            return *this;
+        }
+
+        open_addressing_map& operator=(open_addressing_map&& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                swap_with(rhs);
+            }
+            return *this;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        size_type size() const
+        {
+            size_type result = 0;
+            for (stripe_type const& s : stripes_)
+            {
+                std::lock_guard<mutex_type> l(s.data_.mtx_);
+                result += s.data_.table_.size();
+            }
+            return result;
+        }
+
+        size_type max_size() const
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(value_type);
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Make sure the map can hold at least the given number of elements
+        /// without rehashing (assuming an even distribution over the stripes).
+        void reserve(size_type count)
+        {
+            size_type const per_stripe =
+                (count + stripes_.size() - 1) / stripes_.size();
+            for (stripe_type& s : stripes_)
+            {
+                std::lock_guard<mutex_type> l(s.data_.mtx_);
+                s.data_.table_.reserve(per_stripe, hasher_);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Copy the value stored for the given key to \a value, returns false
+        /// if the key was not found.
+        bool find(Key const& key, T& value) const
+        {
+            std::uint64_t const h = hasher_(key);
+            stripe& s = get_stripe(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            T const* p = s.table_.find(key, h, equal_);
+            if (p == nullptr)
+                return false;
+
+            value = *p;
+            return true;
+        }
+
+        /// Move the value stored for the given key to \a value and remove the
+        /// element from the map, returns false if the key was not found.
+        bool extract(Key const& key, T& value)
+        {
+            std::uint64_t const h = hasher_(key);
+            stripe& s = get_stripe(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.table_.extract(key, h, equal_, value);
+        }
+
+        template <typename T_>
+        void insert_or_assign(Key const& key, T_&& value)
+        {
+            std::uint64_t const h = hasher_(key);
+            stripe& s = get_stripe(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            s.table_.insert_or_assign(
+                key, std::forward<T_>(value), h, hasher_, equal_);
+        }
+
+        size_type erase(Key const& key)
+        {
+            std::uint64_t const h = hasher_(key);
+            stripe& s = get_stripe(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.table_.erase(key, h, equal_);
+        }
+
+        void clear()
+        {
+            for (stripe_type& s : stripes_)
+            {
+                std::lock_guard<mutex_type> l(s.data_.mtx_);
+                s.data_.table_.clear();
+            }
+        }
+
+        /// Invoke the given function for all elements, one stripe at a time.
+        /// The function must not access the map.
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for (stripe_type const& s : stripes_)
+            {
+                std::lock_guard<mutex_type> l(s.data_.mtx_);
+                s.data_.table_.for_each(f);
+            }
+        }
+
+    private:
+        void copy_from(open_addressing_map const& rhs)
+        {
+            for (std::size_t i = 0; i != stripes_.size(); ++i)
+            {
+                std::lock_guard<mutex_type> l(rhs.stripes_[i].data_.mtx_);
+                stripes_[i].data_.table_ = rhs.stripes_[i].data_.table_;
+            }
+        }
+
+        // Exchange the stripes (and with them the stripe count) and the
+        // function objects, the stripe an element is stored in depends on
+        // both. Not thread-safe with respect to concurrent operations on
+        // either map.
+        void swap_with(open_addressing_map& rhs)
+        {
+            std::swap(stripes_, rhs.stripes_);
+            std::swap(hasher_, rhs.hasher_);
+            std::swap(equal_, rhs.equal_);
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void save(Archive& ar, unsigned) const
+        {
+            std::uint64_t const num_stripes = stripes_.size();
+            ar << num_stripes;
+
+            for (stripe_type const& s : stripes_)
+            {
+                std::lock_guard<mutex_type> l(s.data_.mtx_);
+
+                std::uint64_t const count = s.data_.table_.size();
+                ar << count;
+                s.data_.table_.for_each([&](value_type const& value) {
+                    ar << value.first << value.second;
+                });
+            }
+        }
+
+        template <typename Archive>
+        void load(Archive& ar, unsigned)
+        {
+            std::uint64_t num_stripes = 0;
+            ar >> num_stripes;
+
+            open_addressing_map tmp(0, hasher_.hash_, equal_,
+                std::size_t(num_stripes));
+            for (std::uint64_t i = 0; i != num_stripes; ++i)
+            {
+                std::uint64_t count = 0;
+                ar >> count;
+
+                for (std::uint64_t j = 0; j != count; ++j)
+                {
+                    Key key;
+                    T value;
+                    ar >> key >> value;
+                    tmp.insert_or_assign(key, std::move(value));
+                }
+            }
+
+            swap_with(tmp);
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+
+    private:
+        mutable std::vector<stripe_type> stripes_;
+        hasher hasher_;
+        KeyEqual equal_;
+    };
+}}
+
+namespace hpx
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Selects hpx::detail::open_addressing_map as the storage of the
+    /// partitions of a hpx::unordered_map. All operations on the partitions
+    /// are performed concurrently without locking the partition components.
+    struct unordered_map_open_addressing_backend
+    {
+        template <typename Key, typename T, typename Hash, typename KeyEqual>
+        struct apply
+        {
+            typedef detail::open_addressing_map<Key, T, Hash, KeyEqual> type;
+        };
+
+        static constexpr bool is_concurrent = true;
+
+        template <typename Map, typename Key, typename T>
+        static bool get_value(Map& m, Key const& key, T& value, bool erase)
+        {
+            return erase ? m.extract(key, value) : m.find(key, value);
+        }
+
+        template <typename Map, typename Key, typename T_>
+        static void set_value(Map& m, Key const& key, T_&& value)
+        {
+            m.insert_or_assign(key, std::forward<T_>(value));
+        }
+    };
+}
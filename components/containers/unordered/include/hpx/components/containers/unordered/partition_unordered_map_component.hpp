@@ -36,39 +36,101 @@
 #include <hpx/runtime/components/server/simple_component_base.hpp>
 #include <hpx/runtime/get_ptr.hpp>
 
+#include <hpx/components/containers/unordered/open_addressing_map.hpp>
+
 #include <cstddef>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+namespace hpx
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Selects std::unordered_map as the storage of the partitions of a
+    /// hpx::unordered_map (this is the default). All actions invoked on a
+    /// partition are serialized by locking the partition component.
+    struct unordered_map_std_backend
+    {
+        template <typename Key, typename T, typename Hash, typename KeyEqual>
+        struct apply
+        {
+            typedef std::unordered_map<Key, T, Hash, KeyEqual> type;
+        };
+
+        static constexpr bool is_concurrent = false;
+
+        template <typename Map, typename Key, typename T>
+        static bool get_value(Map& m, Key const& key, T& value, bool erase)
+        {
+            typename Map::iterator it = m.find(key);
+            if (it == m.end())
+                return false;
+
+            if (!erase)
+            {
+                value = it->second;
+            }
+            else
+            {
+                value = std::move(it->second);
+                m.erase(it);
+            }
+            return true;
+        }
+
+        template <typename Map, typename Key, typename T_>
+        static void set_value(Map& m, Key const& key, T_&& value)
+        {
+            m[key] = std::forward<T_>(value);
+        }
+    };
+}
+
 namespace hpx { namespace server
 {
+    namespace detail
+    {
+        template <typename Component, typename Backend>
+        struct partition_unordered_map_base
+        {
+            typedef typename std::conditional<Backend::is_concurrent,
+                    hpx::components::simple_component_base<Component>,
+                    components::locking_hook<
+                        hpx::components::simple_component_base<Component> >
+                >::type type;
+        };
+    }
+
     /// \brief This is the basic wrapper class for stl unordered_map.
     ///
     /// This contain the implementation of the partition_unordered_map's
-    /// component functionality.
+    /// component functionality. The storage used for the elements is selected
+    /// by \a Backend.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
-        typename KeyEqual = std::equal_to<Key> >
+        typename KeyEqual = std::equal_to<Key>,
+        typename Backend = unordered_map_std_backend>
     class partition_unordered_map
-      : public components::locking_hook<
-            hpx::components::simple_component_base<
-                partition_unordered_map<Key, T, Hash, KeyEqual> > >
+      : public detail::partition_unordered_map_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual, Backend>,
+            Backend
+        >::type
     {
     public:
-        typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
+        typedef typename Backend::template apply<
+                Key, T, Hash, KeyEqual
+            >::type data_type;
 
         typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
 
-        typedef components::locking_hook<
-                hpx::components::simple_component_base<
-                    partition_unordered_map<Key, T, Hash, KeyEqual> > >
-            base_type;
+        typedef typename detail::partition_unordered_map_base<
+                partition_unordered_map<Key, T, Hash, KeyEqual, Backend>,
+                Backend
+            >::type base_type;
 
     private:
         data_type partition_unordered_map_;
@@ -135,28 +197,35 @@ namespace hpx { namespace server
         }
 
         ///////////////////////////////////////////////////////////////////////
-        iterator_type begin()
+        // iteration is supported only for the std::unordered_map backend
+        template <typename Data = data_type>
+        typename Data::iterator begin()
         {
             return partition_unordered_map_.begin();
         }
-        const_iterator_type begin() const
+        template <typename Data = data_type>
+        typename Data::const_iterator begin() const
         {
             return partition_unordered_map_.begin();
         }
-        const_iterator_type cbegin() const
+        template <typename Data = data_type>
+        typename Data::const_iterator cbegin() const
         {
             return partition_unordered_map_.cbegin();
         }
 
-        iterator_type end()
+        template <typename Data = data_type>
+        typename Data::iterator end()
         {
             return partition_unordered_map_.end();
         }
-        const_iterator_type end() const
+        template <typename Data = data_type>
+        typename Data::const_iterator end() const
         {
             return partition_unordered_map_.end();
         }
-        const_iterator_type cend() const
+        template <typename Data = data_type>
+        typename Data::const_iterator cend() const
         {
             return partition_unordered_map_.cend();
         }
@@ -203,36 +272,18 @@ namespace hpx { namespace server
         /// \return Return the value of the element at position represented
         ///         by \a pos.
         ///
-        struct erase_on_exit
-        {
-            erase_on_exit(data_type& m, typename data_type::iterator& it)
-              : m_(m), it_(it)
-            {}
-            ~erase_on_exit()
-            {
-                m_.erase(it_);
-            }
-
-            data_type& m_;
-            typename data_type::iterator& it_;
-        };
-
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it = partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            T result;
+            if (!Backend::get_value(
+                    partition_unordered_map_, key, result, erase))
             {
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "partition_unordered_map::get_value",
                     "unable to find requested key in this partition of the "
                     "unordered_map");
             }
-
-            if (!erase)
-                return it->second;
-
-            erase_on_exit t(partition_unordered_map_, it);
-            return it->second;
+            return result;
         }
 
         /// Return the element at the position \a pos in the partition_unordered_map
@@ -245,22 +296,17 @@ namespace hpx { namespace server
         ///
         std::vector<T> get_values(std::vector<Key> const& keys)
         {
-            std::vector<T> result;
-            result.reserve(keys.size());
-
+            std::vector<T> result(keys.size());
             for (std::size_t i = 0; i != keys.size(); ++i)
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
+                if (!Backend::get_value(
+                        partition_unordered_map_, keys[i], result[i], false))
                 {
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "partition_unordered_map::get_values",
                         "unable to find requested key in this partition of the "
                         "unordered_map");
-                    break;
                 }
-                result.push_back(it->second);
             }
             return result;
         }
@@ -278,7 +324,7 @@ namespace hpx { namespace server
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            Backend::set_value(partition_unordered_map_, pos, val);
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -292,10 +338,9 @@ namespace hpx { namespace server
             std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+                Backend::set_value(partition_unordered_map_, keys[i], val[i]);
         }
 
         /// Remove all elements from the vector leaving the
@@ -351,7 +396,14 @@ namespace hpx { namespace server
 /**/
 
 #define HPX_REGISTER_UNORDERED_MAP_DECLARATION_5(key, type, hash, equal, name)\
-    typedef ::hpx::server::partition_unordered_map<key, type, hash, equal>    \
+    HPX_REGISTER_UNORDERED_MAP_DECLARATION_6(key, type, hash, equal,          \
+        ::hpx::unordered_map_std_backend, name)                               \
+/**/
+
+#define HPX_REGISTER_UNORDERED_MAP_DECLARATION_6(                             \
+        key, type, hash, equal, backend, name)                                \
+    typedef ::hpx::server::partition_unordered_map<                           \
+            key, type, hash, equal, backend>                                  \
         HPX_PP_CAT(partition_unordered_map, __LINE__);                        \
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_value_action,      \
@@ -410,7 +462,13 @@ namespace hpx { namespace server
 /**/
 
 #define HPX_REGISTER_UNORDERED_MAP_5(key, type, hash, equal, name)            \
-    typedef ::hpx::server::partition_unordered_map<key, type, hash, equal>    \
+    HPX_REGISTER_UNORDERED_MAP_6(key, type, hash, equal,                      \
+        ::hpx::unordered_map_std_backend, name)                               \
+/**/
+
+#define HPX_REGISTER_UNORDERED_MAP_6(key, type, hash, equal, backend, name)   \
+    typedef ::hpx::server::partition_unordered_map<                           \
+            key, type, hash, equal, backend>                                  \
         HPX_PP_CAT(partition_unordered_map, __LINE__);                        \
     HPX_REGISTER_ACTION(                                                      \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_value_action,      \
@@ -455,19 +513,21 @@ namespace hpx { namespace server
 namespace hpx
 {
     template <typename Key, typename T, typename Hash = std::hash<Key>,
-        typename KeyEqual = std::equal_to<Key> >
+        typename KeyEqual = std::equal_to<Key>,
+        typename Backend = unordered_map_std_backend>
     class partition_unordered_map
       : public components::client_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>,
-            server::partition_unordered_map<Key, T, Hash, KeyEqual>
+            partition_unordered_map<Key, T, Hash, KeyEqual, Backend>,
+            server::partition_unordered_map<Key, T, Hash, KeyEqual, Backend>
         >
     {
     private:
-        typedef hpx::server::partition_unordered_map<Key, T, Hash, KeyEqual>
-            server_type;
+        typedef hpx::server::partition_unordered_map<
+                Key, T, Hash, KeyEqual, Backend
+            > server_type;
         typedef hpx::components::client_base<
-                partition_unordered_map<Key, T, Hash, KeyEqual>,
-                server::partition_unordered_map<Key, T, Hash, KeyEqual>
+                partition_unordered_map<Key, T, Hash, KeyEqual, Backend>,
+                server::partition_unordered_map<Key, T, Hash, KeyEqual, Backend>
             > base_type;
 
     public:
@@ -482,8 +542,7 @@ namespace hpx
         {}
 
         // Return the pinned pointer to the underlying component
-        std::shared_ptr<server::partition_unordered_map<Key, T, Hash, KeyEqual> >
-        get_ptr() const
+        std::shared_ptr<server_type> get_ptr() const
         {
             error_code ec(lightweight);
             return hpx::get_ptr<server_type>(this->get_id()).get(ec);
@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/runtime/components/client_base.hpp>
 #include <hpx/runtime/components/component_type.hpp>
 #include <hpx/runtime/components/copy_component.hpp>
@@ -112,11 +113,12 @@ namespace hpx
     namespace detail
     {
         ///////////////////////////////////////////////////////////////////////
-        template <typename Key, typename T, typename Hash, typename KeyEqual>
+        template <typename Key, typename T, typename Hash, typename KeyEqual,
+            typename Backend>
         struct unordered_map_value_proxy
         {
             unordered_map_value_proxy(
-                    hpx::unordered_map<Key, T, Hash, KeyEqual>& um,
+                    hpx::unordered_map<Key, T, Hash, KeyEqual, Backend>& um,
                     Key const& key)
               : um_(um), key_(key)
             {}
@@ -133,7 +135,7 @@ namespace hpx
                 return *this;
             }
 
-            hpx::unordered_map<Key, T, Hash, KeyEqual>& um_;
+            hpx::unordered_map<Key, T, Hash, KeyEqual, Backend>& um_;
             Key const& key_;
         };
 
@@ -226,10 +228,11 @@ namespace hpx
     ///  This class defines the synchronous and asynchronous API's for each of
     ///  the exposed functionalities.
     ///
-    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    template <typename Key, typename T, typename Hash, typename KeyEqual,
+        typename Backend>
     class unordered_map
       : hpx::components::client_base<
-            unordered_map<Key, T, Hash, KeyEqual>,
+            unordered_map<Key, T, Hash, KeyEqual, Backend>,
             hpx::components::server::distributed_metadata_base<
                 server::unordered_map_config_data> >,
         detail::unordered_base<Hash, KeyEqual>
@@ -262,9 +265,10 @@ namespace hpx
             > base_type;
         typedef detail::unordered_base<Hash, KeyEqual> hash_base_type;
 
-        typedef hpx::server::partition_unordered_map<Key, T, Hash, KeyEqual>
-            partition_unordered_map_server;
-        typedef hpx::partition_unordered_map<Key, T, Hash, KeyEqual>
+        typedef hpx::server::partition_unordered_map<
+                Key, T, Hash, KeyEqual, Backend
+            > partition_unordered_map_server;
+        typedef hpx::partition_unordered_map<Key, T, Hash, KeyEqual, Backend>
             partition_unordered_map_client;
 
         struct partition_data
@@ -616,11 +620,11 @@ namespace hpx
         /// \note The non-const version of is operator returns a proxy object
         ///       instead of a real reference to the element.
         ///
-        detail::unordered_map_value_proxy<Key, T, Hash, KeyEqual>
+        detail::unordered_map_value_proxy<Key, T, Hash, KeyEqual, Backend>
         operator[](Key const& pos)
         {
             return detail::unordered_map_value_proxy<
-                    Key, T, Hash, KeyEqual
+                    Key, T, Hash, KeyEqual, Backend
                 >(*this, pos);
         }
         T operator[](Key const& pos) const
@@ -777,6 +781,151 @@ namespace hpx
                 .set_value(pos, std::forward<T_>(val));
         }
 
+        /// Returns the elements with the given keys in the unordered_map
+        /// container asynchronously. The keys are grouped by partition on the
+        /// calling side, every partition is accessed only once.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements with
+        ///         the given keys (in the same order as the keys).
+        ///
+        future<std::vector<T> > get_values(std::vector<Key> const& keys) const
+        {
+            // group the keys by partition, remember their original positions
+            std::vector<std::vector<Key> > part_keys(partitions_.size());
+            std::vector<std::vector<std::size_t> > positions(
+                partitions_.size());
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t part = get_partition(keys[i]);
+                part_keys[part].push_back(keys[i]);
+                positions[part].push_back(i);
+            }
+
+            std::vector<future<std::vector<T> > > values;
+            std::vector<std::vector<std::size_t> > value_positions;
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    values.push_back(make_ready_future(
+                        part_data.local_data_->get_values(part_keys[part])));
+                }
+                else
+                {
+                    values.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .get_values(part_keys[part]));
+                }
+                value_positions.push_back(std::move(positions[part]));
+            }
+
+            std::size_t count = keys.size();
+            return hpx::when_all(values).then(hpx::launch::sync,
+                [count, value_positions = std::move(value_positions)](
+                    future<std::vector<future<std::vector<T> > > >&& f)
+                -> std::vector<T>
+                {
+                    std::vector<future<std::vector<T> > > values = f.get();
+
+                    std::vector<T> result(count);
+                    for (std::size_t i = 0; i != values.size(); ++i)
+                    {
+                        std::vector<T> part_values = values[i].get();
+                        std::vector<std::size_t> const& pos =
+                            value_positions[i];
+                        for (std::size_t j = 0; j != pos.size(); ++j)
+                            result[pos[j]] = std::move(part_values[j]);
+                    }
+                    return result;
+                });
+        }
+
+        /// Returns the elements with the given keys in the unordered_map
+        /// container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements with the given keys (in
+        ///         the same order as the keys).
+        ///
+        std::vector<T> get_values(launch::sync_policy,
+            std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Asynchronously set the elements with the given keys in the
+        /// unordered_map container to the given values. The keys are grouped
+        /// by partition on the calling side, every partition is accessed only
+        /// once.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            std::vector<std::vector<Key> > part_keys(partitions_.size());
+            std::vector<std::vector<T> > part_vals(partitions_.size());
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t part = get_partition(keys[i]);
+                part_keys[part].push_back(keys[i]);
+                part_vals[part].push_back(vals[i]);
+            }
+
+            std::vector<future<void> > results;
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    part_data.local_data_->set_values(
+                        part_keys[part], part_vals[part]);
+                }
+                else
+                {
+                    results.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .set_values(part_keys[part], part_vals[part]));
+                }
+            }
+
+            return hpx::when_all(results).then(hpx::launch::sync,
+                [](future<std::vector<future<void> > >&& f) -> void
+                {
+                    // propagate exceptions
+                    for (future<void>& r : f.get())
+                        r.get();
+                });
+        }
+
+        /// Set the elements with the given keys in the unordered_map container
+        /// to the given values.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
         /// Asynchronously compute the size of the unordered_map.
         ///
         /// \return Return the number of elements in the unordered_map
@@ -852,11 +1001,11 @@ namespace hpx
 
         ///////////////////////////////////////////////////////////////////////
         typedef segment_unordered_map_iterator<
-                Key, T, Hash, KeyEqual,
+                Key, T, Hash, KeyEqual, Backend,
                 typename partitions_vector_type::iterator
             > segment_iterator;
         typedef const_segment_unordered_map_iterator<
-                Key, T, Hash, KeyEqual,
+                Key, T, Hash, KeyEqual, Backend,
                 typename partitions_vector_type::const_iterator
             > const_segment_iterator;
 
@@ -31,14 +31,15 @@ namespace hpx
 {
     ///////////////////////////////////////////////////////////////////////////
     template <typename Key, typename T, typename Hash = std::hash<Key>,
-        typename KeyEqual = std::equal_to<Key> >
+        typename KeyEqual = std::equal_to<Key>,
+        typename Backend = unordered_map_std_backend>
     class unordered_map;
 
     template <typename Key, typename T, typename Hash, typename KeyEqual,
-        typename BaseIter>
+        typename Backend, typename BaseIter>
     class segment_unordered_map_iterator;
     template <typename Key, typename T, typename Hash, typename KeyEqual,
-        typename BaseIter>
+        typename Backend, typename BaseIter>
     class const_segment_unordered_map_iterator;
 
     ///////////////////////////////////////////////////////////////////////////
@@ -46,30 +47,30 @@ namespace hpx
 
     /// This class implement the segmented iterator for the hpx::vector
     template <typename Key, typename T, typename Hash, typename KeyEqual,
-        typename BaseIter>
+        typename Backend, typename BaseIter>
     class segment_unordered_map_iterator
       : public hpx::util::iterator_adaptor<
-            segment_unordered_map_iterator<Key, T, Hash, KeyEqual, BaseIter>,
+            segment_unordered_map_iterator<Key, T, Hash, KeyEqual, Backend, BaseIter>,
             BaseIter
         >
     {
     private:
         typedef hpx::util::iterator_adaptor<
-                segment_unordered_map_iterator<Key, T, Hash, KeyEqual, BaseIter>,
+                segment_unordered_map_iterator<Key, T, Hash, KeyEqual, Backend, BaseIter>,
                 BaseIter
             > base_type;
 
     public:
         explicit segment_unordered_map_iterator(BaseIter const& it,
-                unordered_map<Key, T, Hash, KeyEqual>* data = nullptr)
+                unordered_map<Key, T, Hash, KeyEqual, Backend>* data = nullptr)
           : base_type(it), data_(data)
         {}
 
-        unordered_map<Key, T, Hash, KeyEqual>* get_data()
+        unordered_map<Key, T, Hash, KeyEqual, Backend>* get_data()
         {
             return data_;
         }
-        unordered_map<Key, T, Hash, KeyEqual> const* get_data() const
+        unordered_map<Key, T, Hash, KeyEqual, Backend> const* get_data() const
         {
             return data_;
         }
@@ -81,32 +82,32 @@ namespace hpx
         }
 
     private:
-        unordered_map<Key, T, Hash, KeyEqual>* data_;
+        unordered_map<Key, T, Hash, KeyEqual, Backend>* data_;
     };
 
     template <typename Key, typename T, typename Hash, typename KeyEqual,
-        typename BaseIter>
+        typename Backend, typename BaseIter>
     class const_segment_unordered_map_iterator
       : public hpx::util::iterator_adaptor<
             const_segment_unordered_map_iterator<
-                Key, T, Hash, KeyEqual, BaseIter>,
+                Key, T, Hash, KeyEqual, Backend, BaseIter>,
             BaseIter
         >
     {
     private:
         typedef hpx::util::iterator_adaptor<
                 const_segment_unordered_map_iterator<
-                    Key, T, Hash, KeyEqual, BaseIter>,
+                    Key, T, Hash, KeyEqual, Backend, BaseIter>,
                 BaseIter
             > base_type;
 
     public:
         explicit const_segment_unordered_map_iterator(BaseIter const& it,
-                unordered_map<Key, T, Hash, KeyEqual> const* data = nullptr)
+                unordered_map<Key, T, Hash, KeyEqual, Backend> const* data = nullptr)
           : base_type(it), data_(data)
         {}
 
-        unordered_map<Key, T, Hash, KeyEqual> const* get_data() const
+        unordered_map<Key, T, Hash, KeyEqual, Backend> const* get_data() const
         {
             return data_;
         }
@@ -118,7 +119,7 @@ namespace hpx
         }
 
     private:
-        unordered_map<Key, T, Hash, KeyEqual> const* data_;
+        unordered_map<Key, T, Hash, KeyEqual, Backend> const* data_;
     };
 
 //     ///////////////////////////////////////////////////////////////////////////
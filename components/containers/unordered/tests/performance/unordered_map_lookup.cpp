@@ -0,0 +1,219 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the lookup throughput of hpx::unordered_map for both
+// partition backends (std::unordered_map and the open-addressing map), using
+// point lookups (one action per key) and batched lookups (one action per
+// partition). Additionally, the raw lookup throughput of the partition storage
+// is measured from all worker threads concurrently.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_UNORDERED_MAP(std::uint64_t, double);
+HPX_REGISTER_UNORDERED_MAP(std::uint64_t, double, std::hash<std::uint64_t>,
+    std::equal_to<std::uint64_t>, hpx::unordered_map_open_addressing_backend,
+    double_open_addressing);
+
+using std_map_type = hpx::unordered_map<std::uint64_t, double>;
+using open_addressing_map_type =
+    hpx::unordered_map<std::uint64_t, double, std::hash<std::uint64_t>,
+        std::equal_to<std::uint64_t>,
+        hpx::unordered_map_open_addressing_backend>;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint64_t> make_keys(std::size_t count, unsigned int seed)
+{
+    std::mt19937_64 gen(seed);
+    std::vector<std::uint64_t> keys(count);
+    for (std::uint64_t& key : keys)
+        key = gen();
+    return keys;
+}
+
+template <typename Map>
+void fill_map(Map& m, std::vector<std::uint64_t> const& keys)
+{
+    std::vector<double> values(keys.size());
+    for (std::size_t i = 0; i != keys.size(); ++i)
+        values[i] = double(i);
+
+    m.set_values(hpx::launch::sync, keys, values);
+}
+
+// lookups per second using one (asynchronous) action per key
+template <typename Map>
+double measure_point_lookups(Map const& m,
+    std::vector<std::uint64_t> const& keys, std::size_t iterations)
+{
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::vector<hpx::future<double>> values;
+        values.reserve(keys.size());
+        for (std::uint64_t key : keys)
+            values.push_back(m.get_value(key));
+        hpx::wait_all(values);
+    }
+
+    double elapsed =
+        double(hpx::util::high_resolution_clock::now() - start) * 1e-9;
+    return double(iterations * keys.size()) / elapsed;
+}
+
+// lookups per second using one action per partition and batch
+template <typename Map>
+double measure_batched_lookups(Map const& m,
+    std::vector<std::uint64_t> const& keys, std::size_t batch_size,
+    std::size_t iterations)
+{
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::vector<hpx::future<std::vector<double>>> values;
+        for (std::size_t first = 0; first < keys.size(); first += batch_size)
+        {
+            std::size_t last = (std::min)(first + batch_size, keys.size());
+            values.push_back(m.get_values(std::vector<std::uint64_t>(
+                keys.begin() + first, keys.begin() + last)));
+        }
+        hpx::wait_all(values);
+    }
+
+    double elapsed =
+        double(hpx::util::high_resolution_clock::now() - start) * 1e-9;
+    return double(iterations * keys.size()) / elapsed;
+}
+
+// lookups per second into the storage of a partition, from all cores
+template <typename Find>
+double measure_local_lookups(std::vector<std::uint64_t> const& keys,
+    std::size_t iterations, Find&& find)
+{
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    hpx::for_loop(hpx::execution::par, std::size_t(0), iterations,
+        [&](std::size_t) {
+            double sum = 0;
+            for (std::uint64_t key : keys)
+                sum += find(key);
+            HPX_TEST_LTE(0.0, sum);
+        });
+
+    double elapsed =
+        double(hpx::util::high_resolution_clock::now() - start) * 1e-9;
+    return double(iterations * keys.size()) / elapsed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Map>
+void run_benchmark(char const* name, std::vector<std::uint64_t> const& keys,
+    std::size_t batch_size, std::size_t iterations)
+{
+    Map m(keys.size(), hpx::container_layout(hpx::find_all_localities()));
+    fill_map(m, keys);
+
+    double point = measure_point_lookups(m, keys, iterations);
+    double batched = measure_batched_lookups(m, keys, batch_size, iterations);
+
+    std::cout << name << ": point lookups/s: " << point
+              << ", batched lookups/s: " << batched << std::endl;
+
+    hpx::util::print_cdash_timing(
+        (std::string("PointLookup_") + name).c_str(), 1.0 / point);
+    hpx::util::print_cdash_timing(
+        (std::string("BatchedLookup_") + name).c_str(), 1.0 / batched);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t num_keys = vm["keys"].as<std::size_t>();
+    std::size_t batch_size = vm["batch-size"].as<std::size_t>();
+    std::size_t iterations = vm["iterations"].as<std::size_t>();
+    unsigned int seed = vm["seed"].as<unsigned int>();
+
+    std::vector<std::uint64_t> keys = make_keys(num_keys, seed);
+
+    run_benchmark<std_map_type>("std", keys, batch_size, iterations);
+    run_benchmark<open_addressing_map_type>(
+        "open_addressing", keys, batch_size, iterations);
+
+    // raw storage throughput
+    {
+        std::unordered_map<std::uint64_t, double> m;
+        for (std::size_t i = 0; i != keys.size(); ++i)
+            m[keys[i]] = double(i);
+
+        hpx::lcos::local::spinlock mtx;
+        double rate = measure_local_lookups(
+            keys, 10 * iterations, [&](std::uint64_t key) {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx);
+                return m.find(key)->second;
+            });
+
+        std::cout << "local std: lookups/s: " << rate << std::endl;
+        hpx::util::print_cdash_timing("LocalLookup_std", 1.0 / rate);
+    }
+
+    {
+        hpx::detail::open_addressing_map<std::uint64_t, double> m(keys.size());
+        for (std::size_t i = 0; i != keys.size(); ++i)
+            m.insert_or_assign(keys[i], double(i));
+
+        double rate = measure_local_lookups(
+            keys, 10 * iterations, [&](std::uint64_t key) {
+                double value = 0;
+                m.find(key, value);
+                return value;
+            });
+
+        std::cout << "local open_addressing: lookups/s: " << rate
+                  << std::endl;
+        hpx::util::print_cdash_timing(
+            "LocalLookup_open_addressing", 1.0 / rate);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("keys", value<std::size_t>()->default_value(100000),
+         "number of keys to store and look up (default: 100000)")
+        ("batch-size", value<std::size_t>()->default_value(1000),
+         "number of keys per batched lookup (default: 1000)")
+        ("iterations", value<std::size_t>()->default_value(5),
+         "number of times to repeat the lookups (default: 5)")
+        ("seed", value<unsigned int>()->default_value(42),
+         "seed for the generated keys (default: 42)")
+        ;
+    // clang-format on
+
+    return hpx::init(desc_commandline, argc, argv);
+}
@@ -20,10 +20,15 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Define the vector types to be used.
 HPX_REGISTER_UNORDERED_MAP(std::string, double);
+HPX_REGISTER_UNORDERED_MAP(std::string, double, std::hash<std::string>,
+    std::equal_to<std::string>, hpx::unordered_map_open_addressing_backend,
+    double_open_addressing);
 
 ///////////////////////////////////////////////////////////////////////////////
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-void test_global_iteration(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
+template <typename Key, typename Value, typename Hash, typename KeyEqual,
+    typename Backend>
+void test_global_iteration(
+    hpx::unordered_map<Key, Value, Hash, KeyEqual, Backend>& m,
     Value const& val = Value())
 {
     std::size_t size = m.size();
@@ -64,8 +69,10 @@ void test_global_iteration(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
 //     HPX_TEST_EQ(count, size);
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-void fill_unordered_map(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
+template <typename Key, typename Value, typename Hash, typename KeyEqual,
+    typename Backend>
+void fill_unordered_map(
+    hpx::unordered_map<Key, Value, Hash, KeyEqual, Backend>& m,
     std::size_t count, Value const& val)
 {
     for (std::size_t i = 0; i != count; ++i)
@@ -76,6 +83,42 @@ void fill_unordered_map(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
     HPX_TEST_EQ(m.size(), count);
 }
 
+template <typename Key, typename Value, typename Hash, typename KeyEqual,
+    typename Backend>
+void test_bulk_access(
+    hpx::unordered_map<Key, Value, Hash, KeyEqual, Backend>& m,
+    std::size_t count)
+{
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        keys.push_back("bulk" + std::to_string(i));
+        values.push_back(Value(2 * i));
+    }
+
+    std::size_t size = m.size();
+    m.set_values(hpx::launch::sync, keys, values);
+    HPX_TEST_EQ(m.size(), size + count);
+
+    // query the keys in reverse order
+    std::reverse(keys.begin(), keys.end());
+    std::vector<Value> result = m.get_values(hpx::launch::sync, keys);
+    HPX_TEST_EQ(result.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(result[i], Value(2 * (count - i - 1)));
+    }
+
+    // erase the elements again
+    for (Key const& key : keys)
+    {
+        HPX_TEST_EQ(m.erase(hpx::launch::sync, key), std::size_t(1));
+        HPX_TEST_EQ(m.erase(hpx::launch::sync, key), std::size_t(0));
+    }
+    HPX_TEST_EQ(m.size(), size);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename DistPolicy>
 void trivial_tests(DistPolicy const& policy)
@@ -106,6 +149,19 @@ void trivial_tests(DistPolicy const& policy)
 
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
+        test_bulk_access(m, 1000);
+    }
+
+    // open-addressing backend
+    {
+        hpx::unordered_map<Key, Value, std::hash<Key>, std::equal_to<Key>,
+            hpx::unordered_map_open_addressing_backend>
+            m(17, policy);
+        test_global_iteration(m);
+
+        fill_unordered_map(m, 107, Value(42));
+        test_global_iteration(m, Value(42));
+        test_bulk_access(m, 1000);
     }
 }
 
@@ -150,8 +206,75 @@ void trivial_tests()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_open_addressing_map()
+{
+    typedef hpx::detail::open_addressing_map<int, int> map_type;
+
+    map_type m(0, std::hash<int>(), std::equal_to<int>(), 4);
+    HPX_TEST(m.empty());
+
+    // force a couple of rehashes
+    for (int i = 0; i != 10000; ++i)
+        m.insert_or_assign(i, i);
+    HPX_TEST_EQ(m.size(), std::size_t(10000));
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        int value = -1;
+        HPX_TEST(m.find(i, value));
+        HPX_TEST_EQ(value, i);
+    }
+
+    int value = -1;
+    HPX_TEST(!m.find(10000, value));
+
+    // erase every other element, the remaining ones have to be still found
+    for (int i = 0; i < 10000; i += 2)
+        HPX_TEST_EQ(m.erase(i), std::size_t(1));
+    HPX_TEST_EQ(m.size(), std::size_t(5000));
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        HPX_TEST_EQ(m.find(i, value), i % 2 != 0);
+    }
+
+    HPX_TEST(m.extract(1, value));
+    HPX_TEST_EQ(value, 1);
+    HPX_TEST(!m.extract(1, value));
+
+    map_type copy(m);
+    HPX_TEST_EQ(copy.size(), std::size_t(4999));
+
+    m.clear();
+    HPX_TEST(m.empty());
+    HPX_TEST_EQ(copy.size(), std::size_t(4999));
+
+    // assign between maps using a different number of stripes
+    map_type other(0, std::hash<int>(), std::equal_to<int>(), 32);
+    other.insert_or_assign(-1, -1);
+
+    other = copy;
+    HPX_TEST_EQ(other.size(), std::size_t(4999));
+    HPX_TEST(!other.find(-1, value));
+
+    map_type single(0, std::hash<int>(), std::equal_to<int>(), 1);
+    single = std::move(other);
+    HPX_TEST_EQ(single.size(), std::size_t(4999));
+    for (int i = 0; i != 10000; ++i)
+    {
+        HPX_TEST_EQ(single.find(i, value), i % 2 != 0 && i != 1);
+    }
+
+    // the moved-from map is empty but still usable
+    other.insert_or_assign(1, 1);
+    HPX_TEST_EQ(other.size(), std::size_t(1));
+}
+
 int main()
 {
+    test_open_addressing_map();
+
     trivial_tests<std::string, double>();
 
     std::vector<hpx::id_type> localities = hpx::find_all_localities();
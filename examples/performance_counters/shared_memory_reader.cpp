@@ -0,0 +1,83 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This example demonstrates how to monitor an HPX application from outside
+// of the application. Start any HPX application with
+//
+//     --hpx:export-counter=/threads{locality#0/total}/count/cumulative
+//     --hpx:export-counter-destination=/my_counters
+//
+// and run this tool concurrently as
+//
+//     shared_memory_reader /my_counters
+//
+// The reader does not initialize HPX, it only maps the shared memory segment
+// written by the application and periodically prints the counter values.
+
+#include <hpx/performance_counters/shared_memory_segment.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace shm = hpx::performance_counters::shared_memory;
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0]
+                  << " <segment name> [interval in ms] [number of samples]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string const name = argv[1];
+    int const interval = argc > 2 ? std::atoi(argv[2]) : 1000;
+    int const samples = argc > 3 ? std::atoi(argv[3]) : 10;
+
+    // wait for the application to create and initialize the segment
+    shm::segment_reader reader;
+    for (int i = 0; i != 100 && !reader.open(name); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    if (!reader.is_open())
+    {
+        std::cerr << "could not open shared memory segment: " << name
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<shm::counter_sample> values;
+    std::int64_t timestamp = 0;
+
+    for (int i = 0; i != samples; ++i)
+    {
+        if (reader.read(values, timestamp))
+        {
+            std::cout << "timestamp: " << timestamp << "[ns]\n";
+            for (shm::counter_sample const& value : values)
+            {
+                std::cout << value.name << "," << value.get_value();
+                if (!value.unit.empty())
+                    std::cout << "[" << value.unit << "]";
+                std::cout << "\n";
+            }
+            std::cout << std::flush;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -19,6 +19,7 @@
 
 #include <hpx/plugins/parcel/message_buffer.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -60,6 +61,8 @@ namespace hpx { namespace plugins { namespace parcel
         std::int64_t get_messages_count(bool reset);
         std::int64_t get_parcels_per_message_count(bool reset);
         std::int64_t get_average_time_between_parcels(bool reset);
+        std::int64_t get_batch_size(bool reset);
+        std::int64_t get_flush_interval(bool reset);
         std::vector<std::int64_t>
             get_time_between_parcels_histogram(bool reset);
         void get_time_between_parcels_histogram_creator(
@@ -78,6 +81,10 @@ namespace hpx { namespace plugins { namespace parcel
 
         void update_num_messages();
         void update_interval();
+        void update_adaptive();
+        void update_bypass();
+
+        void update_adaptive_parameters(std::int64_t time_since_last_parcel);
 
     private:
         mutable mutex_type mtx_;
@@ -90,6 +97,16 @@ namespace hpx { namespace plugins { namespace parcel
         bool allow_background_flush_;
         std::string action_name_;
 
+        // parameters of the adaptive coalescing policy: the number of parcels
+        // to coalesce into one message and the time (in nanoseconds) after
+        // which the parcels are sent regardless
+        bool adaptive_;
+        bool bypass_;
+        std::size_t batch_size_;
+        std::int64_t flush_interval_;
+        double average_time_between_parcels_;
+        std::atomic<std::int64_t> pending_parcels_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
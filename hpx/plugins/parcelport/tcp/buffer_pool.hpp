@@ -0,0 +1,126 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_TCP)
+
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The buffer pool keeps memory blocks released by the send and receive
+    // buffers of the TCP parcelport for later reuse. Blocks are managed in
+    // size classes (powers of two), requests are rounded up to the next size
+    // class. Allocations larger than the largest size class are always served
+    // by the system allocator.
+    class HPX_EXPORT buffer_pool
+    {
+    public:
+        // size classes range from 2^min_size_class_bits to
+        // 2^max_size_class_bits bytes
+        static constexpr std::size_t min_size_class_bits = 8;
+        static constexpr std::size_t max_size_class_bits = 24;
+        static constexpr std::size_t num_size_classes =
+            max_size_class_bits - min_size_class_bits + 1;
+
+        HPX_NON_COPYABLE(buffer_pool);
+
+        buffer_pool();
+        ~buffer_pool();
+
+        // the pool shared by all connections of the TCP parcelport
+        static buffer_pool& get_buffer_pool();
+
+        void* allocate(std::size_t size);
+        void deallocate(void* p, std::size_t size) noexcept;
+
+        // limit the overall amount of memory held by the pool, a value of
+        // zero disables the pool
+        void set_max_retained_bytes(std::size_t max_retained_bytes);
+
+        // release all memory currently held by the pool
+        void clear();
+
+        std::int64_t get_hits(bool reset);
+        std::int64_t get_misses(bool reset);
+        std::int64_t get_retained_bytes(bool reset) const;
+
+    private:
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        struct size_class
+        {
+            mutex_type mtx_;
+            std::vector<void*> blocks_;
+        };
+
+        static std::size_t get_size_class(std::size_t size) noexcept;
+
+        util::cache_line_data<size_class> size_classes_[num_size_classes];
+
+        std::atomic<std::size_t> max_retained_bytes_;
+        std::atomic<std::size_t> retained_bytes_;
+        std::atomic<std::int64_t> hits_;
+        std::atomic<std::int64_t> misses_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Stateless allocator drawing its memory from the buffer pool.
+    template <typename T>
+    struct buffer_pool_allocator
+    {
+        using value_type = T;
+
+        buffer_pool_allocator() = default;
+
+        template <typename U>
+        buffer_pool_allocator(buffer_pool_allocator<U> const&) noexcept
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(
+                buffer_pool::get_buffer_pool().allocate(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            buffer_pool::get_buffer_pool().deallocate(p, n * sizeof(T));
+        }
+
+        friend bool operator==(
+            buffer_pool_allocator const&, buffer_pool_allocator const&)
+        {
+            return true;
+        }
+
+        friend bool operator!=(
+            buffer_pool_allocator const&, buffer_pool_allocator const&)
+        {
+            return false;
+        }
+    };
+
+    // type of the buffers used to send and receive parcel data
+    using pooled_buffer_type = std::vector<char, buffer_pool_allocator<char>>;
+}}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -106,6 +106,10 @@ namespace hpx { namespace parcelset
 
             parcelset::locality create_locality() const;
 
+            // retrieve the statistics of the pool of message buffers
+            std::int64_t get_buffer_pool_statistics(
+                buffer_pool_statistics_type t, bool reset) override;
+
         private:
             void handle_accept(boost::system::error_code const & e,
                 std::shared_ptr<receiver> receiver_conn);
@@ -115,6 +119,9 @@ namespace hpx { namespace parcelset
             /// Acceptor used to listen for incoming connections.
             boost::asio::ip::tcp::acceptor* acceptor_;
 
+            /// Zero-copy chunks smaller than this are copied before sending
+            std::size_t inline_chunk_threshold_;
+
             /// The list of accepted connections
             mutable lcos::local::spinlock connections_mtx_;
 
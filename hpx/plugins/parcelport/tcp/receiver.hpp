@@ -22,6 +22,7 @@
 #include <hpx/functional/protect.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/tcp/buffer_pool.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
@@ -53,7 +54,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
     class connection_handler;
 
     class receiver
-      : public parcelport_connection<receiver, std::vector<char>, std::vector<char> >
+      : public parcelport_connection<receiver, pooled_buffer_type,
+            pooled_buffer_type>
     {
         typedef hpx::lcos::local::spinlock mutex_type;
     public:
@@ -319,7 +321,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         Handler)
                     = &receiver::handle_write_ack<Handler>;
 
-                // decode the received parcels.
+                // decode the received parcels, this releases the receive
+                // buffers to the buffer pool
                 decode_parcels(parcelport_, std::move(buffer_), -1);
                 buffer_ = parcel_buffer_type();
 
@@ -18,6 +18,7 @@
 #include <hpx/config/asio.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/tcp/buffer_pool.hpp>
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
@@ -43,6 +44,8 @@
 #undef VT2
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -50,7 +53,7 @@
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
     class sender
-      : public parcelset::parcelport_connection<sender, std::vector<char> >
+      : public parcelset::parcelport_connection<sender, pooled_buffer_type>
     {
         using postprocess_handler_type = util::unique_function_nonser<void(
             boost::system::error_code const&)>;
@@ -59,12 +62,15 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         /// Construct a sending parcelport_connection with the given io_service.
         sender(boost::asio::io_service& io_service,
                 parcelset::locality const& locality_id,
-                parcelset::parcelport* pp)
+                parcelset::parcelport* pp,
+                std::size_t inline_chunk_threshold =
+                    HPX_PARCEL_TCP_INLINE_CHUNK_THRESHOLD)
           : socket_(io_service)
           , ack_(0)
           , there_(locality_id)
           , timer_()
           , pp_(pp)
+          , inline_chunk_threshold_(inline_chunk_threshold)
         {
         }
 
@@ -130,37 +136,40 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
 
             // Write the serialized data to the socket. We use "gather-write"
-            // to send both the header and the data in a single write operation.
-            std::vector<boost::asio::const_buffer> buffers;
-            buffers.push_back(boost::asio::buffer(&buffer_.size_,
-                sizeof(buffer_.size_)));
-            buffers.push_back(boost::asio::buffer(&buffer_.data_size_,
-                sizeof(buffer_.data_size_)));
+            // to send the header, the data, and all zero-copy chunks in a
+            // single (vectored) write operation.
+            buffers_.clear();
+
+            // the header fields are copied into one contiguous buffer
+            char* header = header_;
+            std::memcpy(header, &buffer_.size_, sizeof(buffer_.size_));
+            header += sizeof(buffer_.size_);
+            std::memcpy(header, &buffer_.data_size_,
+                sizeof(buffer_.data_size_));
+            header += sizeof(buffer_.data_size_);
 
             // add chunk description
-            buffers.push_back(boost::asio::buffer(&buffer_.num_chunks_,
-                sizeof(buffer_.num_chunks_)));
+            std::memcpy(header, &buffer_.num_chunks_,
+                sizeof(buffer_.num_chunks_));
+            buffers_.push_back(boost::asio::buffer(header_, sizeof(header_)));
 
             std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
                 buffer_.transmission_chunks_;
             if (!chunks.empty()) {
-                buffers.push_back(
+                buffers_.push_back(
                     boost::asio::buffer(chunks.data(), chunks.size() *
                         sizeof(parcel_buffer_type::transmission_chunk_type)));
 
                 // add main buffer holding data which was serialized normally
-                buffers.push_back(boost::asio::buffer(buffer_.data_));
+                buffers_.push_back(boost::asio::buffer(buffer_.data_));
 
-                // now add chunks themselves, those hold zero-copy serialized chunks
-                for (serialization::serialization_chunk& c : buffer_.chunks_)
-                {
-                    if (c.type_ == serialization::chunk_type_pointer)
-                        buffers.push_back(boost::asio::buffer(c.data_.cpos_, c.size_));
-                }
+                // now add chunks themselves, those hold zero-copy serialized
+                // chunks
+                add_zero_copy_chunks();
             }
             else {
                 // add main buffer holding data which was serialized normally
-                buffers.push_back(boost::asio::buffer(buffer_.data_));
+                buffers_.push_back(boost::asio::buffer(buffer_.data_));
             }
 
             // this additional wrapping of the handler into a bind object is
@@ -171,11 +180,65 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             using util::placeholders::_1;
             using util::placeholders::_2;
-            boost::asio::async_write(socket_, buffers,
+            boost::asio::async_write(socket_, buffers_,
                 util::bind(f, shared_from_this(), _1, _2));
         }
 
     private:
+        // Add the zero-copy chunks to the list of buffers to send. Runs of
+        // consecutive chunks smaller than the inline threshold are copied
+        // into a staging buffer and are sent as a single buffer. This keeps
+        // the number of buffers (and with it the number of system calls
+        // needed to send the message) small, while the stream of bytes is
+        // the same as if all chunks were sent separately.
+        void add_zero_copy_chunks()
+        {
+            std::size_t inline_size = 0;
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type_pointer &&
+                    c.size_ < inline_chunk_threshold_)
+                {
+                    inline_size += c.size_;
+                }
+            }
+
+            // the staging buffer must not be reallocated while being filled
+            inline_chunks_.resize(inline_size);
+
+            char* inline_data = inline_chunks_.data();
+            char* run_begin = nullptr;
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ != serialization::chunk_type_pointer)
+                    continue;
+
+                if (c.size_ < inline_chunk_threshold_)
+                {
+                    if (run_begin == nullptr)
+                        run_begin = inline_data;
+
+                    std::memcpy(inline_data, c.data_.cpos_, c.size_);
+                    inline_data += c.size_;
+                    continue;
+                }
+
+                if (run_begin != nullptr)
+                {
+                    buffers_.push_back(boost::asio::buffer(
+                        run_begin, std::size_t(inline_data - run_begin)));
+                    run_begin = nullptr;
+                }
+                buffers_.push_back(boost::asio::buffer(c.data_.cpos_, c.size_));
+            }
+
+            if (run_begin != nullptr)
+            {
+                buffers_.push_back(boost::asio::buffer(
+                    run_begin, std::size_t(inline_data - run_begin)));
+            }
+        }
+
         static void reset_handler(postprocess_handler_type handler)
         {
             handler.reset();
@@ -249,7 +312,12 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             state_ = state_handle_read_ack;
 #endif
+            // give the memory of the send buffer back to the buffer pool, it
+            // can be reused by any other connection
             buffer_.clear();
+            pooled_buffer_type().swap(buffer_.data_);
+            pooled_buffer_type().swap(inline_chunks_);
+
             // Call post-processing handler, which will send remaining pending
             // parcels. Pass along the connection so it can be reused if more
             // parcels have to be sent.
@@ -276,6 +344,17 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         util::high_resolution_timer timer_;
         parcelset::parcelport* pp_;
 
+        /// Zero-copy chunks smaller than this are copied before sending
+        std::size_t inline_chunk_threshold_;
+
+        /// The sequence of buffers handed to the gather-write operation, and
+        /// the storage for the message header and for inlined chunks. These
+        /// have to stay alive until the write operation has completed.
+        std::vector<boost::asio::const_buffer> buffers_;
+        char header_[sizeof(std::uint64_t) + sizeof(std::uint64_t) +
+            sizeof(parcel_buffer_type::count_chunks_type)];
+        pooled_buffer_type inline_chunks_;
+
         postprocess_handler_type handler_;
         util::unique_function_nonser<
             void(
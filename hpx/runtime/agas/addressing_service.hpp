@@ -78,13 +78,17 @@ public:
       , gva
       , hpx::util::cache::statistics::local_full_statistics
     > gva_cache_type;
+
+    // The cache is split into independently locked shards, lookups for
+    // different GIDs will usually not contend on the same lock.
+    struct gva_cache_shard;
     // }}}
 
     typedef std::set<naming::gid_type> migrated_objects_table_type;
     typedef std::map<naming::gid_type, std::int64_t> refcnt_requests_type;
 
-    mutable mutex_type gva_cache_mtx_;
-    std::shared_ptr<gva_cache_type> gva_cache_;
+    std::size_t gva_cache_shard_count_;    // always a power of two
+    std::unique_ptr<gva_cache_shard[]> gva_cache_shards_;
 
     mutable mutex_type migrated_objects_mtx_;
     migrated_objects_table_type migrated_objects_table_;
@@ -128,15 +132,7 @@ public:
       , runtime_mode runtime_type_
         );
 
-#if defined(HPX_HAVE_NETWORKING)
-    ~addressing_service()
-    {
-        // TODO: Free the future pools?
-        destroy_big_boot_barrier();
-    }
-#else
-    ~addressing_service() = default;
-#endif
+    ~addressing_service();
 
 #if defined(HPX_HAVE_NETWORKING)
     void bootstrap(
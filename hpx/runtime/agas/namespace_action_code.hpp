@@ -77,6 +77,7 @@ namespace detail
         counter_target_invalid = -1
       , counter_target_count = 0
       , counter_target_time = 1
+      , counter_target_contention = 2
     };
 
     struct counter_service_data
@@ -262,6 +263,13 @@ namespace detail
           , counter_target_time
           , primary_ns_statistics_counter
           , primary_ns_statistics_counter }
+        // counter exposing the number of contended lock acquisitions of the
+        // partitions of the primary namespace tables
+      , {   "primary/contention"
+          , ""
+          , counter_target_contention
+          , primary_ns_statistics_counter
+          , primary_ns_statistics_counter }
         // counters exposing API invocation counts
       , {   "count/route"
           , ""
@@ -16,6 +16,7 @@
 #include <hpx/actions/transfer_continuation_action.hpp>
 #include <hpx/actions_base/component_action.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/lcos/base_lco_with_value.hpp>
 #include <hpx/runtime/agas/gva.hpp>
@@ -27,6 +28,7 @@
 #include <hpx/traits/action_message_handler.hpp>
 #include <hpx/traits/action_serialization_filter.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -130,22 +132,60 @@ struct HPX_EXPORT primary_namespace
         resolved_type;
     // }}}
 
-  private:
-    // REVIEW: Separate mutexes might reduce contention here. This has to be
-    // investigated carefully.
-    mutex_type mutex_;
+    // The GVA, reference count and migration tables are partitioned by GID
+    // range, each partition is protected by its own lock. GIDs are assigned
+    // to the partitions in blocks of 2^partition_block_bits consecutive ids.
+    // Bindings crossing a block boundary are stored in a separate table which
+    // is consulted only if it is not empty. The lock of that table may be
+    // acquired while holding a partition lock, never the other way around.
+    static constexpr std::size_t num_partitions = 16;
+    static constexpr std::size_t partition_block_bits = 6;
 
-    gva_table_type gvas_;
-    refcnt_table_type refcnts_;
+  private:
     typedef std::map<
             naming::gid_type,
             hpx::util::tuple<bool, std::size_t, lcos::local::detail::condition_variable>
         > migration_table_type;
 
+    struct partition
+    {
+        partition()
+          : contention_(0)
+        {}
+
+        mutex_type mutex_;
+
+        gva_table_type gvas_;
+        refcnt_table_type refcnts_;
+        migration_table_type migrating_objects_;
+
+        // number of lock acquisitions which had to wait for another thread
+        std::atomic<std::int64_t> contention_;
+    };
+
+    std::array<util::cache_aligned_data_derived<partition>, num_partitions>
+        partitions_;
+
+    mutex_type spanning_mutex_;
+    gva_table_type spanning_gvas_;
+    std::atomic<std::size_t> num_spanning_gvas_;
+
     std::string instance_name_;
     naming::gid_type next_id_;      // next available gid
     naming::gid_type locality_;     // our locality id
-    migration_table_type migrating_objects_;
+
+    static std::size_t get_partition_index(naming::gid_type const& id);
+
+    partition& get_partition(naming::gid_type const& id)
+    {
+        return partitions_[get_partition_index(id)];
+    }
+
+    // acquire the lock of the given partition, counting contended attempts
+    static std::unique_lock<mutex_type> lock_partition(partition& p);
+
+    // return whether the given range of GIDs crosses a partition block
+    static bool is_spanning(naming::gid_type const& id, std::uint64_t count);
 
     struct update_time_on_exit;
 
@@ -227,7 +267,8 @@ struct HPX_EXPORT primary_namespace
     /// Dump the credit counts of all matching ranges. Expects that \p l
     /// is locked.
     void dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
+        refcnt_table_type& refcnts
+      , refcnt_table_type::iterator lower_it
       , refcnt_table_type::iterator upper_it
       , naming::gid_type const& lower
       , naming::gid_type const& upper
@@ -237,13 +278,16 @@ struct HPX_EXPORT primary_namespace
 #endif
 
     // helper function
-    void wait_for_migration_locked(std::unique_lock<mutex_type>& l,
-        naming::gid_type const& id, error_code& ec);
+    void wait_for_migration_locked(partition& p,
+        std::unique_lock<mutex_type>& l, naming::gid_type const& id,
+        error_code& ec);
 
 public:
     primary_namespace()
       : base_type(HPX_AGAS_PRIMARY_NS_MSB, HPX_AGAS_PRIMARY_NS_LSB)
-      , mutex_()
+      , partitions_()
+      , spanning_mutex_()
+      , num_spanning_gvas_(0)
       , instance_name_()
       , next_id_(naming::invalid_gid)
       , locality_(naming::invalid_gid)
@@ -306,13 +350,26 @@ public:
 
     naming::gid_type statistics_counter(std::string const& name);
 
+    // number of contended lock acquisitions of the given partition, or of
+    // all partitions if the index is equal to num_partitions
+    std::int64_t get_contention_count(std::size_t partition, bool reset);
+
   private:
     resolved_type resolve_gid_locked(
-        std::unique_lock<mutex_type>& l
+        partition& p
+      , std::unique_lock<mutex_type>& l
       , naming::gid_type const& gid
       , error_code& ec
         );
 
+    // find the binding in the table of bindings crossing a partition block
+    // which contains the given id
+    bool resolve_spanning_gid(
+        naming::gid_type const& id
+      , naming::gid_type& base
+      , gva_table_data_type& data
+        );
+
     void increment(
         naming::gid_type const& lower
       , naming::gid_type const& upper
@@ -338,7 +395,8 @@ public:
         std::list<free_entry, free_entry_allocator_type>;
 
     void resolve_free_list(
-        std::unique_lock<mutex_type>& l
+        partition& p
+      , std::unique_lock<mutex_type>& l
       , std::list<refcnt_table_type::iterator> const& free_list
       , free_entry_list_type& free_entry_list
       , naming::gid_type const& lower
@@ -346,8 +404,12 @@ public:
       , error_code& ec
         );
 
-    void decrement_sweep(
-        free_entry_list_type& free_list
+    // apply a decrement to the ids [lower, upper) which all belong to the
+    // given (locked) partition
+    void decrement_sweep_locked(
+        partition& p
+      , std::unique_lock<mutex_type>& l
+      , free_entry_list_type& free_list
       , naming::gid_type const& lower
       , naming::gid_type const& upper
       , std::int64_t credits
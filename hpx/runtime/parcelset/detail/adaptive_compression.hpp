@@ -0,0 +1,121 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace serialization {
+    struct binary_filter;
+}}    // namespace hpx::serialization
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    // Decides for each outgoing message whether it should be compressed
+    // using the configured binary filter (see hpx.parcel.compression).
+    //
+    // For every destination locality the compression ratio and the encoding
+    // cost (per byte, with and without compression) are tracked as moving
+    // averages. A message is compressed if it is large enough and if the
+    // time saved on the wire, estimated from the link throughput, exceeds the
+    // additional encoding time. Every sample_interval'th eligible message
+    // takes the other path to keep the measurements current.
+    class HPX_EXPORT adaptive_compression
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+    public:
+        adaptive_compression(std::string const& filter_type,
+            std::size_t min_size, std::size_t sample_interval);
+
+        bool enabled() const
+        {
+            return !filter_type_.empty();
+        }
+
+        // messages smaller than the configured minimal size are never
+        // compressed
+        bool is_eligible(std::size_t size) const
+        {
+            return enabled() && size >= min_size_;
+        }
+
+        // Return the filter to use for a message of the given (estimated)
+        // size to the given locality or nullptr if the message should not be
+        // compressed. The link throughput is given in bytes per nanosecond,
+        // zero if unknown. The caller is responsible for deleting the
+        // returned filter.
+        serialization::binary_filter* create_filter(std::uint32_t locality_id,
+            std::size_t size, double link_throughput);
+
+        // Update the measurements for the given locality with the result of
+        // encoding a message.
+        void add_sample(std::uint32_t locality_id, bool compressed,
+            std::size_t raw_bytes, std::size_t bytes, std::int64_t time);
+
+        // performance counter data
+
+        // number of messages compressed
+        std::int64_t num_compressed_messages(bool reset);
+
+        // number of bytes saved by compressing messages
+        std::int64_t total_bytes_saved(bool reset);
+
+        // the total time spent encoding compressed messages (nanoseconds)
+        std::int64_t total_compression_time(bool reset);
+
+    private:
+        struct destination_data
+        {
+            destination_data()
+              : ratio_(1.0)
+              , compressed_cost_(0.0)
+              , uncompressed_cost_(0.0)
+              , eligible_messages_(0)
+              , compressed_samples_(0)
+              , uncompressed_samples_(0)
+            {
+            }
+
+            double ratio_;                // compressed/raw size
+            double compressed_cost_;      // ns per raw byte
+            double uncompressed_cost_;    // ns per raw byte
+            std::size_t eligible_messages_;
+            std::size_t compressed_samples_;
+            std::size_t uncompressed_samples_;
+        };
+
+        bool should_compress(
+            destination_data& data, double link_throughput) const;
+
+        std::string const filter_type_;
+        std::size_t const min_size_;
+        std::size_t const sample_interval_;
+
+        mutable mutex_type mtx_;
+        std::unordered_map<std::uint32_t, destination_data> destinations_;
+
+        std::atomic<std::int64_t> num_compressed_messages_;
+        std::atomic<std::int64_t> bytes_saved_;
+        std::atomic<std::int64_t> compression_time_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -18,6 +18,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/runtime/naming/split_gid.hpp>
+#include <hpx/runtime/parcelset/detail/adaptive_compression.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
@@ -156,10 +157,6 @@ namespace hpx
                     std::unique_ptr<serialization::binary_filter> filter(
                         ps[0].get_serialization_filter());
 
-                    int archive_flags = archive_flags_;
-                    if (filter.get() != nullptr)
-                        archive_flags |= serialization::enable_compression;
-
                     // preallocate data
                     std::size_t num_chunks = 0;
                     for (/**/; parcels_sent != parcels_size; ++parcels_sent)
@@ -170,6 +167,24 @@ namespace hpx
                         num_chunks += ps[parcels_sent].num_chunks();
                     }
 
+                    // let the adaptive compression decide whether to
+                    // compress messages for which the actions don't
+                    // request a filter
+                    detail::adaptive_compression& compression =
+                        pp.get_adaptive_compression();
+                    bool const adaptive = filter.get() == nullptr &&
+                        compression.is_eligible(arg_size);
+                    if (adaptive)
+                    {
+                        filter.reset(compression.create_filter(
+                            ps[0].destination_locality_id(), arg_size,
+                            pp.get_link_throughput()));
+                    }
+
+                    int archive_flags = archive_flags_;
+                    if (filter.get() != nullptr)
+                        archive_flags |= serialization::enable_compression;
+
                     buffer.data_.reserve(arg_size);
 
                     buffer.chunks_.reserve(num_chunks);
@@ -228,6 +243,15 @@ namespace hpx
                     // store the time required for serialization
                     buffer.data_point_.serialization_time_ =
                         timer.elapsed_nanoseconds();
+
+                    if (adaptive)
+                    {
+                        compression.add_sample(
+                            ps[0].destination_locality_id(),
+                            filter.get() != nullptr, arg_size,
+                            buffer.data_.size(),
+                            buffer.data_point_.serialization_time_);
+                    }
                 }
                 catch (hpx::exception const& e) {
                     LPT_(fatal)
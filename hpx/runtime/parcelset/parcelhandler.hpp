@@ -327,6 +327,13 @@ namespace hpx { namespace parcelset
         std::int64_t get_receiving_time(
             std::string const& pp_type, bool reset) const;
 
+        // the distribution of the times of the individual sends and receives
+        // (nanoseconds)
+        void get_sending_time_histogram(std::string const& pp_type,
+            util::log_histogram& result, bool reset) const;
+        void get_receiving_time_histogram(std::string const& pp_type,
+            util::log_histogram& result, bool reset) const;
+
         // the total time it took for all sender-side serialization operations
         // (nanoseconds)
         std::int64_t get_sending_serialization_time(
@@ -359,6 +366,19 @@ namespace hpx { namespace parcelset
         std::int64_t get_buffer_allocate_time_received(
             std::string const& pp_type, bool reset) const;
 
+        // number of messages compressed by the adaptive compression
+        std::int64_t get_compressed_message_count(
+            std::string const& pp_type, bool reset) const;
+
+        // number of bytes saved by the adaptive compression
+        std::int64_t get_compression_bytes_saved(
+            std::string const& pp_type, bool reset) const;
+
+        // the total time spent encoding messages chosen for compression
+        // (nanoseconds)
+        std::int64_t get_compression_time(
+            std::string const& pp_type, bool reset) const;
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
@@ -396,6 +416,9 @@ namespace hpx { namespace parcelset
         std::int64_t get_connection_cache_statistics(std::string const& pp_type,
             parcelport::connection_cache_statistics_type stat_type, bool) const;
 
+        std::int64_t get_buffer_pool_statistics(std::string const& pp_type,
+            parcelport::buffer_pool_statistics_type stat_type, bool) const;
+
         void list_parcelports(std::ostringstream& strm) const;
         void list_parcelport(std::ostringstream& strm,
             std::string const& ppname, int priority, bool bootstrap) const;
@@ -433,6 +456,7 @@ namespace hpx { namespace parcelset
 
         void register_counter_types(std::string const& pp_type);
         void register_connection_cache_counter_types(std::string const& pp_type);
+        void register_buffer_pool_counter_types(std::string const& pp_type);
 
     private:
         int get_priority(std::string const& name) const
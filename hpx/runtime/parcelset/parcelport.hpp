@@ -21,9 +21,11 @@
 #include <hpx/performance_counters/parcels/gatherer.hpp>
 #include <hpx/async_distributed/applier_fwd.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/runtime/parcelset/detail/adaptive_compression.hpp>
 #include <hpx/runtime/parcelset/detail/per_action_data_counter.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 
 #include <atomic>
 #include <cstddef>
@@ -182,6 +184,23 @@ namespace hpx { namespace parcelset
         virtual std::int64_t get_connection_cache_statistics(
             connection_cache_statistics_type, bool reset) = 0;
 
+        /// Return the given statistic of the pool of message buffers
+        enum buffer_pool_statistics_type
+        {
+            buffer_pool_hits = 0,
+            buffer_pool_misses = 1,
+            buffer_pool_retained_bytes = 2
+        };
+
+        // retrieve performance counter value for given statistics type, the
+        // default implementation is used by parcelports not pooling their
+        // message buffers
+        virtual std::int64_t get_buffer_pool_statistics(
+            buffer_pool_statistics_type, bool /*reset*/)
+        {
+            return 0;
+        }
+
         /// Return the name of this locality
         virtual std::string get_locality_name() const = 0;
 
@@ -222,6 +241,13 @@ namespace hpx { namespace parcelset
         /// completion handler (nanoseconds)
         std::int64_t get_receiving_time(bool reset);
 
+        /// merge the distribution of the times of the individual sends and
+        /// receives (nanoseconds) into the given histogram
+        void get_sending_time_histogram(
+            util::log_histogram& result, bool reset);
+        void get_receiving_time_histogram(
+            util::log_histogram& result, bool reset);
+
         /// the total time it took for all sender-side serialization operations
         /// (nanoseconds)
         std::int64_t get_sending_serialization_time(bool reset);
@@ -247,6 +273,20 @@ namespace hpx { namespace parcelset
 
         std::int64_t get_pending_parcels_count(bool /*reset*/);
 
+        /// number of messages compressed by the adaptive compression
+        std::int64_t get_compressed_message_count(bool reset);
+
+        /// number of bytes saved by the adaptive compression
+        std::int64_t get_compression_bytes_saved(bool reset);
+
+        /// the total time spent encoding messages chosen for compression
+        /// (nanoseconds)
+        std::int64_t get_compression_time(bool reset);
+
+        /// the throughput observed for all sends so far (bytes per
+        /// nanosecond), zero if nothing was sent yet
+        double get_link_throughput();
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
@@ -325,6 +365,12 @@ namespace hpx { namespace parcelset
             return async_serialization_;
         }
 
+        /// Return the object deciding which outgoing messages to compress
+        detail::adaptive_compression& get_adaptive_compression()
+        {
+            return adaptive_compression_;
+        }
+
         // callback while bootstrap the parcel layer
         void early_pending_parcel_handler(boost::system::error_code const& ec,
             parcel const & p);
@@ -374,6 +420,9 @@ namespace hpx { namespace parcelset
         /// priority of the parcelport
         int priority_;
         std::string type_;
+
+        /// adaptive compression of outgoing messages
+        detail::adaptive_compression adaptive_compression_;
     };
 }}
 
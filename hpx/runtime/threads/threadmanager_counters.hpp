@@ -12,6 +12,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/performance_counters/counters_fwd.hpp>
 #include <hpx/modules/threadmanager.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -37,11 +38,26 @@ namespace hpx { namespace threads {
             threadpool_counter_func pool_func,
             performance_counters::counter_info const& info, error_code& ec);
 
+        typedef void (threadmanager::*threadmanager_histogram_func)(
+            util::log_histogram& result, bool reset);
+        typedef void (thread_pool_base::*threadpool_histogram_func)(
+            std::size_t num_thread, util::log_histogram& result, bool reset);
+
+        naming::gid_type locality_pool_thread_percentile_counter_creator(
+            threadmanager* tm, threadmanager_histogram_func total_func,
+            threadpool_histogram_func pool_func,
+            performance_counters::counter_info const& info, error_code& ec);
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         naming::gid_type queue_wait_time_counter_creator(threadmanager* tm,
             threadmanager_counter_func total_func,
             threadpool_counter_func pool_func,
             performance_counters::counter_info const& info, error_code& ec);
+
+        naming::gid_type queue_wait_time_percentile_counter_creator(
+            threadmanager* tm, threadmanager_histogram_func total_func,
+            threadpool_histogram_func pool_func,
+            performance_counters::counter_info const& info, error_code& ec);
 #endif
 
         naming::gid_type locality_pool_thread_no_total_counter_creator(
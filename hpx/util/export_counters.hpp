@@ -0,0 +1,86 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counters_fwd.hpp>
+#include <hpx/performance_counters/shared_memory_segment.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/synchronization/mutex.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace performance_counters { namespace server {
+    class base_performance_counter;
+}}}    // namespace hpx::performance_counters::server
+
+namespace hpx { namespace util {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Periodically publishes the values of the local counters matching the
+    /// given names into a shared memory segment (see
+    /// hpx/performance_counters/shared_memory_segment.hpp). The counters are
+    /// resolved once at startup and are queried directly afterwards, without
+    /// invoking any actions, which allows for external tools to monitor the
+    /// application at (almost) no cost to the running program.
+    class HPX_EXPORT export_counters
+    {
+        // avoid warning about using this in member initializer list
+        export_counters* this_()
+        {
+            return this;
+        }
+
+    public:
+        export_counters(std::vector<std::string> const& names,
+            std::int64_t interval, std::string const& segment_name);
+        ~export_counters();
+
+        void start();
+        void stop();
+        bool evaluate();
+        void terminate();
+
+        std::string const& segment_name() const
+        {
+            return segment_name_;
+        }
+
+    protected:
+        void find_counters();
+        bool find_counter(performance_counters::counter_info const& info,
+            error_code& ec);
+
+        void create_segment();
+        void remove_segment();
+
+    private:
+        typedef lcos::local::mutex mutex_type;
+        mutex_type mtx_;
+
+        std::vector<std::string> names_;
+        std::string segment_name_;
+
+        std::vector<performance_counters::counter_info> infos_;
+        std::vector<std::shared_ptr<
+            performance_counters::server::base_performance_counter>>
+            counters_;
+
+        performance_counters::shared_memory::segment_header* segment_;
+        std::size_t segment_size_;
+
+        interval_timer timer_;
+    };
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -16,7 +16,9 @@
 
 #include <hpx/preprocessor/cat.hpp>
 
-#if defined(HPX_HAVE_INTERNAL_ALLOCATOR)
+#if defined(HPX_HAVE_NUMA_ALLOCATOR)
+#include <hpx/allocator_support/numa_slab_allocator.hpp>
+#elif defined(HPX_HAVE_INTERNAL_ALLOCATOR)
 // this is currently used only for jemalloc and if a special API prefix is
 // used for its APIs
 #include <jemalloc/jemalloc.h>
@@ -25,7 +27,7 @@
 #include <hpx/config/warnings_prefix.hpp>
 
 namespace hpx { namespace util {
-#if defined(HPX_HAVE_INTERNAL_ALLOCATOR)
+#if defined(HPX_HAVE_NUMA_ALLOCATOR) || defined(HPX_HAVE_INTERNAL_ALLOCATOR)
     ///////////////////////////////////////////////////////////////////////////
     template <typename T = int>
     struct internal_allocator
@@ -66,13 +68,22 @@ namespace hpx { namespace util {
 
         pointer allocate(size_type n, void const* hint = nullptr)
         {
+#if defined(HPX_HAVE_NUMA_ALLOCATOR)
+            return reinterpret_cast<pointer>(
+                numa_slab::allocate(n * sizeof(T)));
+#else
             return reinterpret_cast<pointer>(
                 HPX_PP_CAT(HPX_HAVE_JEMALLOC_PREFIX, malloc)(n * sizeof(T)));
+#endif
         }
 
         void deallocate(pointer p, size_type n)
         {
+#if defined(HPX_HAVE_NUMA_ALLOCATOR)
+            numa_slab::deallocate(p, n * sizeof(T));
+#else
             HPX_PP_CAT(HPX_HAVE_JEMALLOC_PREFIX, free)(p);
+#endif
         }
 
         size_type max_size() const noexcept
@@ -0,0 +1,69 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NUMA_ALLOCATOR)
+#include <cstddef>
+#include <cstdint>
+
+// The NUMA slab allocator serves small allocations (up to max_size bytes)
+// from per-thread caches which are refilled in batches from a backing arena
+// per NUMA domain. The pages of an arena are bound to its domain. Blocks
+// freed on a thread running on a different domain are handed back to their
+// owning arena through a lock-free list which is only ever drained as a
+// whole, which avoids the ABA problem without requiring hazard pointers.
+// Larger allocations are forwarded to the system allocator.
+namespace hpx { namespace util { namespace numa_slab {
+
+    // the largest allocation size served by the slab allocator
+    constexpr std::size_t max_size = 1024;
+
+    // the largest number of NUMA domains served by separate arenas
+    constexpr std::size_t max_domains = 64;
+
+    HPX_CORE_EXPORT void* allocate(std::size_t size);
+    HPX_CORE_EXPORT void deallocate(void* p, std::size_t size) noexcept;
+
+    // Set the NUMA domain the calling thread runs on. All blocks cached by
+    // the thread are returned to the arena of its previous domain.
+    HPX_CORE_EXPORT void set_thread_numa_domain(std::size_t domain);
+    HPX_CORE_EXPORT std::size_t get_thread_numa_domain();
+
+    // The topology support is injected by the runtime as it is not
+    // available at this level. The first function is used to allocate
+    // memory bound to the given NUMA domain (nullptr on failure), the second
+    // to query the NUMA domain a memory area resides on (std::size_t(-1) if
+    // unknown). Neither function may allocate memory using this allocator.
+    using allocate_bound_function = void* (*) (std::size_t, std::size_t);
+    using get_memory_domain_function = std::size_t (*)(void const*);
+
+    HPX_CORE_EXPORT void set_topology_functions(
+        allocate_bound_function allocate_bound,
+        get_memory_domain_function get_memory_domain);
+
+    // performance counter data, the values collected by each thread are
+    // published periodically and whenever it exchanges blocks with the
+    // arenas
+
+    // number of allocations served by the slab allocator
+    HPX_CORE_EXPORT std::int64_t get_allocation_count(bool reset);
+
+    // number of allocations served with memory residing on a NUMA domain
+    // different from the one of the allocating thread
+    HPX_CORE_EXPORT std::int64_t get_remote_allocation_count(bool reset);
+
+    // ratio of remote allocations to all allocations (in 0.01%)
+    HPX_CORE_EXPORT std::int64_t get_remote_allocation_ratio(bool reset);
+
+    // number of blocks freed by a thread running on a NUMA domain different
+    // from the one owning the block
+    HPX_CORE_EXPORT std::int64_t get_remote_deallocation_count(bool reset);
+}}}    // namespace hpx::util::numa_slab
+
+#endif
@@ -0,0 +1,528 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NUMA_ALLOCATOR)
+#include <hpx/allocator_support/numa_slab_allocator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#if defined(HPX_HAVE_INTERNAL_ALLOCATOR)
+#include <hpx/preprocessor/cat.hpp>
+
+#include <jemalloc/jemalloc.h>
+#endif
+
+namespace hpx { namespace util { namespace numa_slab {
+
+    namespace {
+        ///////////////////////////////////////////////////////////////////////
+        constexpr std::size_t num_size_classes = 12;
+        constexpr std::size_t class_sizes[num_size_classes] = {
+            16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024};
+
+        // chunks are aligned to their size, which allows to find the chunk
+        // header for any block
+        constexpr std::size_t chunk_size = 64 * 1024;
+        constexpr std::size_t chunk_header_size = 64;
+        constexpr std::size_t chunks_per_region = 16;
+
+        // number of allocations after which a thread publishes its
+        // statistics
+        constexpr std::int64_t publish_interval = 1024;
+
+        constexpr std::size_t unknown_domain = std::size_t(-1);
+
+        std::size_t floor_log2(std::size_t value)
+        {
+            std::size_t result = 0;
+            while (value >>= 1)
+                ++result;
+            return result;
+        }
+
+        std::size_t size_class(std::size_t size)
+        {
+            if (size <= 64)
+                return size <= 16 ? 0 : (size - 1) / 16;
+
+            // two classes per power of two: (2^n, 1.5 * 2^n] and
+            // (1.5 * 2^n, 2^(n+1)]
+            std::size_t const log2 = floor_log2(size - 1);
+            return 4 + (log2 - 6) * 2 + (((size - 1) >> (log2 - 1)) & 1);
+        }
+
+        // the number of blocks exchanged with the arenas at once
+        std::size_t batch_size(std::size_t cls)
+        {
+            std::size_t const batch = 8192 / class_sizes[cls];
+            return batch < 8 ? 8 : (batch > 64 ? 64 : batch);
+        }
+
+        void* system_allocate(std::size_t size)
+        {
+#if defined(HPX_HAVE_INTERNAL_ALLOCATOR)
+            return HPX_PP_CAT(HPX_HAVE_JEMALLOC_PREFIX, malloc)(size);
+#else
+            return std::malloc(size);
+#endif
+        }
+
+        void system_deallocate(void* p)
+        {
+#if defined(HPX_HAVE_INTERNAL_ALLOCATOR)
+            HPX_PP_CAT(HPX_HAVE_JEMALLOC_PREFIX, free)(p);
+#else
+            std::free(p);
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // All of the data below has static storage duration and trivial
+        // constructors and destructors. It is zero-initialized before any
+        // dynamic initialization happens, which allows to allocate memory
+        // during static initialization and destruction.
+        struct spinlock
+        {
+            void lock()
+            {
+                while (locked_.exchange(true, std::memory_order_acquire))
+                {
+                    while (locked_.load(std::memory_order_relaxed))
+                        std::this_thread::yield();
+                }
+            }
+
+            void unlock()
+            {
+                locked_.store(false, std::memory_order_release);
+            }
+
+            std::atomic<bool> locked_;
+        };
+
+        struct free_block
+        {
+            free_block* next_;
+        };
+
+        struct chunk_header
+        {
+            std::size_t arena_;            // index of the owning arena
+            std::size_t memory_domain_;    // where the pages reside
+        };
+
+        chunk_header* get_chunk(void const* p)
+        {
+            return reinterpret_cast<chunk_header*>(
+                reinterpret_cast<std::uintptr_t>(p) & ~(chunk_size - 1));
+        }
+
+        // The memory is never returned to the system, the blocks may still
+        // be in use while static objects are being destroyed.
+        struct arena
+        {
+            spinlock mtx_;
+            free_block* free_[num_size_classes];
+
+            // blocks freed by threads running on other NUMA domains
+            std::atomic<free_block*> remote_[num_size_classes];
+
+            spinlock region_mtx_;
+            char* region_;
+            char* region_end_;
+        };
+
+        arena arenas[max_domains];
+
+        std::atomic<allocate_bound_function> allocate_bound_;
+        std::atomic<get_memory_domain_function> get_memory_domain_;
+
+        // statistics are collected as totals, each counter remembers the
+        // totals at its last reset
+        struct statistic
+        {
+            std::int64_t get(bool reset)
+            {
+                std::int64_t const total =
+                    total_.load(std::memory_order_relaxed);
+                return total -
+                    (reset ? last_.exchange(total) :
+                             last_.load(std::memory_order_relaxed));
+            }
+
+            std::atomic<std::int64_t> total_;
+            std::atomic<std::int64_t> last_;
+        };
+
+        statistic allocations;
+        statistic remote_allocations;
+        statistic remote_deallocations;
+
+        // the remote allocation ratio has its own reset points
+        statistic ratio_allocations;
+        statistic ratio_remote_allocations;
+
+        ///////////////////////////////////////////////////////////////////////
+        // take a new chunk from the region of the given arena, allocate a new
+        // region if needed
+        char* new_chunk(arena& a, std::size_t domain)
+        {
+            std::lock_guard<spinlock> l(a.region_mtx_);
+            if (a.region_ == a.region_end_)
+            {
+                // over-allocate to be able to align the chunks
+                std::size_t const size =
+                    chunks_per_region * chunk_size + chunk_size;
+
+                void* region = nullptr;
+                allocate_bound_function f =
+                    allocate_bound_.load(std::memory_order_acquire);
+                if (f != nullptr)
+                    region = f(size, domain);
+                if (region == nullptr)
+                    region = system_allocate(size);
+                if (region == nullptr)
+                    return nullptr;
+
+                std::uintptr_t const aligned =
+                    (reinterpret_cast<std::uintptr_t>(region) + chunk_size -
+                        1) &
+                    ~(chunk_size - 1);
+                a.region_ = reinterpret_cast<char*>(aligned);
+                a.region_end_ = a.region_ + chunks_per_region * chunk_size;
+            }
+
+            char* chunk = a.region_;
+            a.region_ += chunk_size;
+            return chunk;
+        }
+
+        // Split the given chunk into blocks of the given size class and
+        // return the number of blocks created. Writing the links touches all
+        // pages of the chunk before its NUMA domain is queried.
+        std::size_t carve_chunk(char* chunk, std::size_t arena_index,
+            std::size_t cls, std::size_t domain)
+        {
+            std::size_t const size = class_sizes[cls];
+            std::size_t const count = (chunk_size - chunk_header_size) / size;
+
+            char* p = chunk + chunk_header_size;
+            for (std::size_t i = 1; i != count; ++i, p += size)
+            {
+                reinterpret_cast<free_block*>(p)->next_ =
+                    reinterpret_cast<free_block*>(p + size);
+            }
+            reinterpret_cast<free_block*>(p)->next_ = nullptr;
+
+            chunk_header* header = reinterpret_cast<chunk_header*>(chunk);
+            header->arena_ = arena_index;
+
+            std::size_t memory_domain = unknown_domain;
+            get_memory_domain_function f =
+                get_memory_domain_.load(std::memory_order_acquire);
+            if (f != nullptr)
+                memory_domain = f(chunk);
+            header->memory_domain_ =
+                memory_domain == unknown_domain ? domain : memory_domain;
+
+            return count;
+        }
+
+        void push_remote(arena& a, std::size_t cls, free_block* b)
+        {
+            free_block* head = a.remote_[cls].load(std::memory_order_relaxed);
+            do
+            {
+                b->next_ = head;
+            } while (!a.remote_[cls].compare_exchange_weak(head, b,
+                std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct thread_cache
+        {
+            thread_cache()
+              : domain_(0)
+              , arena_(0)
+              , free_()
+              , count_()
+              , allocations_(0)
+              , remote_allocations_(0)
+              , remote_deallocations_(0)
+            {
+            }
+
+            ~thread_cache()
+            {
+                flush_all();
+            }
+
+            free_block* refill(std::size_t cls);
+            void flush(std::size_t cls, std::size_t count);
+            void flush_all();
+            void publish_statistics();
+
+            std::size_t domain_;
+            std::size_t arena_;
+
+            free_block* free_[num_size_classes];
+            std::size_t count_[num_size_classes];
+
+            std::int64_t allocations_;
+            std::int64_t remote_allocations_;
+            std::int64_t remote_deallocations_;
+        };
+
+        free_block* thread_cache::refill(std::size_t cls)
+        {
+            arena& a = arenas[arena_];
+            std::size_t const batch = batch_size(cls);
+
+            // the blocks freed remotely are always taken as a whole
+            std::size_t count = 0;
+            free_block* list =
+                a.remote_[cls].exchange(nullptr, std::memory_order_acquire);
+            if (list != nullptr)
+            {
+                for (free_block* b = list; b != nullptr; b = b->next_)
+                    ++count;
+            }
+            else
+            {
+                std::lock_guard<spinlock> l(a.mtx_);
+                free_block* last = nullptr;
+                free_block* b = a.free_[cls];
+                list = b;
+                for (/**/; b != nullptr && count != batch; b = b->next_)
+                {
+                    last = b;
+                    ++count;
+                }
+                if (last != nullptr)
+                {
+                    last->next_ = nullptr;
+                    a.free_[cls] = b;
+                }
+            }
+
+            if (count == 0)
+            {
+                char* chunk = new_chunk(a, domain_);
+                if (chunk == nullptr)
+                    return nullptr;
+
+                count = carve_chunk(chunk, arena_, cls, domain_);
+                list = reinterpret_cast<free_block*>(chunk + chunk_header_size);
+
+                // keep one batch, hand the remaining blocks to the arena
+                if (count > batch)
+                {
+                    std::size_t const size = class_sizes[cls];
+                    free_block* last = reinterpret_cast<free_block*>(
+                        chunk + chunk_header_size + (batch - 1) * size);
+                    free_block* tail = reinterpret_cast<free_block*>(
+                        chunk + chunk_header_size + (count - 1) * size);
+
+                    free_block* rest = last->next_;
+                    last->next_ = nullptr;
+                    count = batch;
+
+                    std::lock_guard<spinlock> l(a.mtx_);
+                    tail->next_ = a.free_[cls];
+                    a.free_[cls] = rest;
+                }
+            }
+
+            free_[cls] = list;
+            count_[cls] = count;
+
+            publish_statistics();
+            return list;
+        }
+
+        // return the given number of blocks to the arena of this thread
+        void thread_cache::flush(std::size_t cls, std::size_t count)
+        {
+            free_block* list = free_[cls];
+            if (list == nullptr || count == 0)
+                return;
+
+            free_block* last = list;
+            std::size_t n = 1;
+            for (/**/; n != count && last->next_ != nullptr; ++n)
+                last = last->next_;
+
+            free_[cls] = last->next_;
+            count_[cls] -= n;
+
+            arena& a = arenas[arena_];
+            {
+                std::lock_guard<spinlock> l(a.mtx_);
+                last->next_ = a.free_[cls];
+                a.free_[cls] = list;
+            }
+
+            publish_statistics();
+        }
+
+        void thread_cache::flush_all()
+        {
+            for (std::size_t cls = 0; cls != num_size_classes; ++cls)
+                flush(cls, count_[cls]);
+
+            publish_statistics();
+        }
+
+        void thread_cache::publish_statistics()
+        {
+            if (allocations_ != 0)
+            {
+                allocations.total_ += allocations_;
+                ratio_allocations.total_ += allocations_;
+                allocations_ = 0;
+            }
+            if (remote_allocations_ != 0)
+            {
+                remote_allocations.total_ += remote_allocations_;
+                ratio_remote_allocations.total_ += remote_allocations_;
+                remote_allocations_ = 0;
+            }
+            if (remote_deallocations_ != 0)
+            {
+                remote_deallocations.total_ += remote_deallocations_;
+                remote_deallocations_ = 0;
+            }
+        }
+
+        thread_cache& get_thread_cache()
+        {
+            static thread_local thread_cache cache;
+            return cache;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* allocate(std::size_t size)
+    {
+        if (size > max_size)
+        {
+            void* p = system_allocate(size);
+            if (p == nullptr)
+                throw std::bad_alloc();
+            return p;
+        }
+
+        std::size_t const cls = size_class(size);
+        thread_cache& cache = get_thread_cache();
+
+        free_block* b = cache.free_[cls];
+        if (b == nullptr)
+        {
+            b = cache.refill(cls);
+            if (b == nullptr)
+                throw std::bad_alloc();
+        }
+
+        cache.free_[cls] = b->next_;
+        --cache.count_[cls];
+
+        if (get_chunk(b)->memory_domain_ != cache.domain_)
+            ++cache.remote_allocations_;
+        if (++cache.allocations_ == publish_interval)
+            cache.publish_statistics();
+
+        return b;
+    }
+
+    void deallocate(void* p, std::size_t size) noexcept
+    {
+        if (p == nullptr)
+            return;
+
+        if (size > max_size)
+        {
+            system_deallocate(p);
+            return;
+        }
+
+        std::size_t const cls = size_class(size);
+        free_block* b = static_cast<free_block*>(p);
+        thread_cache& cache = get_thread_cache();
+
+        // blocks owned by another arena are handed back right away
+        std::size_t const arena_index = get_chunk(p)->arena_;
+        if (arena_index != cache.arena_)
+        {
+            ++cache.remote_deallocations_;
+            push_remote(arenas[arena_index], cls, b);
+            return;
+        }
+
+        b->next_ = cache.free_[cls];
+        cache.free_[cls] = b;
+
+        std::size_t const batch = batch_size(cls);
+        if (++cache.count_[cls] > 2 * batch)
+            cache.flush(cls, batch);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void set_thread_numa_domain(std::size_t domain)
+    {
+        thread_cache& cache = get_thread_cache();
+        if (cache.domain_ != domain)
+        {
+            cache.flush_all();
+            cache.domain_ = domain;
+            cache.arena_ = domain % max_domains;
+        }
+    }
+
+    std::size_t get_thread_numa_domain()
+    {
+        return get_thread_cache().domain_;
+    }
+
+    void set_topology_functions(allocate_bound_function allocate_bound,
+        get_memory_domain_function get_memory_domain)
+    {
+        allocate_bound_.store(allocate_bound, std::memory_order_release);
+        get_memory_domain_.store(get_memory_domain, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t get_allocation_count(bool reset)
+    {
+        return allocations.get(reset);
+    }
+
+    std::int64_t get_remote_allocation_count(bool reset)
+    {
+        return remote_allocations.get(reset);
+    }
+
+    std::int64_t get_remote_allocation_ratio(bool reset)
+    {
+        std::int64_t const remote = ratio_remote_allocations.get(reset);
+        std::int64_t const total = ratio_allocations.get(reset);
+        return total == 0 ? 0 : (remote * 10000) / total;
+    }
+
+    std::int64_t get_remote_deallocation_count(bool reset)
+    {
+        return remote_deallocations.get(reset);
+    }
+}}}    // namespace hpx::util::numa_slab
+
+#endif
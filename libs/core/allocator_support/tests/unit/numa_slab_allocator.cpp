@@ -0,0 +1,160 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/numa_slab_allocator.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace hpx::util;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_allocate_deallocate()
+{
+    numa_slab::set_thread_numa_domain(0);
+
+    std::size_t const sizes[] = {0, 1, 8, 16, 17, 48, 63, 64, 65, 100, 128,
+        129, 200, 256, 300, 512, 700, 1000, 1024, 1025, 4096, 100000};
+
+    for (std::size_t size : sizes)
+    {
+        std::vector<void*> blocks;
+        for (std::size_t i = 0; i != 1000; ++i)
+        {
+            void* p = numa_slab::allocate(size);
+            HPX_TEST(p != nullptr);
+            HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) % 16,
+                std::uintptr_t(0));
+
+            std::memset(p, static_cast<int>(i % 256), size);
+            blocks.push_back(p);
+        }
+
+        // blocks must not overlap
+        for (std::size_t i = 0; i != blocks.size(); ++i)
+        {
+            unsigned char const* p =
+                static_cast<unsigned char const*>(blocks[i]);
+            for (std::size_t j = 0; j != size; ++j)
+            {
+                HPX_TEST_EQ(p[j], static_cast<unsigned char>(i % 256));
+            }
+        }
+
+        for (void* p : blocks)
+        {
+            numa_slab::deallocate(p, size);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_remote_deallocation()
+{
+    std::size_t const count = 10000;
+    std::int64_t const remote_deallocations =
+        numa_slab::get_remote_deallocation_count(false);
+
+    // allocate on a thread pretending to run on domain 1, free on domain 0
+    std::vector<void*> blocks;
+    std::thread t([&]() {
+        numa_slab::set_thread_numa_domain(1);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            blocks.push_back(numa_slab::allocate(32));
+        }
+    });
+    t.join();
+
+    numa_slab::set_thread_numa_domain(0);
+    for (void* p : blocks)
+    {
+        numa_slab::deallocate(p, 32);
+    }
+
+    // the counters are published when the thread cache is flushed
+    numa_slab::set_thread_numa_domain(2);
+    numa_slab::set_thread_numa_domain(0);
+
+    HPX_TEST_EQ(numa_slab::get_remote_deallocation_count(false) -
+            remote_deallocations,
+        static_cast<std::int64_t>(count));
+
+    // the blocks are reused by the owning domain
+    std::thread t2([&]() {
+        numa_slab::set_thread_numa_domain(1);
+        std::vector<void*> reused;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            reused.push_back(numa_slab::allocate(32));
+        }
+        for (void* p : reused)
+        {
+            numa_slab::deallocate(p, 32);
+        }
+    });
+    t2.join();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_internal_allocator()
+{
+    std::vector<int, internal_allocator<int>> v;
+    for (int i = 0; i != 10000; ++i)
+    {
+        v.push_back(i);
+    }
+    for (int i = 0; i != 10000; ++i)
+    {
+        HPX_TEST_EQ(v[i], i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_counters()
+{
+    // publish the statistics collected so far
+    numa_slab::set_thread_numa_domain(1);
+    numa_slab::set_thread_numa_domain(0);
+
+    numa_slab::get_allocation_count(true);
+    numa_slab::get_remote_allocation_ratio(true);
+
+    std::vector<void*> blocks;
+    for (std::size_t i = 0; i != 5000; ++i)
+    {
+        blocks.push_back(numa_slab::allocate(64));
+    }
+    for (void* p : blocks)
+    {
+        numa_slab::deallocate(p, 64);
+    }
+
+    numa_slab::set_thread_numa_domain(1);
+    numa_slab::set_thread_numa_domain(0);
+
+    HPX_TEST_EQ(numa_slab::get_allocation_count(true), std::int64_t(5000));
+    HPX_TEST_EQ(numa_slab::get_allocation_count(false), std::int64_t(0));
+
+    std::int64_t const ratio = numa_slab::get_remote_allocation_ratio(true);
+    HPX_TEST(ratio >= 0 && ratio <= 10000);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_allocate_deallocate();
+    test_remote_deallocation();
+    test_internal_allocator();
+    test_counters();
+
+    return hpx::util::report_errors();
+}
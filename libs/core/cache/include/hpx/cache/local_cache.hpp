@@ -11,9 +11,9 @@
 #include <hpx/cache/statistics/no_statistics.hpp>
 
 #include <algorithm>
-#include <deque>
 #include <functional>
 #include <map>
+#include <set>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -69,6 +69,11 @@ namespace hpx { namespace util { namespace cache {
         // a pointer to the stored entry only. We use the \a adapt function
         // object to wrap any user supplied UpdatePolicy, dereferencing the
         // pointers.
+        //
+        // The entries are kept ordered such that the entry to be discarded
+        // first (the greatest one according to the UpdatePolicy) comes first.
+        // Entries comparing equivalent are ordered by their address, which
+        // makes every entry unique.
         template <typename Func, typename Iterator>
         struct adapt
         {
@@ -79,7 +84,11 @@ namespace hpx { namespace util { namespace cache {
 
             bool operator()(Iterator const& lhs, Iterator const& rhs) const
             {
-                return f_((*lhs).second, (*rhs).second);
+                if (f_((*rhs).second, (*lhs).second))
+                    return true;
+                if (f_((*lhs).second, (*rhs).second))
+                    return false;
+                return std::less<void const*>()(&*lhs, &*rhs);
             }
 
             Func f_;    // user supplied UpdatePolicy
@@ -101,11 +110,11 @@ namespace hpx { namespace util { namespace cache {
         typedef typename storage_type::iterator iterator;
         typedef typename storage_type::const_iterator const_iterator;
 
-        typedef std::deque<iterator> heap_type;
-        typedef typename heap_type::iterator heap_iterator;
-
         typedef adapt<UpdatePolicy, iterator> adapted_update_policy_type;
 
+        typedef std::set<iterator, adapted_update_policy_type> order_type;
+        typedef typename order_type::iterator order_iterator;
+
         typedef typename statistics_type::update_on_exit update_on_exit;
 
     public:
@@ -131,7 +140,7 @@ namespace hpx { namespace util { namespace cache {
             insert_policy_type const& ip = insert_policy_type())
           : max_size_(max_size)
           , current_size_(0)
-          , update_policy_(up)
+          , entry_order_(adapted_update_policy_type(up))
           , insert_policy_(ip)
         {
         }
@@ -140,8 +149,7 @@ namespace hpx { namespace util { namespace cache {
           : max_size_(other.max_size_)
           , current_size_(other.current_size_)
           , store_(std::move(other.store_))
-          , entry_heap_(std::move(other.entry_heap_))
-          , update_policy_(std::move(other.update_policy_.f_))
+          , entry_order_(std::move(other.entry_order_))
           , insert_policy_(std::move(other.insert_policy_))
           , statistics_(std::move(other.statistics_))
         {
@@ -242,12 +250,7 @@ namespace hpx { namespace util { namespace cache {
             }
 
             // touch the found entry
-            if ((*it).second.touch())
-            {
-                // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
-            }
+            touch_entry(it);
 
             // update statistics
             statistics_.got_hit();
@@ -285,12 +288,7 @@ namespace hpx { namespace util { namespace cache {
             }
 
             // touch the found entry
-            if ((*it).second.touch())
-            {
-                // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
-            }
+            touch_entry(it);
 
             // update statistics
             statistics_.got_hit();
@@ -327,12 +325,7 @@ namespace hpx { namespace util { namespace cache {
             }
 
             // touch the found entry
-            if ((*it).second.touch())
-            {
-                // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
-            }
+            touch_entry(it);
 
             // update statistics
             statistics_.got_hit();
@@ -418,10 +411,8 @@ namespace hpx { namespace util { namespace cache {
 
             current_size_ += entry_size;
 
-            // update the entry heap
-            entry_heap_.push_back(p.first);
-            std::push_heap(
-                entry_heap_.begin(), entry_heap_.end(), update_policy_);
+            // update the ordered list of entries
+            entry_order_.insert(p.first);
 
             // update statistics
             statistics_.got_insertion();
@@ -467,12 +458,7 @@ namespace hpx { namespace util { namespace cache {
             (*it).second.get() = val;
 
             // touch the entry
-            if ((*it).second.touch())
-            {
-                // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
-            }
+            touch_entry(it);
 
             // update statistics
             statistics_.got_hit();
@@ -526,12 +512,7 @@ namespace hpx { namespace util { namespace cache {
             (*it).second.get() = val;
 
             // touch the entry
-            if ((*it).second.touch())
-            {
-                // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
-            }
+            touch_entry(it);
 
             // update statistics
             statistics_.got_hit();
@@ -580,16 +561,14 @@ namespace hpx { namespace util { namespace cache {
             if (!insert_policy_(e) || !e.insert())
                 return false;    // entry doesn't want to be inserted
 
-            // update cache entry
+            // update cache entry, the position of the entry has to be
+            // located before it is changed
+            order_iterator pos = entry_order_.find(it);
             (*it).second = e;
 
-            // touch the entry
-            if ((*it).second.touch())
-            {
-                // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
-            }
+            // touch the entry and reorder it based on its new attributes
+            (*it).second.touch();
+            reorder_entry(pos);
 
             // update statistics
             statistics_.got_hit();
@@ -619,8 +598,8 @@ namespace hpx { namespace util { namespace cache {
             update_on_exit update(statistics_, statistics::method_erase_entry);
 
             size_type erased = 0;
-            for (heap_iterator it = entry_heap_.begin();
-                 it != entry_heap_.end();
+            for (order_iterator it = entry_order_.begin();
+                 it != entry_order_.end();
                 /**/)
             {
                 iterator sit = *it;
@@ -637,9 +616,8 @@ namespace hpx { namespace util { namespace cache {
                     current_size_ -= entry_size;
                     erased += entry_size;
 
-                    // we remove the element manually, forcing the heap to be
-                    // rebuilt at the end
-                    it = entry_heap_.erase(it);
+                    // remove the entry from the ordered list of entries
+                    it = entry_order_.erase(it);
 
                     // remove the cache entry
                     store_.erase(sit);
@@ -654,10 +632,6 @@ namespace hpx { namespace util { namespace cache {
                 }
             }
 
-            // reorder heap based on the changed entry list
-            std::make_heap(
-                entry_heap_.begin(), entry_heap_.end(), update_policy_);
-
             return erased;
         }
 
@@ -686,7 +660,7 @@ namespace hpx { namespace util { namespace cache {
         void clear()
         {
             store_.clear();
-            entry_heap_.clear();
+            entry_order_.clear();
             statistics_.clear();
             current_size_ = 0;
         }
@@ -711,12 +685,12 @@ namespace hpx { namespace util { namespace cache {
         // Free some space in the cache
         bool free_space(long num_free)
         {
-            if (entry_heap_.empty())
+            if (entry_order_.empty())
                 return false;
 
-            bool is_heap = true;
-            for (heap_iterator it = entry_heap_.begin();
-                 num_free > 0 && it != entry_heap_.end();
+            // the entries to be discarded first are at the front
+            for (order_iterator it = entry_order_.begin();
+                 num_free > 0 && it != entry_order_.end();
                 /**/)
             {
                 iterator sit = *it;
@@ -726,24 +700,10 @@ namespace hpx { namespace util { namespace cache {
                 }
                 else
                 {
-                    size_type entry_size = (*(*it)).second.get_size();
+                    size_type entry_size = (*sit).second.get_size();
 
-                    if (it == entry_heap_.begin())
-                    {
-                        // if we're at the top of the list, just pop the item
-                        // this doesn't disturb the heap property of the heap
-                        ++it;
-                        std::pop_heap(entry_heap_.begin(), entry_heap_.end(),
-                            update_policy_);
-                        entry_heap_.pop_back();
-                    }
-                    else
-                    {
-                        // otherwise we remove the element manually, forcing
-                        // the heap to be rebuilt at the end
-                        it = entry_heap_.erase(it);
-                        is_heap = false;
-                    }
+                    // remove the entry from the ordered list of entries
+                    it = entry_order_.erase(it);
 
                     // remove the cache entry
                     store_.erase(sit);
@@ -755,14 +715,33 @@ namespace hpx { namespace util { namespace cache {
                 }
             }
 
-            // reorder heap based on the changed entry list
-            if (!is_heap)
+            return num_free <= 0;
+        }
+
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        // Touch the given entry and move it to the position corresponding to
+        // its changed attributes, if needed.
+        void touch_entry(iterator it)
+        {
+            // the position has to be located before the entry is changed
+            order_iterator pos = entry_order_.find(it);
+            if ((*it).second.touch())
             {
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                // reorder entries based on the changed entry attributes
+                reorder_entry(pos);
             }
+        }
 
-            return num_free <= 0;
+        // Move the entry at the given position to the position corresponding
+        // to its (changed) attributes. Erasing an element from the ordered
+        // list does not invoke the UpdatePolicy, thus the attributes of the
+        // entry may have been changed already.
+        void reorder_entry(order_iterator pos)
+        {
+            iterator it = *pos;
+            entry_order_.erase(pos);
+            entry_order_.insert(it);
         }
 
     private:
@@ -770,11 +749,11 @@ namespace hpx { namespace util { namespace cache {
         size_type current_size_;    // current cache size
         storage_type store_;        // the cache itself
 
-        // we store a list of pointers to the held keys in a std::heap which
-        // is being sorted based on the criteria defined by the UpdatePolicy
-        heap_type entry_heap_;
+        // we store a list of pointers to the held keys in a std::set which
+        // is being sorted based on the criteria defined by the UpdatePolicy,
+        // this makes touching, inserting, and evicting entries O(log n)
+        order_type entry_order_;
 
-        adapted_update_policy_type update_policy_;
         insert_policy_type insert_policy_;
 
         statistics_type statistics_;    // embedded statistics instance
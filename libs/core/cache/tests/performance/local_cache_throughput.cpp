@@ -0,0 +1,122 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of cache hits, cache misses, and
+// insertions causing evictions for local_cache instances holding a large
+// number of entries.
+
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/cache/entries/lfu_entry.hpp>
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry>
+void run_benchmark(char const* name, std::size_t cache_size,
+    std::size_t num_operations, unsigned int seed)
+{
+    typedef hpx::util::cache::local_cache<std::uint64_t, Entry> cache_type;
+
+    cache_type c(cache_size);
+    for (std::size_t i = 0; i != cache_size; ++i)
+        c.insert(i, i);
+
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> dist(0, cache_size - 1);
+
+    std::vector<std::uint64_t> keys(num_operations);
+    for (std::uint64_t& key : keys)
+        key = dist(gen);
+
+    std::uint64_t value = 0;
+
+    // all lookups hit the cache, each of them touches the found entry
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+    for (std::uint64_t key : keys)
+        c.get_entry(key, value);
+    double hit_time =
+        static_cast<double>(hpx::util::high_resolution_clock::now() - start) /
+        1e9;
+
+    // all lookups miss the cache
+    start = hpx::util::high_resolution_clock::now();
+    for (std::uint64_t key : keys)
+        c.get_entry(key + cache_size, value);
+    double miss_time =
+        static_cast<double>(hpx::util::high_resolution_clock::now() - start) /
+        1e9;
+
+    // all insertions evict an entry from the (full) cache
+    start = hpx::util::high_resolution_clock::now();
+    for (std::size_t i = 0; i != num_operations; ++i)
+        c.insert(cache_size + i, i);
+    double evict_time =
+        static_cast<double>(hpx::util::high_resolution_clock::now() - start) /
+        1e9;
+
+    std::cout << name << " (" << cache_size << " entries):\n"
+              << "  hit throughput:      " << (num_operations / hit_time)
+              << " [op/s]\n"
+              << "  miss throughput:     " << (num_operations / miss_time)
+              << " [op/s]\n"
+              << "  eviction throughput: " << (num_operations / evict_time)
+              << " [op/s]\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t cache_size = vm["cache_size"].as<std::size_t>();
+    std::size_t num_operations = vm["num_operations"].as<std::size_t>();
+
+    std::cout << "seed: " << seed << std::endl;
+
+    using hpx::util::cache::entries::lfu_entry;
+    using hpx::util::cache::entries::lru_entry;
+
+    run_benchmark<lru_entry<std::uint64_t>>(
+        "lru_entry", cache_size, num_operations, seed);
+    run_benchmark<lfu_entry<std::uint64_t>>(
+        "lfu_entry", cache_size, num_operations, seed);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("cache_size", value<std::size_t>()->default_value(100000),
+         "number of entries held in the cache (default: 100000)")
+        ("num_operations", value<std::size_t>()->default_value(1000000),
+         "number of operations to measure (default: 1000000)")
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    return hpx::init(desc_commandline, argc, argv);
+}
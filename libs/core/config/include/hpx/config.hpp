@@ -112,6 +112,33 @@
 #  define HPX_PARCEL_MPI_MAX_REQUESTS 2147483647
 #endif
 
+/// This defines the maximal amount of memory (in bytes) kept by the TCP
+/// parcelport for reusing it as message buffers. This value can be changed at
+/// runtime by setting the configuration parameter:
+///
+///   hpx.parcel.tcp.buffer_pool_size = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_TCP_BUFFER_POOL_SIZE).
+#if !defined(HPX_PARCEL_TCP_BUFFER_POOL_SIZE)
+#  define HPX_PARCEL_TCP_BUFFER_POOL_SIZE 67108864
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the size (in bytes) below which zero-copy chunks are copied
+/// into a contiguous staging buffer by the TCP parcelport before being sent,
+/// which reduces the number of buffers handed to a single vectored write.
+/// This value can be changed at runtime by setting the configuration
+/// parameter:
+///
+///   hpx.parcel.tcp.inline_chunk_threshold = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_TCP_INLINE_CHUNK_THRESHOLD).
+#if !defined(HPX_PARCEL_TCP_INLINE_CHUNK_THRESHOLD)
+#  define HPX_PARCEL_TCP_INLINE_CHUNK_THRESHOLD 1024
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the number of outgoing (parcel-) connections kept alive (to
 /// each of the other localities). This value can be changed at runtime by
@@ -399,6 +426,13 @@
 #  define HPX_THREAD_QUEUE_MAX_THREAD_COUNT 1000
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of terminated thread objects (per stack size) each thread
+// queue keeps for reuse. Thread objects exceeding this number are destroyed.
+#if !defined(HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE)
+#  define HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE 1024
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Minimum number of pending tasks required to steal tasks.
 #if !defined(HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_PENDING)
@@ -46,6 +46,7 @@
  */
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -73,12 +74,30 @@
 namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         HPX_CORE_EXPORT extern bool use_guard_pages;
+        HPX_CORE_EXPORT extern bool use_stack_pool;
+
+        // Return the overall amount of address space reserved by the stack
+        // pool and the amount of it which is currently backed by physical
+        // memory (in bytes).
+        HPX_CORE_EXPORT std::uint64_t get_stack_pool_reserved_memory(
+            bool reset = false);
+        HPX_CORE_EXPORT std::uint64_t get_stack_pool_resident_memory(
+            bool reset = false);
 
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
+        // The stack pool carves many stacks (including their guard pages) out
+        // of one large mapping and keeps released stacks for reuse instead of
+        // unmapping them, see posix_utility.cpp.
+        HPX_CORE_EXPORT void* alloc_pooled_stack(std::size_t size);
+        HPX_CORE_EXPORT bool free_pooled_stack(void* stack, std::size_t size);
+
         inline void* alloc_stack(std::size_t size)
         {
+            if (use_stack_pool)
+                return alloc_pooled_stack(size);
+
             void* real_stack = ::mmap(nullptr, size + EXEC_PAGESIZE,
                 PROT_EXEC | PROT_READ | PROT_WRITE,
 #if defined(__APPLE__)
@@ -153,6 +172,10 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 
         inline void free_stack(void* stack, std::size_t size)
         {
+            // stacks not owned by the pool are unmapped directly
+            if (use_stack_pool && free_pooled_stack(stack, size))
+                return;
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
             if (use_guard_pages)
             {
@@ -10,11 +10,304 @@
     defined(__FreeBSD__) || defined(__APPLE__)
 #include <hpx/coroutines/detail/posix_utility.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
 namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         ///////////////////////////////////////////////////////////////////////
         // this global (urghhh) variable is used to control whether guard pages
         // will be used or not
         HPX_CORE_EXPORT bool use_guard_pages = true;
+
+        // this global variable is used to control whether stacks will be
+        // allocated from the stack pool
+        HPX_CORE_EXPORT bool use_stack_pool = false;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+        namespace {
+            ///////////////////////////////////////////////////////////////////
+            // number of stacks carved out of one memory mapping
+            constexpr std::size_t stacks_per_arena = 32;
+
+            // number of released stacks per NUMA domain which may still hold
+            // resident pages before their memory is given back to the system
+            constexpr std::size_t max_dirty_stacks = 64;
+
+            // maximal number of separately managed NUMA domains
+            constexpr std::size_t max_domains = 8;
+
+            struct stack_arena
+            {
+                char* base;
+                std::size_t size;
+                std::size_t slot_size;
+                std::size_t domain;    // NUMA domain owning the stacks
+            };
+
+            struct stack_pool_domain
+            {
+                std::mutex mtx_;
+
+                // released stacks whose pages have been given back to the
+                // system, indexed by stack size
+                std::map<std::size_t, std::vector<void*>> clean_stacks_;
+
+                // released stacks which may still hold resident pages
+                std::map<std::size_t, std::vector<void*>> dirty_stacks_;
+                std::size_t dirty_count_ = 0;
+            };
+
+            struct stack_pool
+            {
+                // All arenas, keyed by their end address. Arenas are only
+                // ever added, releasing a stack needs to take a shared lock
+                // only.
+                std::shared_timed_mutex mtx_;
+                std::map<char const*, stack_arena> arenas_;
+                std::atomic<std::uint64_t> reserved_{0};
+
+                stack_pool_domain domains_[max_domains];
+            };
+
+            stack_pool& get_stack_pool()
+            {
+                // the pool is intentionally never destroyed, stacks may still
+                // be released during static destruction
+                static stack_pool* pool = new stack_pool;
+                return *pool;
+            }
+
+            std::size_t get_guard_size()
+            {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+                return use_guard_pages ? EXEC_PAGESIZE : 0;
+#else
+                return 0;
+#endif
+            }
+
+            // The NUMA domain of the calling OS-thread is determined once,
+            // HPX worker threads are usually bound to a core.
+            std::size_t get_stack_pool_domain_index()
+            {
+                static thread_local std::size_t domain = []() -> std::size_t {
+#if (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    defined(SYS_getcpu)
+                    unsigned cpu = 0, node = 0;
+                    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+                        return node % max_domains;
+#endif
+                    return 0;
+                }();
+                return domain;
+            }
+
+            // Create a new arena holding stacks of the given size, all stacks
+            // are added to the list of clean stacks of the given domain. This
+            // touches none of the pages of the stacks.
+            void create_arena(std::size_t domain, std::size_t size)
+            {
+                stack_pool& pool = get_stack_pool();
+                stack_pool_domain& d = pool.domains_[domain];
+
+                std::size_t const guard_size = get_guard_size();
+                std::size_t const slot_size = size + guard_size;
+                std::size_t const arena_size = slot_size * stacks_per_arena;
+
+                void* base = ::mmap(nullptr, arena_size,
+                    PROT_EXEC | PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                    MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                    MAP_PRIVATE | MAP_ANON,
+#else
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                    -1, 0);
+
+                if (base == MAP_FAILED)
+                {
+                    throw std::runtime_error(
+                        "mmap() failed to allocate thread stack pool arena");
+                }
+
+                std::vector<void*>& stacks = d.clean_stacks_[size];
+                char* slot = static_cast<char*>(base);
+                for (std::size_t i = 0; i != stacks_per_arena;
+                     ++i, slot += slot_size)
+                {
+                    if (guard_size != 0)
+                        ::mprotect(slot, guard_size, PROT_NONE);
+                    stacks.push_back(slot + guard_size);
+                }
+
+                {
+                    std::lock_guard<std::shared_timed_mutex> l(pool.mtx_);
+                    pool.arenas_.emplace(static_cast<char*>(base) + arena_size,
+                        stack_arena{static_cast<char*>(base), arena_size,
+                            slot_size, domain});
+                }
+                pool.reserved_ += arena_size;
+            }
+
+            // Give the pages of all dirty stacks back to the system. The
+            // stacks are sorted by address to combine neighboring stacks
+            // (and the guard pages in between) into one madvise() call.
+            void trim_dirty_stacks(
+                std::vector<std::pair<void*, std::size_t>>& stacks)
+            {
+                std::sort(stacks.begin(), stacks.end());
+
+                std::size_t const guard_size = get_guard_size();
+                auto it = stacks.begin();
+                while (it != stacks.end())
+                {
+                    char* begin = static_cast<char*>(it->first);
+                    char* end = begin + it->second;
+
+                    for (++it; it != stacks.end() &&
+                         static_cast<char*>(it->first) == end + guard_size;
+                         ++it)
+                    {
+                        end = static_cast<char*>(it->first) + it->second;
+                    }
+
+                    ::madvise(begin, end - begin, MADV_DONTNEED);
+                }
+            }
+        }    // namespace
+
+        ///////////////////////////////////////////////////////////////////////
+        void* alloc_pooled_stack(std::size_t size)
+        {
+            std::size_t const domain = get_stack_pool_domain_index();
+            stack_pool_domain& d = get_stack_pool().domains_[domain];
+
+            std::lock_guard<std::mutex> l(d.mtx_);
+
+            // prefer stacks which are still resident
+            auto dirty = d.dirty_stacks_.find(size);
+            if (dirty != d.dirty_stacks_.end() && !dirty->second.empty())
+            {
+                void* stack = dirty->second.back();
+                dirty->second.pop_back();
+                --d.dirty_count_;
+                return stack;
+            }
+
+            std::vector<void*>& clean = d.clean_stacks_[size];
+            if (clean.empty())
+                create_arena(domain, size);
+
+            void* stack = clean.back();
+            clean.pop_back();
+            return stack;
+        }
+
+        bool free_pooled_stack(void* stack, std::size_t size)
+        {
+            stack_pool& pool = get_stack_pool();
+            std::size_t domain = 0;
+            {
+                // verify that the stack was allocated from the pool, the
+                // first arena ending after the stack is the only candidate
+                char const* p = static_cast<char const*>(stack);
+
+                std::shared_lock<std::shared_timed_mutex> l(pool.mtx_);
+                auto it = pool.arenas_.upper_bound(p);
+                if (it == pool.arenas_.end() || p < it->second.base)
+                    return false;
+
+                HPX_ASSERT(it->second.slot_size == size + get_guard_size());
+                domain = it->second.domain;
+            }
+
+            // the stack is returned to the domain it was allocated from
+            stack_pool_domain& d = pool.domains_[domain];
+
+            std::vector<std::pair<void*, std::size_t>> to_trim;
+            {
+                std::lock_guard<std::mutex> l(d.mtx_);
+                d.dirty_stacks_[size].push_back(stack);
+                if (++d.dirty_count_ <= max_dirty_stacks)
+                    return true;
+
+                // trim all dirty stacks of this domain in one go
+                to_trim.reserve(d.dirty_count_);
+                for (auto& p : d.dirty_stacks_)
+                {
+                    for (void* s : p.second)
+                        to_trim.emplace_back(s, p.first);
+                    p.second.clear();
+                }
+                d.dirty_count_ = 0;
+            }
+
+            trim_dirty_stacks(to_trim);
+
+            std::lock_guard<std::mutex> l(d.mtx_);
+            for (auto const& p : to_trim)
+                d.clean_stacks_[p.second].push_back(p.first);
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::uint64_t get_stack_pool_reserved_memory(bool)
+        {
+            return get_stack_pool().reserved_.load(std::memory_order_relaxed);
+        }
+
+        std::uint64_t get_stack_pool_resident_memory(bool)
+        {
+            stack_pool& pool = get_stack_pool();
+
+            std::uint64_t resident_pages = 0;
+            std::size_t const page_size = EXEC_PAGESIZE;
+
+            std::shared_lock<std::shared_timed_mutex> l(pool.mtx_);
+            for (auto const& entry : pool.arenas_)
+            {
+                stack_arena const& a = entry.second;
+#if defined(__linux) || defined(linux) || defined(__linux__)
+                std::vector<unsigned char> pages(a.size / page_size);
+#else
+                std::vector<char> pages(a.size / page_size);
+#endif
+                if (::mincore(a.base, a.size, pages.data()) != 0)
+                    continue;
+
+                for (auto p : pages)
+                {
+                    if (p & 0x1)
+                        ++resident_pages;
+                }
+            }
+            return resident_pages * page_size;
+        }
+#else
+        std::uint64_t get_stack_pool_reserved_memory(bool)
+        {
+            return 0;
+        }
+
+        std::uint64_t get_stack_pool_resident_memory(bool)
+        {
+            return 0;
+        }
+#endif
 }}}}}    // namespace hpx::threads::coroutines::detail::posix
 #endif
@@ -1022,6 +1022,90 @@ namespace hpx { namespace threads { namespace policies {
 
             return wait_time / (count + 1);
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Merges the distribution of thread wait times of the queues into the
+        // given histogram.
+        void get_thread_wait_time_histogram(std::size_t num_thread,
+            util::log_histogram& result, bool reset) override
+        {
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < num_queues_);
+
+                if (num_thread < num_high_priority_queues_)
+                {
+                    high_priority_queues_[num_thread]
+                        .data_->get_thread_wait_time_histogram(result, reset);
+                }
+
+                if (num_queues_ - 1 == num_thread)
+                {
+                    low_priority_queue_.get_thread_wait_time_histogram(
+                        result, reset);
+                }
+
+                queues_[num_thread].data_->get_thread_wait_time_histogram(
+                    result, reset);
+                return;
+            }
+
+            for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+            {
+                high_priority_queues_[i].data_->get_thread_wait_time_histogram(
+                    result, reset);
+            }
+
+            low_priority_queue_.get_thread_wait_time_histogram(result, reset);
+
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                queues_[i].data_->get_thread_wait_time_histogram(
+                    result, reset);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Merges the distribution of task wait times of the queues into the
+        // given histogram.
+        void get_task_wait_time_histogram(std::size_t num_thread,
+            util::log_histogram& result, bool reset) override
+        {
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < num_queues_);
+
+                if (num_thread < num_high_priority_queues_)
+                {
+                    high_priority_queues_[num_thread]
+                        .data_->get_task_wait_time_histogram(result, reset);
+                }
+
+                if (num_queues_ - 1 == num_thread)
+                {
+                    low_priority_queue_.get_task_wait_time_histogram(
+                        result, reset);
+                }
+
+                queues_[num_thread].data_->get_task_wait_time_histogram(
+                    result, reset);
+                return;
+            }
+
+            for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+            {
+                high_priority_queues_[i].data_->get_task_wait_time_histogram(
+                    result, reset);
+            }
+
+            low_priority_queue_.get_task_wait_time_histogram(result, reset);
+
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                queues_[i].data_->get_task_wait_time_histogram(
+                    result, reset);
+            }
+        }
 #endif
 
         /// This is a function which gets called periodically by the thread
@@ -677,6 +677,48 @@ namespace hpx { namespace threads { namespace policies {
 
             return wait_time / (count + 1);
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Merges the distribution of thread wait times of the queues into the
+        // given histogram.
+        void get_thread_wait_time_histogram(std::size_t num_thread,
+            util::log_histogram& result, bool reset) override
+        {
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < queues_.size());
+
+                queues_[num_thread]->get_thread_wait_time_histogram(
+                    result, reset);
+                return;
+            }
+
+            for (std::size_t i = 0; i != queues_.size(); ++i)
+            {
+                queues_[i]->get_thread_wait_time_histogram(result, reset);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Merges the distribution of task wait times of the queues into the
+        // given histogram.
+        void get_task_wait_time_histogram(std::size_t num_thread,
+            util::log_histogram& result, bool reset) override
+        {
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < queues_.size());
+
+                queues_[num_thread]->get_task_wait_time_histogram(
+                    result, reset);
+                return;
+            }
+
+            for (std::size_t i = 0; i != queues_.size(); ++i)
+            {
+                queues_[i]->get_task_wait_time_histogram(result, reset);
+            }
+        }
 #endif
 
         /// This is a function which gets called periodically by the thread
@@ -19,6 +19,7 @@
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -32,12 +33,14 @@
 #include <hpx/timing/tick_counter.hpp>
 #endif
 
+#include <boost/lockfree/policies.hpp>
+#include <boost/lockfree/stack.hpp>
+
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
-#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -93,8 +96,12 @@ namespace hpx { namespace threads { namespace policies {
             std::hash<thread_id_type>, std::equal_to<thread_id_type>,
             util::internal_allocator<thread_id_type>>;
 
-        using thread_heap_type =
-            std::list<thread_id_type, util::internal_allocator<thread_id_type>>;
+        // Terminated thread objects are kept for reuse in a bounded lock-free
+        // stack per stack size. The nodes of the stacks are preallocated,
+        // recycling a thread object does not allocate memory and does not
+        // require holding the queue mutex.
+        using thread_heap_type = boost::lockfree::stack<thread_data*,
+            boost::lockfree::fixed_sized<true>>;
 
         struct task_description
         {
@@ -124,37 +131,38 @@ namespace hpx { namespace threads { namespace policies {
             typename TerminatedQueuing::template apply<thread_data*>::type;
 
     protected:
-        template <typename Lock>
-        void create_thread_object(threads::thread_id_type& thrd,
-            threads::thread_init_data& data, Lock& lk)
+        thread_heap_type* get_thread_heap(std::ptrdiff_t stacksize)
         {
-            HPX_ASSERT(lk.owns_lock());
-
-            std::ptrdiff_t const stacksize =
-                data.scheduler_base->get_stack_size(data.stacksize);
-
-            thread_heap_type* heap = nullptr;
-
             if (stacksize == parameters_.small_stacksize_)
             {
-                heap = &thread_heap_small_;
+                return &thread_heap_small_;
             }
             else if (stacksize == parameters_.medium_stacksize_)
             {
-                heap = &thread_heap_medium_;
+                return &thread_heap_medium_;
             }
             else if (stacksize == parameters_.large_stacksize_)
             {
-                heap = &thread_heap_large_;
+                return &thread_heap_large_;
             }
             else if (stacksize == parameters_.huge_stacksize_)
             {
-                heap = &thread_heap_huge_;
+                return &thread_heap_huge_;
             }
             else if (stacksize == parameters_.nostack_stacksize_)
             {
-                heap = &thread_heap_nostack_;
+                return &thread_heap_nostack_;
             }
+            return nullptr;
+        }
+
+        // Take an unused thread object from the heap corresponding to the
+        // requested stack size and rebind it to the given thread data. This
+        // does not require holding the queue mutex.
+        bool reuse_thread_object(threads::thread_id_type& thrd,
+            threads::thread_init_data& data, std::ptrdiff_t stacksize)
+        {
+            thread_heap_type* heap = get_thread_heap(stacksize);
             HPX_ASSERT(heap);
 
             if (data.initial_state == pending_do_not_schedule ||
@@ -164,30 +172,48 @@ namespace hpx { namespace threads { namespace policies {
             }
 
             // Check for an unused thread object.
-            if (!heap->empty())
+            threads::thread_data* p = nullptr;
+            if (!heap->pop(p))
+                return false;
+
+            // Take ownership of the thread object and rebind it.
+            thrd = thread_id_type(p);
+            p->rebind(data);
+            return true;
+        }
+
+        // Allocate a new thread object, this must not be called while the
+        // queue mutex is being held.
+        void allocate_thread_object(threads::thread_id_type& thrd,
+            threads::thread_init_data& data, std::ptrdiff_t stacksize)
+        {
+            threads::thread_data* p = nullptr;
+            if (stacksize == parameters_.nostack_stacksize_)
             {
-                // Take ownership of the thread object and rebind it.
-                thrd = heap->front();
-                heap->pop_front();
-                get_thread_id_data(thrd)->rebind(data);
+                p = threads::thread_data_stackless::create(
+                    data, this, stacksize);
             }
             else
             {
-                hpx::util::unlock_guard<Lock> ull(lk);
+                p = threads::thread_data_stackful::create(
+                    data, this, stacksize);
+            }
+            thrd = thread_id_type(p);
+        }
 
-                // Allocate a new thread object.
-                threads::thread_data* p = nullptr;
-                if (stacksize == parameters_.nostack_stacksize_)
-                {
-                    p = threads::thread_data_stackless::create(
-                        data, this, stacksize);
-                }
-                else
-                {
-                    p = threads::thread_data_stackful::create(
-                        data, this, stacksize);
-                }
-                thrd = thread_id_type(p);
+        template <typename Lock>
+        void create_thread_object(threads::thread_id_type& thrd,
+            threads::thread_init_data& data, Lock& lk)
+        {
+            HPX_ASSERT(lk.owns_lock());
+
+            std::ptrdiff_t const stacksize =
+                data.scheduler_base->get_stack_size(data.stacksize);
+
+            if (!reuse_thread_object(thrd, data, stacksize))
+            {
+                hpx::util::unlock_guard<Lock> ull(lk);
+                allocate_thread_object(thrd, data, stacksize);
             }
         }
 
@@ -211,9 +237,11 @@ namespace hpx { namespace threads { namespace policies {
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
                 if (get_maintain_queue_wait_times_enabled())
                 {
-                    addfrom->new_tasks_wait_ +=
+                    std::int64_t wait =
                         util::high_resolution_clock::now() - task->waittime;
+                    addfrom->new_tasks_wait_ += wait;
                     ++addfrom->new_tasks_wait_count_;
+                    addfrom->new_tasks_wait_histogram_.record(wait);
                 }
 #endif
                 // create the new thread
@@ -324,33 +352,21 @@ namespace hpx { namespace threads { namespace policies {
 
         void recycle_thread(thread_id_type thrd)
         {
-            std::ptrdiff_t stacksize =
-                get_thread_id_data(thrd)->get_stack_size();
+            threads::thread_data* p = get_thread_id_data(thrd);
+            std::ptrdiff_t stacksize = p->get_stack_size();
 
-            if (stacksize == parameters_.small_stacksize_)
-            {
-                thread_heap_small_.push_front(thrd);
-            }
-            else if (stacksize == parameters_.medium_stacksize_)
-            {
-                thread_heap_medium_.push_front(thrd);
-            }
-            else if (stacksize == parameters_.large_stacksize_)
-            {
-                thread_heap_large_.push_front(thrd);
-            }
-            else if (stacksize == parameters_.huge_stacksize_)
-            {
-                thread_heap_huge_.push_front(thrd);
-            }
-            else if (stacksize == parameters_.nostack_stacksize_)
-            {
-                thread_heap_nostack_.push_front(thrd);
-            }
-            else
+            thread_heap_type* heap = get_thread_heap(stacksize);
+            if (heap == nullptr)
             {
                 HPX_ASSERT_MSG(
                     false, util::format("Invalid stack size {1}", stacksize));
+                return;
+            }
+
+            // release the thread object if the heap is full already
+            if (!heap->push(p))
+            {
+                deallocate(p);
             }
         }
 
@@ -466,11 +482,11 @@ namespace hpx { namespace threads { namespace policies {
           , new_tasks_wait_(0)
           , new_tasks_wait_count_(0)
 #endif
-          , thread_heap_small_()
-          , thread_heap_medium_()
-          , thread_heap_large_()
-          , thread_heap_huge_()
-          , thread_heap_nostack_()
+          , thread_heap_small_(HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE)
+          , thread_heap_medium_(HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE)
+          , thread_heap_large_(HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE)
+          , thread_heap_huge_(HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE)
+          , thread_heap_nostack_(HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE)
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
           , add_new_time_(0)
           , cleanup_terminated_time_(0)
@@ -495,20 +511,11 @@ namespace hpx { namespace threads { namespace policies {
 
         ~thread_queue()
         {
-            for (auto t : thread_heap_small_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_medium_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_large_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_huge_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_nostack_)
-                deallocate(get_thread_id_data(t));
+            thread_heap_small_.consume_all(&deallocate);
+            thread_heap_medium_.consume_all(&deallocate);
+            thread_heap_large_.consume_all(&deallocate);
+            thread_heap_huge_.consume_all(&deallocate);
+            thread_heap_nostack_.consume_all(&deallocate);
         }
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
@@ -562,6 +569,19 @@ namespace hpx { namespace threads { namespace policies {
                 return 0;
             return work_items_wait_ / count;
         }
+
+        // merge the distribution of wait times into the given histogram
+        void get_task_wait_time_histogram(
+            util::log_histogram& result, bool reset)
+        {
+            result.merge(new_tasks_wait_histogram_, reset);
+        }
+
+        void get_thread_wait_time_histogram(
+            util::log_histogram& result, bool reset)
+        {
+            result.merge(work_items_wait_histogram_, reset);
+        }
 #endif
 
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
@@ -654,15 +674,22 @@ namespace hpx { namespace threads { namespace policies {
             {
                 threads::thread_id_type thrd;
 
+                bool schedule_now = data.initial_state == pending;
+
                 // The mutex can not be locked while a new thread is getting
                 // created, as it might have that the current HPX thread gets
-                // suspended.
-                {
-                    std::unique_lock<mutex_type> lk(mtx_);
+                // suspended. Reusing a thread object does not require the
+                // mutex either.
+                std::ptrdiff_t const stacksize =
+                    data.scheduler_base->get_stack_size(data.stacksize);
 
-                    bool schedule_now = data.initial_state == pending;
+                if (!reuse_thread_object(thrd, data, stacksize))
+                {
+                    allocate_thread_object(thrd, data, stacksize);
+                }
 
-                    create_thread_object(thrd, data, lk);
+                {
+                    std::unique_lock<mutex_type> lk(mtx_);
 
                     // add a new entry in the map for this thread
                     std::pair<thread_map_type::iterator, bool> p =
@@ -729,6 +756,8 @@ namespace hpx { namespace threads { namespace policies {
                     std::uint64_t now = util::high_resolution_clock::now();
                     src->work_items_wait_ += now - trd->waittime;
                     ++src->work_items_wait_count_;
+                    src->work_items_wait_histogram_.record(
+                        now - trd->waittime);
                     trd->waittime = now;
                 }
 #endif
@@ -751,6 +780,8 @@ namespace hpx { namespace threads { namespace policies {
                     std::int64_t now = util::high_resolution_clock::now();
                     src->new_tasks_wait_ += now - task->waittime;
                     ++src->new_tasks_wait_count_;
+                    src->new_tasks_wait_histogram_.record(
+                        now - task->waittime);
                     task->waittime = now;
                 }
 #endif
@@ -795,9 +826,11 @@ namespace hpx { namespace threads { namespace policies {
 
                 if (get_maintain_queue_wait_times_enabled())
                 {
-                    work_items_wait_ +=
+                    std::int64_t wait =
                         util::high_resolution_clock::now() - tdesc->waittime;
+                    work_items_wait_ += wait;
                     ++work_items_wait_count_;
+                    work_items_wait_histogram_.record(wait);
                 }
 
                 thrd = tdesc->data;
@@ -1073,6 +1106,8 @@ namespace hpx { namespace threads { namespace policies {
         std::atomic<std::int64_t> work_items_wait_;
         // overall number of work items in queue
         std::atomic<std::int64_t> work_items_wait_count_;
+        // distribution of wait times of work items
+        util::log_histogram work_items_wait_histogram_;
 #endif
         // list of terminated threads
         terminated_items_type terminated_items_;
@@ -1086,6 +1121,8 @@ namespace hpx { namespace threads { namespace policies {
         std::atomic<std::int64_t> new_tasks_wait_;
         // overall number tasks waited
         std::atomic<std::int64_t> new_tasks_wait_count_;
+        // distribution of wait times of new tasks
+        util::log_histogram new_tasks_wait_histogram_;
 #endif
 
         thread_heap_type thread_heap_small_;
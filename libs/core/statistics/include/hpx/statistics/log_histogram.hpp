@@ -0,0 +1,157 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A log-bucketed (HDR-style) histogram of unsigned 64 bit values.
+    ///
+    /// Values below 2^sub_bucket_bits are counted exactly, larger values are
+    /// counted in one of 2^sub_bucket_bits linear sub-buckets per power of
+    /// two, which bounds the relative error of any reported value to
+    /// 2^-sub_bucket_bits (about 3%). Recording a value is a single relaxed
+    /// atomic increment, so one instance can be updated concurrently from
+    /// several threads without locking. Histograms are usually kept per
+    /// worker thread and merged into a temporary one when queried.
+    class log_histogram
+    {
+    public:
+        static constexpr std::size_t sub_bucket_bits = 5;
+        static constexpr std::size_t sub_bucket_count = std::size_t(1)
+            << sub_bucket_bits;
+        static constexpr std::size_t num_buckets =
+            (64 - sub_bucket_bits + 1) * sub_bucket_count;
+
+        log_histogram()
+          : buckets_(new std::atomic<std::uint64_t>[num_buckets])
+        {
+            reset();
+        }
+
+        log_histogram(log_histogram&&) = default;
+        log_histogram& operator=(log_histogram&&) = default;
+
+        // record one occurrence of the given value
+        void record(std::uint64_t value) noexcept
+        {
+            buckets_[bucket_index(value)].fetch_add(
+                1, std::memory_order_relaxed);
+        }
+
+        // add the counts of the given histogram to this one, optionally
+        // resetting the source without losing concurrently recorded values
+        void merge(log_histogram& other, bool reset = false) noexcept
+        {
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                std::uint64_t count = reset ?
+                    other.buckets_[i].exchange(0, std::memory_order_relaxed) :
+                    other.buckets_[i].load(std::memory_order_relaxed);
+                if (count != 0)
+                {
+                    buckets_[i].fetch_add(count, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void reset() noexcept
+        {
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                buckets_[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        // total number of recorded values
+        std::uint64_t count() const noexcept
+        {
+            std::uint64_t result = 0;
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                result += buckets_[i].load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        // Return the smallest bucket boundary which is not exceeded by the
+        // given percentage (0 < percentile <= 100) of all recorded values,
+        // or zero if nothing was recorded.
+        std::uint64_t value_at_percentile(double percentile) const noexcept
+        {
+            std::uint64_t const total = count();
+            if (total == 0)
+                return 0;
+
+            std::uint64_t rank = static_cast<std::uint64_t>(
+                std::ceil(percentile / 100. * double(total)));
+            if (rank == 0)
+                rank = 1;
+            else if (rank > total)
+                rank = total;
+
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                seen += buckets_[i].load(std::memory_order_relaxed);
+                if (seen >= rank)
+                    return bucket_upper_bound(i);
+            }
+            return bucket_upper_bound(num_buckets - 1);
+        }
+
+        static std::size_t bucket_index(std::uint64_t value) noexcept
+        {
+            if (value < sub_bucket_count)
+                return static_cast<std::size_t>(value);
+
+            std::size_t const shift =
+                most_significant_bit(value) - sub_bucket_bits;
+            return (shift + 1) * sub_bucket_count +
+                static_cast<std::size_t>((value >> shift) - sub_bucket_count);
+        }
+
+        // largest value counted in the bucket with the given index
+        static std::uint64_t bucket_upper_bound(std::size_t index) noexcept
+        {
+            if (index < sub_bucket_count)
+                return index;
+
+            std::size_t const shift = index / sub_bucket_count - 1;
+            std::uint64_t const sub = index % sub_bucket_count;
+
+            // wraps around to the largest representable value for the very
+            // last bucket
+            return ((sub + sub_bucket_count + 1) << shift) - 1;
+        }
+
+    private:
+        // index of the most significant bit set in the given (non-zero)
+        // value
+        static std::size_t most_significant_bit(std::uint64_t value) noexcept
+        {
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return 63 - static_cast<std::size_t>(__builtin_clzll(value));
+#else
+            std::size_t result = 0;
+            while (value >>= 1)
+                ++result;
+            return result;
+#endif
+        }
+
+        std::unique_ptr<std::atomic<std::uint64_t>[]> buckets_;
+    };
+}}    // namespace hpx::util
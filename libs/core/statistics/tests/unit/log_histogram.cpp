@@ -0,0 +1,109 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/statistics/log_histogram.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using hpx::util::log_histogram;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bucket_boundaries()
+{
+    // every value has to fall into the bucket whose upper bound is the first
+    // one not smaller than the value itself
+    std::uint64_t const values[] = {0, 1, 31, 32, 33, 63, 64, 65, 1000,
+        123456789, std::uint64_t(1) << 63, ~std::uint64_t(0)};
+
+    for (std::uint64_t value : values)
+    {
+        std::size_t index = log_histogram::bucket_index(value);
+        HPX_TEST_LT(index, log_histogram::num_buckets);
+        HPX_TEST_LTE(value, log_histogram::bucket_upper_bound(index));
+        if (index != 0)
+        {
+            HPX_TEST_LT(log_histogram::bucket_upper_bound(index - 1), value);
+        }
+    }
+
+    // small values are counted exactly
+    for (std::uint64_t value = 0; value != 32; ++value)
+    {
+        HPX_TEST_EQ(log_histogram::bucket_upper_bound(
+                        log_histogram::bucket_index(value)),
+            value);
+    }
+}
+
+void test_percentiles()
+{
+    log_histogram histogram;
+    HPX_TEST_EQ(histogram.value_at_percentile(99), std::uint64_t(0));
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, 1000000);
+
+    std::vector<std::uint64_t> values(100000);
+    for (std::uint64_t& value : values)
+    {
+        value = dist(gen);
+        histogram.record(value);
+    }
+    std::sort(values.begin(), values.end());
+
+    HPX_TEST_EQ(histogram.count(), std::uint64_t(values.size()));
+
+    for (double percentile : {50., 90., 99., 99.9, 100.})
+    {
+        std::size_t rank =
+            std::size_t(std::ceil(percentile / 100. * values.size()));
+        double expected = double(values[rank - 1]);
+        double reported = double(histogram.value_at_percentile(percentile));
+
+        // the reported value is the upper bound of a bucket covering at most
+        // 1/32 of its value range
+        HPX_TEST_LTE(expected, reported);
+        HPX_TEST_LTE(reported, expected * (1. + 1. / 32.));
+    }
+}
+
+void test_merge()
+{
+    log_histogram first, second;
+    for (std::uint64_t value = 0; value != 1000; ++value)
+    {
+        first.record(value);
+        second.record(value + 1000);
+    }
+
+    log_histogram merged;
+    merged.merge(first);
+    merged.merge(second, true);
+
+    HPX_TEST_EQ(merged.count(), std::uint64_t(2000));
+    HPX_TEST_EQ(first.count(), std::uint64_t(1000));
+    HPX_TEST_EQ(second.count(), std::uint64_t(0));
+    HPX_TEST_LTE(std::uint64_t(999), merged.value_at_percentile(50));
+    HPX_TEST_LTE(merged.value_at_percentile(50), std::uint64_t(1031));
+
+    merged.reset();
+    HPX_TEST_EQ(merged.count(), std::uint64_t(0));
+}
+
+int main()
+{
+    test_bucket_boundaries();
+    test_percentiles();
+    test_merge();
+
+    return hpx::util::report_errors();
+}
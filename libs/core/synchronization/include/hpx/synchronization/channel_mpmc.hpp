@@ -5,6 +5,8 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 //  This work is inspired by https://github.com/aprell/tasking-2.0
+//  The lock-free ring buffer is based on the bounded MPMC queue by Dmitry
+//  Vyukov (http://www.1024cores.net)
 
 #pragma once
 
@@ -13,8 +15,10 @@
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/thread_support.hpp>
+#include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <mutex>
@@ -27,190 +31,412 @@ namespace hpx { namespace lcos { namespace local {
     // This channel is bounded to a size given at construction time and supports
     // multiple producers and multiple consumers. The data is stored in a
     // ring-buffer.
+    //
+    // The channel is lock-free: every slot of the ring-buffer carries a
+    // sequence number which tells producers and consumers whether the slot
+    // is ready to be written or read. Producers and consumers claim slots by
+    // advancing the tail and head positions, they never wait for each other
+    // unless they access the very same slot. The ring-buffer is rounded up to
+    // the next power of two, the channel holds at most the number of items
+    // given at construction time nevertheless.
+    //
+    // The Mutex template parameter is not used anymore, it is retained for
+    // compatibility only.
     template <typename T, typename Mutex = util::spinlock>
     class bounded_channel
     {
     private:
-        using mutex_type = Mutex;
+        struct cell
+        {
+            std::atomic<std::size_t> sequence_;
+            T data_;
+        };
 
-        bool is_full(std::size_t tail) const noexcept
+        static std::size_t round_to_power_of_two(std::size_t size) noexcept
         {
-            std::size_t numitems = size_ + tail - head_.data_;
-            if (numitems < size_)
+            std::size_t result = 1;
+            while (result < size)
             {
-                return numitems == size_ - 1;
+                result <<= 1;
             }
-            return numitems - size_ == size_ - 1;
-        }
-
-        bool is_empty(std::size_t head) const noexcept
-        {
-            return head == tail_.data_;
+            return result;
         }
 
     public:
         explicit bounded_channel(std::size_t size)
-          : size_(size + 1)
-          , buffer_(new T[size + 1])
+          : size_(size)
+          , mask_(round_to_power_of_two(size) - 1)
+          , buffer_(new cell[mask_ + 1])
           , closed_(false)
         {
             HPX_ASSERT(size != 0);
 
-            // invoke constructors for allocated buffer
-            for (std::size_t i = 0; i != size_; ++i)
+            for (std::size_t i = 0; i != mask_ + 1; ++i)
             {
-                new (&buffer_[i]) T();
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
             }
 
-            head_.data_ = 0;
-            tail_.data_ = 0;
+            head_.data_.store(0, std::memory_order_relaxed);
+            tail_.data_.store(0, std::memory_order_relaxed);
         }
 
+        // moving a channel is not thread-safe
         bounded_channel(bounded_channel&& rhs) noexcept
-          : head_(rhs.head_)
-          , tail_(rhs.tail_)
-          , size_(rhs.size_)
+          : size_(rhs.size_)
+          , mask_(rhs.mask_)
           , buffer_(std::move(rhs.buffer_))
-          , closed_(rhs.closed_)
+          , closed_(rhs.closed_.load(std::memory_order_acquire))
         {
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
             rhs.size_ = 0;
-            rhs.closed_ = true;
+            rhs.mask_ = 0;
+            rhs.closed_.store(true, std::memory_order_release);
         }
 
         bounded_channel& operator=(bounded_channel&& rhs) noexcept
         {
-            head_ = rhs.head_;
-            tail_ = rhs.tail_;
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
             size_ = rhs.size_;
+            mask_ = rhs.mask_;
             buffer_ = std::move(rhs.buffer_);
-            closed_ = rhs.closed_;
-            rhs.closed_ = true;
+            closed_.store(rhs.closed_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
+            rhs.size_ = 0;
+            rhs.mask_ = 0;
+            rhs.closed_.store(true, std::memory_order_release);
             return *this;
         }
 
-        ~bounded_channel()
+        bool get(T* val = nullptr) const noexcept
         {
-            std::unique_lock<mutex_type> l(mtx_.data_);
-
-            // invoke destructors for allocated buffer
-            for (std::size_t i = 0; i != size_; ++i)
+            if (closed_.load(std::memory_order_relaxed))
             {
-                (&buffer_[i])->~T();
+                return false;
             }
 
-            if (!closed_)
+            std::size_t head = head_.data_.load(std::memory_order_relaxed);
+            while (true)
             {
-                close(l);
+                cell& c = buffer_[head & mask_];
+                std::size_t const seq =
+                    c.sequence_.load(std::memory_order_acquire);
+                std::ptrdiff_t const diff = static_cast<std::ptrdiff_t>(seq) -
+                    static_cast<std::ptrdiff_t>(head + 1);
+
+                if (diff == 0)
+                {
+                    // the slot holds an item
+                    if (val == nullptr)
+                    {
+                        return true;
+                    }
+
+                    if (head_.data_.compare_exchange_weak(
+                            head, head + 1, std::memory_order_relaxed))
+                    {
+                        *val = std::move(c.data_);
+
+                        // the slot can be reused once the producers went
+                        // around the ring-buffer once more
+                        c.sequence_.store(
+                            head + mask_ + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // the channel is empty
+                    return false;
+                }
+                else
+                {
+                    // another consumer got in between
+                    head = head_.data_.load(std::memory_order_relaxed);
+                }
             }
         }
 
-        bool get(T* val = nullptr) const noexcept
+        bool set(T&& t) noexcept
         {
-            std::unique_lock<mutex_type> l(mtx_.data_);
-            if (closed_)
+            if (closed_.load(std::memory_order_relaxed))
             {
                 return false;
             }
 
-            std::size_t head = head_.data_;
+            std::size_t tail = tail_.data_.load(std::memory_order_relaxed);
+            while (true)
+            {
+                cell& c = buffer_[tail & mask_];
+                std::size_t const seq =
+                    c.sequence_.load(std::memory_order_acquire);
+                std::ptrdiff_t const diff = static_cast<std::ptrdiff_t>(seq) -
+                    static_cast<std::ptrdiff_t>(tail);
+
+                if (diff == 0)
+                {
+                    // the slot is free, but the ring-buffer may be larger
+                    // than the requested capacity
+                    std::size_t const head =
+                        head_.data_.load(std::memory_order_acquire);
+                    if (static_cast<std::ptrdiff_t>(tail - head) >=
+                        static_cast<std::ptrdiff_t>(size_))
+                    {
+                        // the channel is full
+                        return false;
+                    }
+
+                    if (tail_.data_.compare_exchange_weak(
+                            tail, tail + 1, std::memory_order_relaxed))
+                    {
+                        c.data_ = std::move(t);
+                        c.sequence_.store(tail + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // the channel is full
+                    return false;
+                }
+                else
+                {
+                    // another producer got in between
+                    tail = tail_.data_.load(std::memory_order_relaxed);
+                }
+            }
+        }
 
-            if (is_empty(head))
+        std::size_t close()
+        {
+            bool expected = false;
+            if (!closed_.compare_exchange_strong(expected, true))
             {
-                return false;
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::bounded_channel::close",
+                    "attempting to close an already closed channel");
             }
+            return 0;
+        }
+
+        bool is_closed() const noexcept
+        {
+            return closed_.load(std::memory_order_relaxed);
+        }
+
+        std::size_t capacity() const
+        {
+            return size_;
+        }
+
+    private:
+        // keep the head and the tail pointer in separate cache lines
+        mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> tail_;
+
+        // the capacity of the channel
+        std::size_t size_;
+
+        // the size of the ring-buffer minus one (a power of two minus one)
+        std::size_t mask_;
+
+        // channel buffer
+        std::unique_ptr<cell[]> buffer_;
+
+        // this channel was closed, i.e. no further operations are possible
+        std::atomic<bool> closed_;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // For use with HPX threads, the channel_mpmc defined here is the fastest
+    // (even faster than the channel_spsc). It can be used with non-HPX threads
+    // as well.
+    template <typename T>
+    using channel_mpmc = bounded_channel<T, hpx::lcos::local::spinlock>;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // A bounded multiple producer, multiple consumer channel which suspends
+    // the calling HPX thread instead of returning false if the channel is
+    // empty (on get) or full (on set). Items are passed through the lock-free
+    // bounded_channel, the lock is acquired only if a thread has to be
+    // suspended or if a suspended thread has to be woken up.
+    template <typename T>
+    class bounded_blocking_channel
+    {
+    private:
+        using mutex_type = hpx::lcos::local::spinlock;
 
-            if (val == nullptr)
+    public:
+        explicit bounded_blocking_channel(std::size_t size)
+          : channel_(size)
+          , consumers_waiting_(0)
+          , producers_waiting_(0)
+        {
+        }
+
+        HPX_NON_COPYABLE(bounded_blocking_channel);
+
+        // Wait for an item to become available and retrieve it. If val is
+        // nullptr, the item is left in the channel. Returns false if the
+        // channel was closed.
+        bool get(T* val = nullptr) const
+        {
+            if (channel_.get(val))
             {
+                if (val != nullptr)
+                {
+                    notify(not_full_, producers_waiting_);
+                }
                 return true;
             }
 
-            *val = std::move(buffer_[head]);
-            if (++head >= size_)
+            std::unique_lock<mutex_type> l(mtx_.data_);
+
+            ++consumers_waiting_;
+            while (true)
             {
-                head = 0;
+                // pairs with the fence in notify()
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (channel_.get(val))
+                {
+                    --consumers_waiting_;
+                    l.unlock();
+
+                    // a consumer may be waiting for the item which was left
+                    // in the channel
+                    notify(val != nullptr ? not_full_ : not_empty_,
+                        val != nullptr ? producers_waiting_ :
+                                         consumers_waiting_);
+                    return true;
+                }
+
+                if (channel_.is_closed())
+                {
+                    --consumers_waiting_;
+                    return false;
+                }
+
+                not_empty_.wait(l, "bounded_blocking_channel::get");
             }
-            head_.data_ = head;
-
-            return true;
         }
 
-        bool set(T&& t) noexcept
+        // Wait for space to become available and store the given item.
+        // Returns false if the channel was closed.
+        bool set(T&& t)
         {
-            std::unique_lock<mutex_type> l(mtx_.data_);
-            if (closed_)
+            if (channel_.set(std::move(t)))
             {
-                return false;
+                notify(not_empty_, consumers_waiting_);
+                return true;
             }
 
-            std::size_t tail = tail_.data_;
+            std::unique_lock<mutex_type> l(mtx_.data_);
 
-            if (is_full(tail))
+            ++producers_waiting_;
+            while (true)
             {
-                return false;
+                // pairs with the fence in notify()
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (channel_.set(std::move(t)))
+                {
+                    --producers_waiting_;
+                    l.unlock();
+
+                    notify(not_empty_, consumers_waiting_);
+                    return true;
+                }
+
+                if (channel_.is_closed())
+                {
+                    --producers_waiting_;
+                    return false;
+                }
+
+                not_full_.wait(l, "bounded_blocking_channel::set");
             }
+        }
 
-            buffer_[tail] = std::move(t);
-            if (++tail >= size_)
+        // Non-blocking variants of get() and set()
+        bool try_get(T* val = nullptr) const
+        {
+            if (channel_.get(val))
             {
-                tail = 0;
+                if (val != nullptr)
+                {
+                    notify(not_full_, producers_waiting_);
+                }
+                return true;
             }
-            tail_.data_ = tail;
+            return false;
+        }
 
-            return true;
+        bool try_set(T&& t)
+        {
+            if (channel_.set(std::move(t)))
+            {
+                notify(not_empty_, consumers_waiting_);
+                return true;
+            }
+            return false;
         }
 
+        // Close the channel, all suspended threads are woken up
         std::size_t close()
         {
             std::unique_lock<mutex_type> l(mtx_.data_);
-            return close(l);
+            std::size_t result = channel_.close();
+
+            not_empty_.notify_all(std::move(l));
+
+            l = std::unique_lock<mutex_type>(mtx_.data_);
+            not_full_.notify_all(std::move(l));
+
+            return result;
         }
 
-        std::size_t capacity() const
+        bool is_closed() const noexcept
         {
-            return size_ - 1;
+            return channel_.is_closed();
         }
 
-    protected:
-        std::size_t close(std::unique_lock<mutex_type>& l)
+        std::size_t capacity() const
         {
-            HPX_ASSERT_OWNS_LOCK(l);
+            return channel_.capacity();
+        }
 
-            if (closed_)
+    private:
+        void notify(detail::condition_variable& cond,
+            std::atomic<std::size_t>& waiting) const
+        {
+            // make the channel operation visible to a thread which is about
+            // to be suspended, this pairs with the fences in get() and set()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed) != 0)
             {
-                l.unlock();
-                HPX_THROW_EXCEPTION(hpx::invalid_status,
-                    "hpx::lcos::local::bounded_channel::close",
-                    "attempting to close an already closed channel");
+                std::unique_lock<mutex_type> l(mtx_.data_);
+                cond.notify_one(std::move(l));
             }
-
-            closed_ = true;
-            return 0;
         }
 
-    private:
-        // keep the mutex, the head, and the tail pointer in separate cache
-        // lines
-        mutable hpx::util::cache_aligned_data<mutex_type> mtx_;
-        mutable hpx::util::cache_aligned_data<std::size_t> head_;
-        hpx::util::cache_aligned_data<std::size_t> tail_;
-
-        // a channel of size n can buffer n-1 items
-        std::size_t size_;
-
-        // channel buffer
-        std::unique_ptr<T[]> buffer_;
+        bounded_channel<T> channel_;
 
-        // this channel was closed, i.e. no further operations are possible
-        bool closed_;
+        mutable hpx::util::cache_aligned_data<mutex_type> mtx_;
+        mutable detail::condition_variable not_empty_;
+        mutable detail::condition_variable not_full_;
+        mutable std::atomic<std::size_t> consumers_waiting_;
+        mutable std::atomic<std::size_t> producers_waiting_;
     };
 
-    ////////////////////////////////////////////////////////////////////////////
-    // For use with HPX threads, the channel_mpmc defined here is the fastest
-    // (even faster than the channel_spsc). Using hpx::util::spinlock as the
-    // means of synchronization enables the use of this channel with non-HPX
-    // threads, however the performance degrades by a factor of ten compared to
-    // using hpx::lcos::local::spinlock.
     template <typename T>
-    using channel_mpmc = bounded_channel<T, hpx::lcos::local::spinlock>;
+    using blocking_channel_mpmc = bounded_blocking_channel<T>;
 
 }}}    // namespace hpx::lcos::local
@@ -0,0 +1,199 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the throughput of the bounded local channels
+// (channel_spsc, channel_mpsc, channel_mpmc, and blocking_channel_mpmc) for
+// a configurable number of producers and consumers. The channels which do
+// not support the given number of producers or consumers are skipped.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/synchronization/channel_mpmc.hpp>
+#include <hpx/synchronization/channel_mpsc.hpp>
+#include <hpx/synchronization/channel_spsc.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the non-blocking channels return false if they are empty or full
+template <typename Channel>
+void channel_set(Channel& c, std::uint64_t val)
+{
+    while (!c.set(std::move(val)))    // NOLINT
+    {
+        hpx::this_thread::yield();
+    }
+}
+
+template <typename Channel>
+std::uint64_t channel_get(Channel const& c)
+{
+    std::uint64_t result = 0;
+    while (!c.get(&result))
+    {
+        hpx::this_thread::yield();
+    }
+    return result;
+}
+
+// the blocking channel suspends the calling thread instead
+void channel_set(hpx::lcos::local::blocking_channel_mpmc<std::uint64_t>& c,
+    std::uint64_t val)
+{
+    c.set(std::move(val));
+}
+
+std::uint64_t channel_get(
+    hpx::lcos::local::blocking_channel_mpmc<std::uint64_t> const& c)
+{
+    std::uint64_t result = 0;
+    c.get(&result);
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+void produce(Channel& c, std::uint64_t num_items)
+{
+    for (std::uint64_t i = 0; i != num_items; ++i)
+    {
+        channel_set(c, i);
+    }
+}
+
+template <typename Channel>
+std::uint64_t consume(Channel const& c, std::uint64_t num_items)
+{
+    std::uint64_t sum = 0;
+    for (std::uint64_t i = 0; i != num_items; ++i)
+    {
+        sum += channel_get(c);
+    }
+    return sum;
+}
+
+template <typename Channel>
+void run_benchmark(char const* name, std::size_t capacity,
+    std::size_t num_producers, std::size_t num_consumers,
+    std::uint64_t num_items)
+{
+    Channel c(capacity);
+
+    // all items are evenly distributed over producers and consumers
+    std::uint64_t const total = num_items * num_producers;
+    HPX_ASSERT(total % num_consumers == 0);
+
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    std::vector<hpx::future<void>> producers;
+    producers.reserve(num_producers);
+    for (std::size_t i = 0; i != num_producers; ++i)
+    {
+        producers.push_back(
+            hpx::async(&produce<Channel>, std::ref(c), num_items));
+    }
+
+    std::vector<hpx::future<std::uint64_t>> consumers;
+    consumers.reserve(num_consumers);
+    for (std::size_t i = 0; i != num_consumers; ++i)
+    {
+        consumers.push_back(hpx::async(&consume<Channel>, std::cref(c),
+            total / num_consumers));
+    }
+
+    hpx::wait_all(producers);
+
+    std::uint64_t sum = 0;
+    for (auto&& f : consumers)
+    {
+        sum += f.get();
+    }
+
+    double elapsed =
+        static_cast<double>(hpx::util::high_resolution_clock::now() - start) /
+        1e9;
+
+    if (sum != num_producers * (num_items * (num_items - 1) / 2))
+    {
+        std::cout << name << ": Error!\n";
+    }
+
+    std::cout << name << ": " << (total / elapsed) << " [op/s] ("
+              << (elapsed / total) << " [s/op])\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t capacity = vm["capacity"].as<std::size_t>();
+    std::size_t num_producers = vm["producers"].as<std::size_t>();
+    std::size_t num_consumers = vm["consumers"].as<std::size_t>();
+    std::uint64_t num_items = vm["items"].as<std::uint64_t>();
+
+    if (num_producers == 0 || num_consumers == 0 ||
+        (num_items * num_producers) % num_consumers != 0)
+    {
+        std::cout << "the number of items produced has to be divisible by "
+                     "the number of consumers\n";
+        return hpx::finalize();
+    }
+
+    std::cout << "producers: " << num_producers
+              << ", consumers: " << num_consumers
+              << ", capacity: " << capacity << "\n";
+
+    using value_type = std::uint64_t;
+
+    if (num_producers == 1 && num_consumers == 1)
+    {
+        run_benchmark<hpx::lcos::local::channel_spsc<value_type>>(
+            "channel_spsc", capacity, num_producers, num_consumers, num_items);
+    }
+    if (num_consumers == 1)
+    {
+        run_benchmark<hpx::lcos::local::channel_mpsc<value_type>>(
+            "channel_mpsc", capacity, num_producers, num_consumers, num_items);
+    }
+    run_benchmark<hpx::lcos::local::channel_mpmc<value_type>>(
+        "channel_mpmc", capacity, num_producers, num_consumers, num_items);
+    run_benchmark<hpx::lcos::local::blocking_channel_mpmc<value_type>>(
+        "blocking_channel_mpmc", capacity, num_producers, num_consumers,
+        num_items);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("capacity", value<std::size_t>()->default_value(1024),
+         "capacity of the channels (default: 1024)")
+        ("producers", value<std::size_t>()->default_value(1),
+         "number of producing threads (default: 1)")
+        ("consumers", value<std::size_t>()->default_value(1),
+         "number of consuming threads (default: 1)")
+        ("items", value<std::uint64_t>()->default_value(1000000),
+         "number of items sent by each producer (default: 1000000)")
+        ;
+    // clang-format on
+
+    return hpx::init(desc_commandline, argc, argv);
+}
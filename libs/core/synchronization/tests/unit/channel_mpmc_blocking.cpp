@@ -0,0 +1,152 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/synchronization/channel_mpmc.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+constexpr int NUM_PRODUCERS = 4;
+constexpr int NUM_CONSUMERS = 4;
+constexpr int NUM_ITEMS = 10000;
+
+using channel_type = hpx::lcos::local::blocking_channel_mpmc<int>;
+
+///////////////////////////////////////////////////////////////////////////////
+void produce(channel_type& c, int first)
+{
+    for (int i = 0; i != NUM_ITEMS; ++i)
+    {
+        HPX_TEST(c.set(first + i));
+    }
+}
+
+std::int64_t consume(channel_type const& c)
+{
+    std::int64_t sum = 0;
+    for (int i = 0; i != NUM_ITEMS; ++i)
+    {
+        int value = 0;
+        HPX_TEST(c.get(&value));
+        sum += value;
+    }
+    return sum;
+}
+
+// the producers and consumers suspend whenever the (small) channel is full
+// or empty
+void test_blocking_channel()
+{
+    channel_type c(4);
+    HPX_TEST_EQ(c.capacity(), std::size_t(4));
+
+    std::vector<hpx::future<void>> producers;
+    std::vector<hpx::future<std::int64_t>> consumers;
+
+    for (int i = 0; i != NUM_CONSUMERS; ++i)
+    {
+        consumers.push_back(hpx::async(&consume, std::cref(c)));
+    }
+    for (int i = 0; i != NUM_PRODUCERS; ++i)
+    {
+        producers.push_back(hpx::async(&produce, std::ref(c), i * NUM_ITEMS));
+    }
+
+    hpx::wait_all(producers);
+
+    std::int64_t sum = 0;
+    for (auto&& f : consumers)
+    {
+        sum += f.get();
+    }
+
+    std::int64_t const n = std::int64_t(NUM_PRODUCERS) * NUM_ITEMS;
+    HPX_TEST_EQ(sum, n * (n - 1) / 2);
+
+    // the channel is empty now
+    HPX_TEST(!c.try_get());
+}
+
+// closing the channel wakes up all suspended threads
+void test_blocking_channel_close()
+{
+    channel_type c(1);
+    HPX_TEST(c.try_set(42));
+
+    hpx::future<bool> producer =
+        hpx::async([&c]() { return c.set(43); });
+
+    int value = 0;
+    HPX_TEST(c.get(&value));
+    HPX_TEST_EQ(value, 42);
+    HPX_TEST(c.get(&value));
+    HPX_TEST_EQ(value, 43);
+    HPX_TEST(producer.get());
+
+    hpx::future<bool> consumer =
+        hpx::async([&c]() { return c.get(); });
+
+    c.close();
+    HPX_TEST(!consumer.get());
+    HPX_TEST(!c.set(44));
+    HPX_TEST(c.is_closed());
+}
+
+// channels which are not a power of two in size hold exactly the requested
+// number of items
+void test_channel_capacity()
+{
+    hpx::lcos::local::channel_mpmc<int> c(5);
+    HPX_TEST_EQ(c.capacity(), std::size_t(5));
+
+    // fill and drain the channel a couple of times to wrap around the
+    // (larger) ring-buffer
+    for (int round = 0; round != 4; ++round)
+    {
+        for (int i = 0; i != 5; ++i)
+        {
+            HPX_TEST(c.set(round + i));
+        }
+        HPX_TEST(!c.set(5));
+
+        int value = 0;
+        HPX_TEST(c.get(&value));
+        HPX_TEST_EQ(value, round);
+        HPX_TEST(c.set(round + 5));
+        HPX_TEST(!c.set(6));
+
+        for (int i = 1; i != 6; ++i)
+        {
+            HPX_TEST(c.get(&value));
+            HPX_TEST_EQ(value, round + i);
+        }
+        HPX_TEST(!c.get());
+    }
+
+    channel_type bc(5);
+    HPX_TEST_EQ(bc.capacity(), std::size_t(5));
+    for (int i = 0; i != 5; ++i)
+    {
+        HPX_TEST(bc.try_set(int(i)));
+    }
+    HPX_TEST(!bc.try_set(5));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_channel_capacity();
+    test_blocking_channel();
+    test_blocking_channel_close();
+
+    return hpx::util::report_errors();
+}
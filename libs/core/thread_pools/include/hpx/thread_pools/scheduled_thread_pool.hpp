@@ -13,6 +13,7 @@
 #include <hpx/concurrency/barrier.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 #include <hpx/thread_pools/scheduling_loop.hpp>
 #include <hpx/threading_base/callback_notifier.hpp>
 #include <hpx/threading_base/network_background_callback.hpp>
@@ -232,6 +233,20 @@ namespace hpx { namespace threads { namespace detail {
         {
             return sched_->Scheduler::get_average_task_wait_time(num_thread);
         }
+
+        void get_thread_wait_time_histogram(std::size_t num_thread,
+            util::log_histogram& result, bool reset) override
+        {
+            sched_->Scheduler::get_thread_wait_time_histogram(
+                num_thread, result, reset);
+        }
+
+        void get_task_wait_time_histogram(std::size_t num_thread,
+            util::log_histogram& result, bool reset) override
+        {
+            sched_->Scheduler::get_task_wait_time_histogram(
+                num_thread, result, reset);
+        }
 #endif
 
         std::int64_t get_executed_threads() const;
@@ -241,6 +256,8 @@ namespace hpx { namespace threads { namespace detail {
         std::int64_t get_executed_thread_phases(std::size_t, bool) override;
 #if defined(HPX_HAVE_THREAD_IDLE_RATES)
         std::int64_t get_thread_phase_duration(std::size_t, bool) override;
+        void get_thread_phase_duration_histogram(
+            std::size_t, util::log_histogram&, bool) override;
         std::int64_t get_thread_duration(std::size_t, bool) override;
         std::int64_t get_thread_phase_overhead(std::size_t, bool) override;
         std::int64_t get_thread_overhead(std::size_t, bool) override;
@@ -277,6 +294,48 @@ namespace hpx { namespace threads { namespace detail {
 
         std::int64_t get_idle_loop_count(std::size_t num, bool reset) override;
         std::int64_t get_busy_loop_count(std::size_t num, bool reset) override;
+
+        std::int64_t get_idle_park_count(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_park_count(num, reset);
+        }
+        std::int64_t get_idle_unpark_count(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_unpark_count(num, reset);
+        }
+        std::int64_t get_idle_wake_latency(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_wake_latency(num, reset);
+        }
+
+        std::int64_t get_timers_armed_count(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_timers_armed_count(num, reset);
+        }
+        std::int64_t get_timers_fired_count(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_timers_fired_count(num, reset);
+        }
+        std::int64_t get_timers_cancelled_count(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_timers_cancelled_count(num, reset);
+        }
+        std::int64_t get_timer_lateness(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_timer_lateness(num, reset);
+        }
+        std::int64_t get_timer_overhead(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_timer_overhead(num, reset);
+        }
+
         std::int64_t get_scheduler_utilization() const override;
 
 #if defined(HPX_HAVE_THREAD_EXECUTORS_COMPATIBILITY)
@@ -374,6 +433,11 @@ namespace hpx { namespace threads { namespace detail {
             std::int64_t tfunc_times_;
             std::int64_t reset_tfunc_times_;
 
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+            // distribution of thread phase durations [ns]
+            util::log_histogram exec_time_histogram_;
+#endif
+
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
             // overall counters for background work
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/affinity/affinity_data.hpp>
+#include <hpx/allocator_support/numa_slab_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/barrier.hpp>
 #include <hpx/execution_base/this_thread.hpp>
@@ -191,7 +192,7 @@ namespace hpx { namespace threads { namespace detail {
             sched_->Scheduler::set_all_states_at_least(state_stopping);
 
             // make sure we're not waiting
-            sched_->Scheduler::do_some_work(std::size_t(-1));
+            sched_->Scheduler::do_some_work_all();
 
             if (blocking)
             {
@@ -204,7 +205,7 @@ namespace hpx { namespace threads { namespace detail {
                     // make sure no OS thread is waiting
                     LTM_(info) << "stop: " << id_.name() << " notify_all";
 
-                    sched_->Scheduler::do_some_work(std::size_t(-1));
+                    sched_->Scheduler::do_some_work_all();
 
                     LTM_(info) << "stop: " << id_.name() << " join:" << i;
 
@@ -408,6 +409,16 @@ namespace hpx { namespace threads { namespace detail {
                     << global_thread_num
                     << " failed with: " << ec.get_message();
             }
+#if defined(HPX_HAVE_NUMA_ALLOCATOR)
+            else
+            {
+                // let the internal allocator serve this thread from the
+                // memory of its NUMA domain
+                util::numa_slab::set_thread_numa_domain(
+                    topo.get_numa_node_number(
+                        affinity_data_.get_pu_num(global_thread_num)));
+            }
+#endif
         }
         else
         {
@@ -480,7 +491,11 @@ namespace hpx { namespace threads { namespace detail {
                     counter_data.tasks_active_,
                     counter_data.background_duration_,
                     counter_data.background_send_duration_,
-                    counter_data.background_receive_duration_);
+                    counter_data.background_receive_duration_,
+                    counter_data.exec_time_histogram_, timestamp_scale_);
+#elif defined(HPX_HAVE_THREAD_IDLE_RATES)
+                    counter_data.tasks_active_,
+                    counter_data.exec_time_histogram_, timestamp_scale_);
 #else
                     counter_data.tasks_active_);
 #endif    // HPX_HAVE_BACKGROUND_THREAD_COUNTERS
@@ -826,6 +841,22 @@ namespace hpx { namespace threads { namespace detail {
             (double(exec_total) * timestamp_scale_) / double(num_phases));
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::get_thread_phase_duration_histogram(
+        std::size_t num, util::log_histogram& result, bool reset)
+    {
+        if (num != std::size_t(-1))
+        {
+            result.merge(counter_data_[num].exec_time_histogram_, reset);
+            return;
+        }
+
+        for (auto& data : counter_data_)
+        {
+            result.merge(data.exec_time_histogram_, reset);
+        }
+    }
+
     template <typename Scheduler>
     std::int64_t scheduled_thread_pool<Scheduler>::get_thread_duration(
         std::size_t num, bool reset)
@@ -1958,6 +1989,9 @@ namespace hpx { namespace threads { namespace detail {
             state.store(oldstate);
         }
 
+        // make sure the virtual core is not idling
+        sched_->Scheduler::do_some_work_all();
+
         HPX_ASSERT(oldstate == state_starting || oldstate == state_running ||
             oldstate == state_stopping || oldstate == state_stopped ||
             oldstate == state_terminating);
@@ -2011,6 +2045,9 @@ namespace hpx { namespace threads { namespace detail {
         hpx::state expected = state_running;
         state.compare_exchange_strong(expected, state_pre_sleep);
 
+        // make sure the virtual core is not idling
+        sched_->Scheduler::do_some_work_all();
+
         l.unlock();
 
         HPX_ASSERT(expected == state_running || expected == state_pre_sleep ||
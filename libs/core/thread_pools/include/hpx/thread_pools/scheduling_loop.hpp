@@ -13,6 +13,7 @@
 #include <hpx/hardware/timestamp.hpp>
 #include <hpx/modules/itt_notify.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -224,16 +225,25 @@ namespace hpx { namespace threads { namespace detail {
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
     struct idle_collect_rate
     {
-        idle_collect_rate(std::int64_t& tfunc_time, std::int64_t& exec_time)
+        idle_collect_rate(std::int64_t& tfunc_time, std::int64_t& exec_time,
+            util::log_histogram& exec_time_histogram, double timestamp_scale)
           : start_timestamp_(util::hardware::timestamp())
           , tfunc_time_(tfunc_time)
           , exec_time_(exec_time)
+          , exec_time_histogram_(exec_time_histogram)
+          , timestamp_scale_(timestamp_scale)
         {
         }
 
         void collect_exec_time(std::int64_t timestamp)
         {
-            exec_time_ += util::hardware::timestamp() - timestamp;
+            std::int64_t const exec_time =
+                util::hardware::timestamp() - timestamp;
+            exec_time_ += exec_time;
+
+            // the histogram is maintained in nanoseconds
+            exec_time_histogram_.record(static_cast<std::uint64_t>(
+                double(exec_time) * timestamp_scale_));
         }
         void take_snapshot()
         {
@@ -253,6 +263,8 @@ namespace hpx { namespace threads { namespace detail {
 
         std::int64_t& tfunc_time_;
         std::int64_t& exec_time_;
+        util::log_histogram& exec_time_histogram_;
+        double timestamp_scale_;
     };
 
     struct exec_time_wrapper
@@ -328,7 +340,8 @@ namespace hpx { namespace threads { namespace detail {
             std::int64_t& busy_loop_count, bool& is_active,
             std::int64_t& background_work_duration,
             std::int64_t& background_send_duration,
-            std::int64_t& background_receive_duration)
+            std::int64_t& background_receive_duration,
+            util::log_histogram& exec_time_histogram, double timestamp_scale)
           : executed_threads_(executed_threads)
           , executed_thread_phases_(executed_thread_phases)
           , tfunc_time_(tfunc_time)
@@ -338,6 +351,8 @@ namespace hpx { namespace threads { namespace detail {
           , background_work_duration_(background_work_duration)
           , background_send_duration_(background_send_duration)
           , background_receive_duration_(background_receive_duration)
+          , exec_time_histogram_(exec_time_histogram)
+          , timestamp_scale_(timestamp_scale)
           , is_active_(is_active)
         {
         }
@@ -351,6 +366,8 @@ namespace hpx { namespace threads { namespace detail {
         std::int64_t& background_work_duration_;
         std::int64_t& background_send_duration_;
         std::int64_t& background_receive_duration_;
+        util::log_histogram& exec_time_histogram_;
+        double timestamp_scale_;
         bool& is_active_;
     };
 #else
@@ -359,13 +376,22 @@ namespace hpx { namespace threads { namespace detail {
         scheduling_counters(std::int64_t& executed_threads,
             std::int64_t& executed_thread_phases, std::int64_t& tfunc_time,
             std::int64_t& exec_time, std::int64_t& idle_loop_count,
-            std::int64_t& busy_loop_count, bool& is_active)
+            std::int64_t& busy_loop_count, bool& is_active
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+            ,
+            util::log_histogram& exec_time_histogram, double timestamp_scale
+#endif
+            )
           : executed_threads_(executed_threads)
           , executed_thread_phases_(executed_thread_phases)
           , tfunc_time_(tfunc_time)
           , exec_time_(exec_time)
           , idle_loop_count_(idle_loop_count)
           , busy_loop_count_(busy_loop_count)
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+          , exec_time_histogram_(exec_time_histogram)
+          , timestamp_scale_(timestamp_scale)
+#endif
           , is_active_(is_active)
         {
         }
@@ -376,6 +402,10 @@ namespace hpx { namespace threads { namespace detail {
         std::int64_t& exec_time_;
         std::int64_t& idle_loop_count_;
         std::int64_t& busy_loop_count_;
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+        util::log_histogram& exec_time_histogram_;
+        double timestamp_scale_;
+#endif
         bool& is_active_;
     };
 
@@ -579,7 +609,12 @@ namespace hpx { namespace threads { namespace detail {
             counters.background_work_duration_;
 #endif    // HPX_HAVE_BACKGROUND_THREAD_COUNTERS
 
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+        idle_collect_rate idle_rate(counters.tfunc_time_, counters.exec_time_,
+            counters.exec_time_histogram_, counters.timestamp_scale_);
+#else
         idle_collect_rate idle_rate(counters.tfunc_time_, counters.exec_time_);
+#endif
         tfunc_time_wrapper tfunc_time_collector(idle_rate);
 
         // spin for some time after queues have become empty
@@ -977,6 +1012,11 @@ namespace hpx { namespace threads { namespace detail {
 
             scheduler.custom_polling_function();
 
+            // fire expired timers, idle OS threads take care of the timers of
+            // busy ones as well
+            scheduler.SchedulingPolicy::process_timers(
+                num_thread, idle_loop_count < params.max_idle_loop_count_);
+
             // something went badly wrong, give up
             if (HPX_UNLIKELY(this_state.load() == state_terminating))
                 break;
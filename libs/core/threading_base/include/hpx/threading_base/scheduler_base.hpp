@@ -12,6 +12,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -19,17 +20,20 @@
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
+#include <hpx/threading_base/timer_wheel.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/coroutines/detail/tss.hpp>
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -52,7 +56,7 @@ namespace hpx { namespace threads { namespace policies {
             thread_queue_init_parameters thread_queue_init = {},
             scheduler_mode mode = nothing_special);
 
-        virtual ~scheduler_base() = default;
+        virtual ~scheduler_base();
 
         threads::thread_pool_base* get_parent_pool()
         {
@@ -84,9 +88,50 @@ namespace hpx { namespace threads { namespace policies {
         void idle_callback(std::size_t num_thread);
 
         /// This function gets called by the thread-manager whenever new work
-        /// has been added, allowing the scheduler to reactivate one or more of
-        /// possibly idling OS threads
-        void do_some_work(std::size_t);
+        /// has been added, allowing the scheduler to reactivate one of the
+        /// possibly idling OS threads. The given thread is woken up if it is
+        /// idling, otherwise any other idling thread is woken up.
+        void do_some_work(std::size_t num_thread);
+
+        /// Wake up all idling OS threads, this is used whenever the state of
+        /// the scheduler changes.
+        void do_some_work_all();
+
+        // statistics about idling OS threads
+        std::int64_t get_idle_park_count(std::size_t num_thread, bool reset);
+        std::int64_t get_idle_unpark_count(std::size_t num_thread, bool reset);
+        std::int64_t get_idle_wake_latency(std::size_t num_thread, bool reset);
+
+        /// Arm the given timer on the timer wheel of the calling OS thread
+        /// (or of the first OS thread if called from outside of this
+        /// scheduler). The timer is fired by the scheduling loop. Timers
+        /// which are overdue because all OS threads are busy (or the pool is
+        /// suspended) are fired by a separate fallback thread.
+        void arm_timer(threads::detail::timer_wheel::entry& e,
+            std::chrono::steady_clock::time_point deadline,
+            threads::detail::timer_wheel::callback_type&& f);
+
+        /// Cancel the given timer, returns false if it has fired already.
+        static bool cancel_timer(threads::detail::timer_wheel::entry& e)
+        {
+            return threads::detail::timer_wheel::cancel(e);
+        }
+
+        /// Fire all expired timers of the given OS thread. If steal is true,
+        /// expired timers of all other OS threads are fired as well (unless
+        /// their timer wheels are being processed concurrently).
+        std::size_t process_timers(std::size_t num_thread, bool steal = false);
+
+        /// Return the earliest time at which any of the armed timers may fire
+        std::chrono::steady_clock::time_point get_next_timer_expiry() const;
+
+        // statistics about timers
+        std::int64_t get_timers_armed_count(std::size_t num_thread, bool reset);
+        std::int64_t get_timers_fired_count(std::size_t num_thread, bool reset);
+        std::int64_t get_timers_cancelled_count(
+            std::size_t num_thread, bool reset);
+        std::int64_t get_timer_lateness(std::size_t num_thread, bool reset);
+        std::int64_t get_timer_overhead(std::size_t num_thread, bool reset);
 
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
@@ -237,6 +282,14 @@ namespace hpx { namespace threads { namespace policies {
             std::size_t num_thread = std::size_t(-1)) const = 0;
         virtual std::int64_t get_average_task_wait_time(
             std::size_t num_thread = std::size_t(-1)) const = 0;
+
+        // merge the distribution of wait times of the referenced queue(s)
+        // into the given histogram, throws if the scheduler does not keep
+        // track of the distribution
+        virtual void get_thread_wait_time_histogram(std::size_t num_thread,
+            util::log_histogram& result, bool reset);
+        virtual void get_task_wait_time_histogram(std::size_t num_thread,
+            util::log_histogram& result, bool reset);
 #endif
 
         virtual void reset_thread_distribution() {}
@@ -316,18 +369,6 @@ namespace hpx { namespace threads { namespace policies {
         // the scheduler mode, protected from false sharing
         util::cache_line_data<std::atomic<scheduler_mode>> mode_;
 
-#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        // support for suspension on idle queues
-        pu_mutex_type mtx_;
-        std::condition_variable cond_;
-        struct idle_backoff_data
-        {
-            std::uint32_t wait_count_;
-            double max_idle_backoff_time_;
-        };
-        std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
-#endif
-
         // support for suspension of pus
         std::vector<pu_mutex_type> suspend_mtxs_;
         std::vector<std::condition_variable> suspend_conds_;
@@ -347,6 +388,71 @@ namespace hpx { namespace threads { namespace policies {
         std::atomic<polling_function_ptr> polling_function_mpi_;
         std::atomic<polling_function_ptr> polling_function_cuda_;
 
+        // every OS thread owns a timer wheel, the wheels are advanced by the
+        // scheduling loop
+        struct timer_data
+        {
+            threads::detail::timer_wheel wheel_;
+
+            // statistics
+            std::int64_t reset_armed_count_ = 0;
+            std::int64_t reset_fired_count_ = 0;
+            std::int64_t reset_cancelled_count_ = 0;
+            std::int64_t reset_lateness_ = 0;
+            std::int64_t reset_lateness_count_ = 0;
+            std::int64_t reset_overhead_ = 0;
+            std::int64_t reset_overhead_count_ = 0;
+        };
+
+        std::vector<util::cache_line_data<timer_data>> timers_;
+
+        // the fallback thread fires timers which have not been fired by the
+        // scheduling loop within timer_fallback_delay after their deadline
+        void timer_fallback_loop();
+
+        std::once_flag timer_fallback_started_;
+        std::thread timer_fallback_thread_;
+        std::mutex timer_fallback_mtx_;
+        std::condition_variable timer_fallback_cond_;
+        bool timer_fallback_stop_;
+
+        // the time at which the fallback thread wakes up next
+        std::atomic<std::chrono::steady_clock::rep> timer_fallback_deadline_;
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // support for suspension on idle queues, every OS thread waits on its
+        // own condition variable which allows to wake up exactly one of them
+        struct idle_backoff_data
+        {
+            std::uint32_t wait_count_ = 0;
+            double max_idle_backoff_time_ = 0;
+
+            // set while the OS thread is parked, reset by whoever wakes it
+            std::atomic<bool> parked_{false};
+            std::atomic<std::int64_t> wake_time_{0};
+
+            pu_mutex_type mtx_;
+            std::condition_variable cond_;
+
+            // statistics
+            std::atomic<std::int64_t> park_count_{0};
+            std::atomic<std::int64_t> unpark_count_{0};
+            std::atomic<std::int64_t> wake_latency_{0};
+            std::int64_t reset_park_count_ = 0;
+            std::int64_t reset_unpark_count_ = 0;
+            std::int64_t reset_wake_latency_ = 0;
+            std::int64_t reset_wake_latency_count_ = 0;
+        };
+
+        bool has_idle_work(std::size_t num_thread) const;
+        void park(std::size_t num_thread, idle_backoff_data& data,
+            std::chrono::nanoseconds period);
+        bool unpark(idle_backoff_data& data);
+
+        std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+        util::cache_line_data<std::atomic<std::size_t>> parked_count_;
+#endif
+
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
     public:
         // manage scheduler-local data
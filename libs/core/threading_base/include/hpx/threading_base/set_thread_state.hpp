@@ -18,6 +18,7 @@
 #include <hpx/threading_base/create_work.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/timer_wheel.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
 #include <boost/asio/basic_waitable_timer.hpp>
@@ -346,7 +347,7 @@ namespace hpx { namespace threads { namespace detail {
 
         // create a new thread in suspended state, which will execute the
         // requested set_state when timer fires and will re-awaken this thread,
-        // allowing the deadline_timer to go out of scope gracefully
+        // allowing the timer to go out of scope gracefully
         thread_id_type self_id = get_self_id();
 
         std::shared_ptr<std::atomic<bool>> triggered(
@@ -361,28 +362,15 @@ namespace hpx { namespace threads { namespace detail {
         thread_id_type wake_id = invalid_thread_id;
         create_thread(&scheduler, data, wake_id);
 
-        // create timer firing in correspondence with given time
-        using deadline_timer =
-            boost::asio::basic_waitable_timer<util::steady_clock>;
-
-        boost::asio::io_service* s = get_default_timer_service();
-        HPX_ASSERT(s);
-        deadline_timer t(*s, abs_time);
-
-        // let the timer invoke the set_state on the new (suspended) thread
-        t.async_wait([wake_id, priority, retry_on_active](
-                         const boost::system::error_code& ec) {
-            if (ec.value() == boost::system::errc::operation_canceled)
-            {
-                detail::set_thread_state(wake_id, pending, wait_abort, priority,
-                    thread_schedule_hint(), retry_on_active, throws);
-            }
-            else
-            {
+        // create timer firing in correspondence with given time, the timer
+        // is fired by the scheduling loop of one of the worker threads
+        timer_wheel::entry t;
+        scheduler.arm_timer(
+            t, abs_time, [wake_id, priority, retry_on_active]() {
+                error_code ec(lightweight);    // do not throw
                 detail::set_thread_state(wake_id, pending, wait_timeout,
-                    priority, thread_schedule_hint(), retry_on_active, throws);
-            }
-        });
+                    priority, thread_schedule_hint(), retry_on_active, ec);
+            });
 
         if (started != nullptr)
             started->store(true);
@@ -398,14 +386,19 @@ namespace hpx { namespace threads { namespace detail {
         if (wait_timeout != statex)    //-V601
         {
             triggered->store(true);
-            // wake_timer_thread has not been executed yet, cancel timer
-            t.cancel();
         }
         else
         {
             detail::set_thread_state(thrd, newstate, newstate_ex, priority);
         }
 
+        // wake_timer_thread has not been executed yet, cancel timer
+        if (scheduler.cancel_timer(t))
+        {
+            detail::set_thread_state(wake_id, pending, wait_abort, priority,
+                thread_schedule_hint(), retry_on_active, throws);
+        }
+
         return thread_result_type(terminated, invalid_thread_id);
     }
 
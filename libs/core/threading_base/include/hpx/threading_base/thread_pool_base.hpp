@@ -12,6 +12,7 @@
 #include <hpx/concurrency/barrier.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 #include <hpx/threading_base/callback_notifier.hpp>
 #include <hpx/threading_base/network_background_callback.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
@@ -284,6 +285,13 @@ namespace hpx { namespace threads {
         {
             return 0;
         }
+        // merge the distribution of thread phase durations [ns] into the
+        // given histogram
+        virtual void get_thread_phase_duration_histogram(
+            std::size_t /*thread_num*/, util::log_histogram& /*result*/,
+            bool /*reset*/)
+        {
+        }
         virtual std::int64_t get_thread_duration(
             std::size_t /*thread_num*/, bool /*reset*/)
         {
@@ -394,6 +402,14 @@ namespace hpx { namespace threads {
         {
             return 0;
         }
+
+        // merge the distribution of thread (task) wait times [ns] into the
+        // given histogram, throws if the pool does not keep track of the
+        // distribution
+        virtual void get_thread_wait_time_histogram(std::size_t thread_num,
+            util::log_histogram& result, bool reset);
+        virtual void get_task_wait_time_histogram(std::size_t thread_num,
+            util::log_histogram& result, bool reset);
 #endif
 
 #if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
@@ -491,6 +507,48 @@ namespace hpx { namespace threads {
         virtual std::int64_t get_busy_loop_count(
             std::size_t num, bool reset) = 0;
 
+        virtual std::int64_t get_idle_park_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_idle_unpark_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_idle_wake_latency(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_timers_armed_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_timers_fired_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_timers_cancelled_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_timer_lateness(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_timer_overhead(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         virtual bool enumerate_threads(
             util::function_nonser<bool(thread_id_type)> const& /*f*/,
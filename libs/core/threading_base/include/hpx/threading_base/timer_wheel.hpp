@@ -0,0 +1,173 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/functional/unique_function.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The timer_wheel is a hierarchical timing wheel holding the timers of
+    /// one worker thread. Time is divided into ticks of a fixed resolution,
+    /// each level of the wheel has 64 slots, every slot of a level covers
+    /// 64 slots of the level below. A timer is stored in the slot of the
+    /// highest level in which its tick differs from the current tick and
+    /// moves down one or more levels whenever the current tick reaches that
+    /// slot. Arming and cancelling a timer are O(1), all timers expiring
+    /// during the same tick are fired together.
+    ///
+    /// Timers never fire before their deadline, they fire at most one tick
+    /// (plus the time it takes to poll the wheel) late.
+    class HPX_CORE_EXPORT timer_wheel
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+        using time_point = clock_type::time_point;
+
+        /// The callback is invoked once the timer expired, it is not invoked
+        /// if the timer was cancelled.
+        using callback_type = util::unique_function_nonser<void()>;
+
+        static constexpr std::size_t slot_bits = 6;
+        static constexpr std::size_t num_slots = std::size_t(1) << slot_bits;
+        static constexpr std::size_t num_levels = 4;
+
+        // default duration of one tick of the wheel [ns]
+        static constexpr std::int64_t default_resolution = 100000;
+
+        /// A timer armed on a timer_wheel. The entry is owned by the code
+        /// arming the timer and has to be kept alive until the timer either
+        /// fired or was cancelled successfully.
+        class entry
+        {
+        public:
+            entry() = default;
+
+            HPX_NON_COPYABLE(entry);
+
+            ~entry();
+
+        private:
+            friend class timer_wheel;
+
+            timer_wheel* wheel_ = nullptr;
+            entry* prev_ = nullptr;
+            entry* next_ = nullptr;
+            std::uint64_t tick_ = 0;
+            time_point deadline_;
+            callback_type callback_;
+            std::uint8_t level_ = not_linked;
+            std::uint8_t slot_ = 0;
+        };
+
+        explicit timer_wheel(std::int64_t resolution = default_resolution);
+
+        HPX_NON_COPYABLE(timer_wheel);
+
+        ~timer_wheel();
+
+        /// Arm the given timer to invoke the given function once the
+        /// deadline has been reached.
+        void arm(entry& e, time_point deadline, callback_type&& f);
+
+        /// Cancel the given timer. Returns true if the timer was removed
+        /// before it fired, false if it has fired already (or is firing).
+        static bool cancel(entry& e);
+
+        /// Fire all timers whose deadline has been reached at the given
+        /// time. Returns the number of fired timers. If try_lock is true,
+        /// nothing is done if another thread is advancing the wheel.
+        std::size_t advance(time_point now, bool try_lock = false);
+
+        /// Return whether no timer is armed
+        bool empty() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed) == 0;
+        }
+
+        /// Return the earliest time at which any of the armed timers may fire
+        time_point next_expiry() const noexcept
+        {
+            return time_point(clock_type::duration(
+                next_expiry_.load(std::memory_order_relaxed)));
+        }
+
+        // statistics
+        std::int64_t get_armed_count() const noexcept
+        {
+            return armed_.load(std::memory_order_relaxed);
+        }
+        std::int64_t get_fired_count() const noexcept
+        {
+            return fired_.load(std::memory_order_relaxed);
+        }
+        std::int64_t get_cancelled_count() const noexcept
+        {
+            return cancelled_.load(std::memory_order_relaxed);
+        }
+        // accumulated time between the deadlines and the firing of all
+        // fired timers [ns]
+        std::int64_t get_lateness() const noexcept
+        {
+            return lateness_.load(std::memory_order_relaxed);
+        }
+        // accumulated time spent advancing the wheel and firing timers [ns]
+        std::int64_t get_overhead() const noexcept
+        {
+            return overhead_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        static constexpr std::uint8_t not_linked = 0xff;
+        static constexpr std::uint8_t overflow_level = num_levels;
+        static constexpr std::uint8_t due_level = num_levels + 1;
+
+        using mutex_type = hpx::util::spinlock;
+
+        std::uint64_t to_tick(time_point t) const noexcept;
+        time_point to_time_point(std::uint64_t tick) const noexcept;
+
+        entry*& list_head(std::uint8_t level, std::uint8_t slot) noexcept;
+        void link(entry& e) noexcept;
+        void unlink(entry& e) noexcept;
+
+        void cascade(entry*& head);
+        void process_tick(std::uint64_t tick, entry*& fired);
+        void update_next_expiry() noexcept;
+
+        mutable mutex_type mtx_;
+
+        time_point const epoch_;
+        std::int64_t const resolution_;
+        std::uint64_t current_tick_;
+
+        entry* slots_[num_levels][num_slots];
+        std::uint64_t occupied_[num_levels];
+        entry* overflow_;    // timers beyond the range of the top level
+        entry* due_;         // timers which have expired already
+
+        std::atomic<std::size_t> count_;
+        std::atomic<clock_type::rep> next_expiry_;
+
+        std::atomic<std::int64_t> armed_;
+        std::atomic<std::int64_t> fired_;
+        std::atomic<std::int64_t> cancelled_;
+        std::atomic<std::int64_t> lateness_;
+        std::atomic<std::int64_t> overhead_;
+    };
+}}}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -7,11 +7,16 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/threading_base/timer_wheel.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/coroutines/detail/tss.hpp>
 #endif
@@ -29,6 +34,7 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -47,13 +53,19 @@ namespace hpx { namespace threads { namespace policies {
       , background_thread_count_(0)
       , polling_function_mpi_(&null_polling_function)
       , polling_function_cuda_(&null_polling_function)
+      , timers_(num_threads)
+      , timer_fallback_stop_(false)
+      , timer_fallback_deadline_(
+            (std::chrono::steady_clock::duration::max)().count())
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+      , wait_counts_(num_threads)
+#endif
     {
         set_scheduler_mode(mode);
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         double max_time = thread_queue_init.max_idle_backoff_time_;
 
-        wait_counts_.resize(num_threads);
         for (auto&& data : wait_counts_)
         {
             data.data_.wait_count_ = 0;
@@ -65,32 +77,165 @@ namespace hpx { namespace threads { namespace policies {
             states_[i].store(state_initialized);
     }
 
+    scheduler_base::~scheduler_base()
+    {
+        if (timer_fallback_thread_.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> l(timer_fallback_mtx_);
+                timer_fallback_stop_ = true;
+            }
+            timer_fallback_cond_.notify_one();
+            timer_fallback_thread_.join();
+        }
+    }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    namespace {
+        // number of rounds of exponential backoff (each round doubles the
+        // number of pause instructions) before falling back to yielding
+        constexpr std::size_t idle_backoff_pause_rounds = 10;
+
+        // number of times the OS-thread yields before it gets parked
+        constexpr std::size_t idle_backoff_spin_count = 32;
+
+        std::int64_t idle_backoff_now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+    }    // namespace
+
+    bool scheduler_base::has_idle_work(std::size_t num_thread) const
+    {
+        // any work in any of the queues (which could be stolen) or a state
+        // change prevents this OS-thread from going to sleep
+        return states_[num_thread].load(std::memory_order_relaxed) !=
+            state_running ||
+            get_queue_length(std::size_t(-1)) != 0;
+    }
+
+    void scheduler_base::park(std::size_t num_thread, idle_backoff_data& data,
+        std::chrono::nanoseconds period)
+    {
+        std::unique_lock<pu_mutex_type> l(data.mtx_);
+
+        // announce that this thread is about to be parked before checking for
+        // new work one last time, this pairs with the fence in do_some_work
+        data.parked_.store(true);
+        ++parked_count_.data_;
+
+        bool expected = true;
+        if (has_idle_work(num_thread))
+        {
+            // somebody else may have woken us up in the meantime
+            if (data.parked_.compare_exchange_strong(expected, false))
+                --parked_count_.data_;
+            data.wait_count_ = 0;
+            return;
+        }
+
+        ++data.park_count_;
+        data.cond_.wait_for(l, period, [&]() { return !data.parked_.load(); });
+
+        if (data.parked_.compare_exchange_strong(expected, false))
+        {
+            // timed out, nobody has woken us up
+            --parked_count_.data_;
+            return;
+        }
+
+        // we were woken up on new work, restart the backoff sequence
+        data.wait_count_ = 0;
+        ++data.unpark_count_;
+        data.wake_latency_ += idle_backoff_now() -
+            data.wake_time_.load(std::memory_order_acquire);
+    }
+
+    bool scheduler_base::unpark(idle_backoff_data& data)
+    {
+        if (!data.parked_.load(std::memory_order_relaxed))
+            return false;
+
+        // the wake time has to be visible to the parked thread as soon as it
+        // observes the cleared flag, i.e. it is stored before the exchange
+        data.wake_time_.store(idle_backoff_now(), std::memory_order_release);
+
+        bool expected = true;
+        if (!data.parked_.compare_exchange_strong(expected, false))
+            return false;
+
+        --parked_count_.data_;
+
+        // make sure the parked thread is either waiting on the condition
+        // variable or has not checked its predicate yet
+        {
+            std::lock_guard<pu_mutex_type> l(data.mtx_);
+        }
+        data.cond_.notify_one();
+        return true;
+    }
+#endif
+
     void scheduler_base::idle_callback(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
             policies::enable_idle_backoff)
         {
-            // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
-
+            // The idle backoff happens in three stages: exponential backoff
+            // using pause instructions, a bounded number of yields, and
+            // finally parking the OS-thread until new work arrives (or until
+            // an exponentially growing timeout expires).
             idle_backoff_data& data = wait_counts_[num_thread].data_;
 
+            for (std::size_t k = 0; k != idle_backoff_pause_rounds; ++k)
+            {
+                for (std::size_t i = 0; i != (std::size_t(1) << k); ++i)
+                {
+                    HPX_SMT_PAUSE;
+                }
+                if (has_idle_work(num_thread))
+                {
+                    data.wait_count_ = 0;
+                    return;
+                }
+            }
+
+            for (std::size_t k = 0; k != idle_backoff_spin_count; ++k)
+            {
+                std::this_thread::yield();
+                if (has_idle_work(num_thread))
+                {
+                    data.wait_count_ = 0;
+                    return;
+                }
+            }
+
             // Exponential back-off with a maximum sleep time.
             double exponent = (std::min)(double(data.wait_count_),
                 double(std::numeric_limits<double>::max_exponent - 1));
 
-            std::chrono::milliseconds period(std::lround((std::min)(
-                data.max_idle_backoff_time_, std::pow(2.0, exponent))));
+            std::chrono::nanoseconds period = std::chrono::milliseconds(
+                std::lround((std::min)(data.max_idle_backoff_time_,
+                    std::pow(2.0, exponent))));
 
-            ++data.wait_count_;
+            // do not sleep beyond the expiry of the next timer
+            auto const now = std::chrono::steady_clock::now();
+            auto const next_expiry = get_next_timer_expiry();
+            if (next_expiry <= now)
+                return;
 
-            std::unique_lock<pu_mutex_type> l(mtx_);
-            if (cond_.wait_for(l, period) == std::cv_status::no_timeout)
+            if (next_expiry - now < period)
             {
-                // reset counter if thread was woken up
-                data.wait_count_ = 0;
+                period = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    next_expiry - now);
             }
+
+            ++data.wait_count_;
+
+            park(num_thread, data, period);
         }
 #else
         (void) num_thread;
@@ -98,15 +243,377 @@ namespace hpx { namespace threads { namespace policies {
     }
 
     /// This function gets called by the thread-manager whenever new work
-    /// has been added, allowing the scheduler to reactivate one or more of
+    /// has been added, allowing the scheduler to reactivate one of the
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work(std::size_t num_thread)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // the new work has to be visible to a thread which is about to be
+        // parked, this pairs with the store to parked_ in park()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked_count_.data_.load(std::memory_order_relaxed) == 0)
+            return;
+
+        // wake up exactly one thread, preferring the given one
+        std::size_t const size = wait_counts_.size();
+        std::size_t const first = num_thread < size ? num_thread : 0;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            if (unpark(wait_counts_[(first + i) % size].data_))
+                return;
+        }
+#else
+        (void) num_thread;
+#endif
+    }
+
+    void scheduler_base::do_some_work_all()
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (auto&& data : wait_counts_)
+        {
+            unpark(data.data_);
+        }
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+        std::int64_t get_and_reset_value(
+            std::int64_t value, std::int64_t& last_value, bool reset)
+        {
+            std::int64_t const delta = value - last_value;
+            if (reset)
+                last_value = value;
+            return delta;
+        }
+
+        std::int64_t get_and_reset_value(std::atomic<std::int64_t> const& value,
+            std::int64_t& last_value, bool reset)
+        {
+            return get_and_reset_value(
+                value.load(std::memory_order_relaxed), last_value, reset);
+        }
+    }    // namespace
+
+    std::int64_t scheduler_base::get_idle_park_count(
+        std::size_t num_thread, bool reset)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        if (num_thread == std::size_t(-1))
+        {
+            std::int64_t result = 0;
+            for (std::size_t i = 0; i != wait_counts_.size(); ++i)
+                result += get_idle_park_count(i, reset);
+            return result;
+        }
+
+        idle_backoff_data& data = wait_counts_[num_thread].data_;
+        return get_and_reset_value(
+            data.park_count_, data.reset_park_count_, reset);
+#else
+        (void) num_thread;
+        (void) reset;
+        return 0;
+#endif
+    }
+
+    std::int64_t scheduler_base::get_idle_unpark_count(
+        std::size_t num_thread, bool reset)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        cond_.notify_all();
+        if (num_thread == std::size_t(-1))
+        {
+            std::int64_t result = 0;
+            for (std::size_t i = 0; i != wait_counts_.size(); ++i)
+                result += get_idle_unpark_count(i, reset);
+            return result;
+        }
+
+        idle_backoff_data& data = wait_counts_[num_thread].data_;
+        return get_and_reset_value(
+            data.unpark_count_, data.reset_unpark_count_, reset);
+#else
+        (void) num_thread;
+        (void) reset;
+        return 0;
+#endif
+    }
+
+    // average time between waking up a parked thread and the thread resuming
+    // its scheduling loop [ns]
+    std::int64_t scheduler_base::get_idle_wake_latency(
+        std::size_t num_thread, bool reset)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t latency = 0;
+        std::int64_t count = 0;
+
+        std::size_t first = num_thread;
+        std::size_t last = num_thread + 1;
+        if (num_thread == std::size_t(-1))
+        {
+            first = 0;
+            last = wait_counts_.size();
+        }
+
+        for (std::size_t i = first; i != last; ++i)
+        {
+            idle_backoff_data& data = wait_counts_[i].data_;
+            latency += get_and_reset_value(
+                data.wake_latency_, data.reset_wake_latency_, reset);
+            count += get_and_reset_value(
+                data.unpark_count_, data.reset_wake_latency_count_, reset);
+        }
+
+        return count == 0 ? 0 : latency / count;
+#else
+        (void) num_thread;
+        (void) reset;
+        return 0;
 #endif
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+        // time after the deadline of a timer at which the fallback thread
+        // fires it if no OS thread got around to doing so
+        constexpr std::chrono::milliseconds timer_fallback_delay(1);
+    }    // namespace
+
+    void scheduler_base::arm_timer(threads::detail::timer_wheel::entry& e,
+        std::chrono::steady_clock::time_point deadline,
+        threads::detail::timer_wheel::callback_type&& f)
+    {
+        // timers are armed on the wheel of the calling OS thread, this keeps
+        // arming and firing of most timers local to one thread
+        std::size_t num_thread = hpx::get_local_worker_thread_num();
+        thread_data* self = threads::get_self_id_data();
+        bool const is_local = num_thread < timers_.size() &&
+            self != nullptr && self->get_scheduler_base() == this;
+        if (!is_local)
+            num_thread = 0;
+
+        timers_[num_thread].data_.wheel_.arm(e, deadline, std::move(f));
+
+        // make sure a possibly parked OS thread recomputes its timeout
+        if (!is_local)
+            do_some_work(num_thread);
+
+        // wake the fallback thread if it would fire this timer too late, the
+        // fence pairs with the one in timer_fallback_loop: either we see its
+        // new deadline or it sees the newly armed timer
+        std::call_once(timer_fallback_started_, [this]() {
+            timer_fallback_thread_ =
+                std::thread(&scheduler_base::timer_fallback_loop, this);
+        });
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if ((deadline + timer_fallback_delay).time_since_epoch().count() <
+            timer_fallback_deadline_.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> l(timer_fallback_mtx_);
+            timer_fallback_cond_.notify_one();
+        }
+    }
+
+    void scheduler_base::timer_fallback_loop()
+    {
+        using clock_type = std::chrono::steady_clock;
+
+        std::unique_lock<std::mutex> l(timer_fallback_mtx_);
+        while (!timer_fallback_stop_)
+        {
+            timer_fallback_deadline_.store(
+                (clock_type::duration::max)().count(),
+                std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            auto const next_expiry = get_next_timer_expiry();
+            if (next_expiry == (clock_type::time_point::max)())
+            {
+                timer_fallback_cond_.wait(l);
+                continue;
+            }
+
+            // the scheduling loop fires timers in time as long as at least
+            // one OS thread is idle, leave it some slack before stepping in
+            auto const wakeup = next_expiry + timer_fallback_delay;
+            timer_fallback_deadline_.store(
+                wakeup.time_since_epoch().count(), std::memory_order_relaxed);
+
+            if (timer_fallback_cond_.wait_until(l, wakeup) !=
+                std::cv_status::timeout)
+            {
+                continue;
+            }
+
+            // timer callbacks may arm new timers, don't hold the lock
+            l.unlock();
+
+            auto const now = clock_type::now();
+            for (auto& data : timers_)
+            {
+                threads::detail::timer_wheel& wheel = data.data_.wheel_;
+                if (!wheel.empty())
+                    wheel.advance(now, true);
+            }
+
+            l.lock();
+        }
+    }
+
+    std::size_t scheduler_base::process_timers(
+        std::size_t num_thread, bool steal)
+    {
+        std::size_t const size = timers_.size();
+        HPX_ASSERT(num_thread < size);
+
+        std::size_t fired = 0;
+        auto now = std::chrono::steady_clock::time_point();
+
+        threads::detail::timer_wheel& wheel = timers_[num_thread].data_.wheel_;
+        if (!wheel.empty())
+        {
+            now = std::chrono::steady_clock::now();
+            fired = wheel.advance(now);
+        }
+
+        // idle OS threads take care of the expired timers of busy ones
+        if (steal)
+        {
+            for (std::size_t i = 1; i != size; ++i)
+            {
+                threads::detail::timer_wheel& other =
+                    timers_[(num_thread + i) % size].data_.wheel_;
+                if (other.empty())
+                    continue;
+
+                if (now == std::chrono::steady_clock::time_point())
+                    now = std::chrono::steady_clock::now();
+                fired += other.advance(now, true);
+            }
+        }
+
+        return fired;
+    }
+
+    std::chrono::steady_clock::time_point
+    scheduler_base::get_next_timer_expiry() const
+    {
+        auto result = (std::chrono::steady_clock::time_point::max)();
+        for (auto const& data : timers_)
+        {
+            threads::detail::timer_wheel const& wheel = data.data_.wheel_;
+            if (!wheel.empty())
+                result = (std::min)(result, wheel.next_expiry());
+        }
+        return result;
+    }
+
+    std::int64_t scheduler_base::get_timers_armed_count(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread == std::size_t(-1))
+        {
+            std::int64_t result = 0;
+            for (std::size_t i = 0; i != timers_.size(); ++i)
+                result += get_timers_armed_count(i, reset);
+            return result;
+        }
+
+        timer_data& data = timers_[num_thread].data_;
+        return get_and_reset_value(data.wheel_.get_armed_count(),
+            data.reset_armed_count_, reset);
+    }
+
+    std::int64_t scheduler_base::get_timers_fired_count(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread == std::size_t(-1))
+        {
+            std::int64_t result = 0;
+            for (std::size_t i = 0; i != timers_.size(); ++i)
+                result += get_timers_fired_count(i, reset);
+            return result;
+        }
+
+        timer_data& data = timers_[num_thread].data_;
+        return get_and_reset_value(data.wheel_.get_fired_count(),
+            data.reset_fired_count_, reset);
+    }
+
+    std::int64_t scheduler_base::get_timers_cancelled_count(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread == std::size_t(-1))
+        {
+            std::int64_t result = 0;
+            for (std::size_t i = 0; i != timers_.size(); ++i)
+                result += get_timers_cancelled_count(i, reset);
+            return result;
+        }
+
+        timer_data& data = timers_[num_thread].data_;
+        return get_and_reset_value(data.wheel_.get_cancelled_count(),
+            data.reset_cancelled_count_, reset);
+    }
+
+    // average time between the deadline of a timer and its firing [ns]
+    std::int64_t scheduler_base::get_timer_lateness(
+        std::size_t num_thread, bool reset)
+    {
+        std::int64_t lateness = 0;
+        std::int64_t count = 0;
+
+        std::size_t first = num_thread;
+        std::size_t last = num_thread + 1;
+        if (num_thread == std::size_t(-1))
+        {
+            first = 0;
+            last = timers_.size();
+        }
+
+        for (std::size_t i = first; i != last; ++i)
+        {
+            timer_data& data = timers_[i].data_;
+            lateness += get_and_reset_value(
+                data.wheel_.get_lateness(), data.reset_lateness_, reset);
+            count += get_and_reset_value(data.wheel_.get_fired_count(),
+                data.reset_lateness_count_, reset);
+        }
+
+        return count == 0 ? 0 : lateness / count;
+    }
+
+    // average time spent advancing the timer wheels per fired timer [ns]
+    std::int64_t scheduler_base::get_timer_overhead(
+        std::size_t num_thread, bool reset)
+    {
+        std::int64_t overhead = 0;
+        std::int64_t count = 0;
+
+        std::size_t first = num_thread;
+        std::size_t last = num_thread + 1;
+        if (num_thread == std::size_t(-1))
+        {
+            first = 0;
+            last = timers_.size();
+        }
+
+        for (std::size_t i = first; i != last; ++i)
+        {
+            timer_data& data = timers_[i].data_;
+            overhead += get_and_reset_value(
+                data.wheel_.get_overhead(), data.reset_overhead_, reset);
+            count += get_and_reset_value(data.wheel_.get_fired_count(),
+                data.reset_overhead_count_, reset);
+        }
+
+        return count == 0 ? 0 : overhead / count;
+    }
+
     void scheduler_base::suspend(std::size_t num_thread)
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
@@ -253,6 +760,9 @@ namespace hpx { namespace threads { namespace policies {
         {
             state.store(s);
         }
+
+        // make sure no OS thread keeps waiting
+        do_some_work_all();
     }
 
     void scheduler_base::set_all_states_at_least(hpx::state s)
@@ -265,6 +775,9 @@ namespace hpx { namespace threads { namespace policies {
                 state.store(s);
             }
         }
+
+        // make sure no OS thread keeps waiting
+        do_some_work_all();
     }
 
     // return whether all states are at least at the given one
@@ -311,7 +824,7 @@ namespace hpx { namespace threads { namespace policies {
     {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
-        do_some_work(std::size_t(-1));
+        do_some_work_all();
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode)
@@ -363,6 +876,31 @@ namespace hpx { namespace threads { namespace policies {
         --background_thread_count_;
     }
 
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+    ///////////////////////////////////////////////////////////////////////////
+    void scheduler_base::get_thread_wait_time_histogram(
+        std::size_t, util::log_histogram&, bool)
+    {
+        HPX_THROW_EXCEPTION(not_implemented,
+            "scheduler_base::get_thread_wait_time_histogram",
+            hpx::util::format(
+                "the scheduler '{}' does not record the wait time "
+                "distribution of its threads",
+                description_));
+    }
+
+    void scheduler_base::get_task_wait_time_histogram(
+        std::size_t, util::log_histogram&, bool)
+    {
+        HPX_THROW_EXCEPTION(not_implemented,
+            "scheduler_base::get_task_wait_time_histogram",
+            hpx::util::format(
+                "the scheduler '{}' does not record the wait time "
+                "distribution of its tasks",
+                description_));
+    }
+#endif
+
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
     coroutines::detail::tss_data_node* scheduler_base::find_tss_data(
         void const* key)
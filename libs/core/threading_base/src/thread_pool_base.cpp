@@ -89,6 +89,27 @@ namespace hpx { namespace threads {
     }
 #endif
 
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+    ///////////////////////////////////////////////////////////////////////////
+    void thread_pool_base::get_thread_wait_time_histogram(
+        std::size_t, util::log_histogram&, bool)
+    {
+        HPX_THROW_EXCEPTION(not_implemented,
+            "thread_pool_base::get_thread_wait_time_histogram",
+            "the thread pool '" + id_.name() +
+                "' does not record the wait time distribution of its threads");
+    }
+
+    void thread_pool_base::get_task_wait_time_histogram(
+        std::size_t, util::log_histogram&, bool)
+    {
+        HPX_THROW_EXCEPTION(not_implemented,
+            "thread_pool_base::get_task_wait_time_histogram",
+            "the thread pool '" + id_.name() +
+                "' does not record the wait time distribution of its tasks");
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     void thread_pool_base::init_pool_time_scale()
     {
@@ -0,0 +1,431 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/threading_base/timer_wheel.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace threads { namespace detail {
+
+    constexpr std::size_t timer_wheel::slot_bits;
+    constexpr std::size_t timer_wheel::num_slots;
+    constexpr std::size_t timer_wheel::num_levels;
+    constexpr std::int64_t timer_wheel::default_resolution;
+    constexpr std::uint8_t timer_wheel::not_linked;
+    constexpr std::uint8_t timer_wheel::overflow_level;
+    constexpr std::uint8_t timer_wheel::due_level;
+
+    namespace {
+
+        // index of the most significant bit set in the given (non-zero)
+        // value
+        inline std::size_t most_significant_bit(std::uint64_t value) noexcept
+        {
+            HPX_ASSERT(value != 0);
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return 63 - static_cast<std::size_t>(__builtin_clzll(value));
+#else
+            std::size_t result = 0;
+            while (value >>= 1)
+                ++result;
+            return result;
+#endif
+        }
+
+        // index of the least significant bit set in the given (non-zero)
+        // value
+        inline std::size_t least_significant_bit(std::uint64_t value) noexcept
+        {
+            HPX_ASSERT(value != 0);
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+            std::size_t result = 0;
+            while ((value & 1) == 0)
+            {
+                value >>= 1;
+                ++result;
+            }
+            return result;
+#endif
+        }
+
+        constexpr std::uint64_t low_bits_mask(std::size_t bits) noexcept
+        {
+            return bits >= 64 ? ~std::uint64_t(0) :
+                                (std::uint64_t(1) << bits) - 1;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_wheel::entry::~entry()
+    {
+        // the timer must have fired or must have been cancelled
+        HPX_ASSERT(level_ == not_linked);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_wheel::timer_wheel(std::int64_t resolution)
+      : epoch_(clock_type::now())
+      , resolution_(resolution > 0 ? resolution : default_resolution)
+      , current_tick_(0)
+      , overflow_(nullptr)
+      , due_(nullptr)
+      , count_(0)
+      , next_expiry_((std::numeric_limits<clock_type::rep>::max)())
+      , armed_(0)
+      , fired_(0)
+      , cancelled_(0)
+      , lateness_(0)
+      , overhead_(0)
+    {
+        for (std::size_t level = 0; level != num_levels; ++level)
+        {
+            occupied_[level] = 0;
+            for (std::size_t slot = 0; slot != num_slots; ++slot)
+                slots_[level][slot] = nullptr;
+        }
+    }
+
+    timer_wheel::~timer_wheel() = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t timer_wheel::to_tick(time_point t) const noexcept
+    {
+        // round up, a timer must never fire before its deadline
+        std::int64_t const ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(t - epoch_)
+                .count();
+        if (ns <= 0)
+            return 0;
+        return static_cast<std::uint64_t>((ns + resolution_ - 1) / resolution_);
+    }
+
+    timer_wheel::time_point timer_wheel::to_time_point(
+        std::uint64_t tick) const noexcept
+    {
+        return epoch_ +
+            std::chrono::duration_cast<clock_type::duration>(
+                std::chrono::nanoseconds(
+                    static_cast<std::int64_t>(tick) * resolution_));
+    }
+
+    timer_wheel::entry*& timer_wheel::list_head(
+        std::uint8_t level, std::uint8_t slot) noexcept
+    {
+        if (level == due_level)
+            return due_;
+        if (level == overflow_level)
+            return overflow_;
+        return slots_[level][slot];
+    }
+
+    // Store the entry in the slot of the highest level in which its tick
+    // differs from the current tick (or in the list of expired timers).
+    void timer_wheel::link(entry& e) noexcept
+    {
+        if (e.tick_ <= current_tick_)
+        {
+            e.level_ = due_level;
+            e.slot_ = 0;
+        }
+        else
+        {
+            std::size_t const level =
+                most_significant_bit(e.tick_ ^ current_tick_) / slot_bits;
+            if (level >= num_levels)
+            {
+                e.level_ = overflow_level;
+                e.slot_ = 0;
+            }
+            else
+            {
+                e.level_ = static_cast<std::uint8_t>(level);
+                e.slot_ = static_cast<std::uint8_t>(
+                    (e.tick_ >> (level * slot_bits)) & (num_slots - 1));
+                occupied_[level] |= std::uint64_t(1) << e.slot_;
+            }
+        }
+
+        entry*& head = list_head(e.level_, e.slot_);
+        e.prev_ = nullptr;
+        e.next_ = head;
+        if (head != nullptr)
+            head->prev_ = &e;
+        head = &e;
+    }
+
+    void timer_wheel::unlink(entry& e) noexcept
+    {
+        HPX_ASSERT(e.level_ != not_linked);
+
+        entry*& head = list_head(e.level_, e.slot_);
+        if (e.prev_ != nullptr)
+            e.prev_->next_ = e.next_;
+        else
+            head = e.next_;
+        if (e.next_ != nullptr)
+            e.next_->prev_ = e.prev_;
+
+        if (head == nullptr && e.level_ < num_levels)
+            occupied_[e.level_] &= ~(std::uint64_t(1) << e.slot_);
+
+        e.prev_ = e.next_ = nullptr;
+        e.level_ = not_linked;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void timer_wheel::arm(entry& e, time_point deadline, callback_type&& f)
+    {
+        HPX_ASSERT(e.level_ == not_linked);
+
+        e.wheel_ = this;
+        e.deadline_ = deadline;
+        e.tick_ = to_tick(deadline);
+        e.callback_ = std::move(f);
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        link(e);
+        ++count_;
+        ++armed_;
+
+        // the new timer may expire before all others
+        std::uint64_t const tick =
+            e.tick_ > current_tick_ ? e.tick_ : current_tick_;
+        clock_type::rep const expiry =
+            to_time_point(tick).time_since_epoch().count();
+        if (expiry < next_expiry_.load(std::memory_order_relaxed))
+            next_expiry_.store(expiry, std::memory_order_relaxed);
+    }
+
+    bool timer_wheel::cancel(entry& e)
+    {
+        timer_wheel* wheel = e.wheel_;
+        if (wheel == nullptr)
+            return false;
+
+        std::lock_guard<mutex_type> l(wheel->mtx_);
+        if (e.level_ == not_linked)
+            return false;    // fired already
+
+        wheel->unlink(e);
+        e.callback_.reset();
+
+        --wheel->count_;
+        ++wheel->cancelled_;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Re-insert all timers of the given list, this moves them to a lower
+    // level of the wheel (or to the list of expired timers).
+    void timer_wheel::cascade(entry*& head)
+    {
+        entry* e = head;
+        head = nullptr;
+        while (e != nullptr)
+        {
+            entry* next = e->next_;
+            e->level_ = not_linked;
+            link(*e);
+            e = next;
+        }
+    }
+
+    void timer_wheel::process_tick(std::uint64_t tick, entry*& fired)
+    {
+        current_tick_ = tick;
+
+        // timers beyond the range of the top level are re-inserted whenever
+        // the top level wraps around
+        if ((tick & low_bits_mask(num_levels * slot_bits)) == 0 &&
+            overflow_ != nullptr)
+        {
+            cascade(overflow_);
+        }
+
+        // move the timers of all slots reached by the current tick one or
+        // more levels down, starting with the highest level
+        for (std::size_t level = num_levels - 1; level != 0; --level)
+        {
+            if ((tick & low_bits_mask(level * slot_bits)) != 0)
+                continue;
+
+            std::size_t const slot =
+                (tick >> (level * slot_bits)) & (num_slots - 1);
+            if (slots_[level][slot] != nullptr)
+            {
+                occupied_[level] &= ~(std::uint64_t(1) << slot);
+                cascade(slots_[level][slot]);
+            }
+        }
+
+        // all timers in the current slot of the lowest level have expired
+        std::size_t const slot = tick & (num_slots - 1);
+        if (slots_[0][slot] != nullptr)
+        {
+            occupied_[0] &= ~(std::uint64_t(1) << slot);
+            cascade(slots_[0][slot]);
+        }
+
+        // collect all expired timers
+        while (due_ != nullptr)
+        {
+            entry* e = due_;
+            unlink(*e);
+            e->next_ = fired;
+            fired = e;
+        }
+    }
+
+    // Compute the earliest tick at which any of the armed timers may fire.
+    // The slots of the lowest non-empty level are reached first.
+    void timer_wheel::update_next_expiry() noexcept
+    {
+        std::uint64_t tick = (std::numeric_limits<std::uint64_t>::max)();
+        if (due_ != nullptr)
+        {
+            tick = current_tick_;
+        }
+        else
+        {
+            std::size_t level = 0;
+            while (level != num_levels && occupied_[level] == 0)
+                ++level;
+
+            if (level != num_levels)
+            {
+                // all occupied slots are beyond the current one
+                std::size_t const shift = level * slot_bits;
+                std::size_t const current =
+                    (current_tick_ >> shift) & (num_slots - 1);
+                std::uint64_t const later = current + 1 == num_slots ?
+                    0 :
+                    occupied_[level] & ~low_bits_mask(current + 1);
+                HPX_ASSERT(later != 0);
+
+                std::uint64_t const base =
+                    current_tick_ & ~low_bits_mask(shift + slot_bits);
+                tick = base |
+                    (std::uint64_t(least_significant_bit(later)) << shift);
+            }
+            else if (overflow_ != nullptr)
+            {
+                // the top level wraps around next
+                tick = (current_tick_ |
+                           low_bits_mask(num_levels * slot_bits)) +
+                    1;
+            }
+        }
+
+        next_expiry_.store(
+            tick == (std::numeric_limits<std::uint64_t>::max)() ?
+                (std::numeric_limits<clock_type::rep>::max)() :
+                to_time_point(tick).time_since_epoch().count(),
+            std::memory_order_relaxed);
+    }
+
+    std::size_t timer_wheel::advance(time_point now, bool try_lock)
+    {
+        if (empty() || now < next_expiry())
+            return 0;
+
+        time_point const start = clock_type::now();
+
+        std::vector<callback_type> callbacks;
+        {
+            std::unique_lock<mutex_type> l(mtx_, std::defer_lock);
+            if (try_lock)
+            {
+                if (!l.try_lock())
+                    return 0;
+            }
+            else
+            {
+                l.lock();
+            }
+
+            // the tick which has been completely reached at the given time
+            std::int64_t const ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    now - epoch_)
+                    .count();
+            std::uint64_t const target =
+                ns <= 0 ? 0 : static_cast<std::uint64_t>(ns / resolution_);
+
+            entry* fired = nullptr;
+            if (due_ != nullptr)
+                process_tick(current_tick_, fired);
+
+            while (current_tick_ < target)
+            {
+                // skip all ticks which do not reach any occupied slot
+                std::uint64_t next = current_tick_ + 1;
+                if (occupied_[0] == 0)
+                {
+                    std::size_t level = 1;
+                    while (level != num_levels && occupied_[level] == 0)
+                        ++level;
+
+                    if (level == num_levels && overflow_ == nullptr)
+                    {
+                        current_tick_ = target;
+                        break;
+                    }
+                    next = (current_tick_ | low_bits_mask(level * slot_bits)) +
+                        1;
+                    if (next > target)
+                    {
+                        current_tick_ = target;
+                        break;
+                    }
+                }
+                process_tick(next, fired);
+            }
+
+            update_next_expiry();
+
+            // extract the callbacks, the entries may go out of scope as soon
+            // as the lock has been released
+            std::int64_t lateness = 0;
+            while (fired != nullptr)
+            {
+                entry* e = fired;
+                fired = e->next_;
+                e->next_ = nullptr;
+
+                lateness +=
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        now - e->deadline_)
+                        .count();
+                callbacks.push_back(std::move(e->callback_));
+            }
+
+            count_ -= callbacks.size();
+            fired_ += static_cast<std::int64_t>(callbacks.size());
+            lateness_ += lateness;
+        }
+
+        for (callback_type& f : callbacks)
+            f();
+
+        overhead_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            clock_type::now() - start)
+                         .count();
+
+        return callbacks.size();
+    }
+}}}    // namespace hpx::threads::detail
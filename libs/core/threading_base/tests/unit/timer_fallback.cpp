@@ -0,0 +1,77 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Timed suspensions have to be woken up even if no worker thread is available
+// to advance the timer wheels.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void sleeper()
+{
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+}
+
+hpx::threads::policies::scheduler_base* get_scheduler()
+{
+    return hpx::threads::get_self_id_data()->get_scheduler_base();
+}
+
+std::int64_t get_timers_armed_count()
+{
+    return get_scheduler()->get_timers_armed_count(std::size_t(-1), false);
+}
+
+std::int64_t get_timers_fired_count()
+{
+    return get_scheduler()->get_timers_fired_count(std::size_t(-1), false);
+}
+
+void test_deadline_expires_while_busy()
+{
+    std::int64_t const armed = get_timers_armed_count();
+    std::int64_t const fired = get_timers_fired_count();
+
+    hpx::future<void> f = hpx::async(&sleeper);
+
+    // let the sleeper run until it has armed its timer
+    while (get_timers_armed_count() == armed)
+        hpx::this_thread::yield();
+
+    // keep the only worker thread busy, the timer has to fire nevertheless
+    auto const limit =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (get_timers_fired_count() == fired &&
+        std::chrono::steady_clock::now() < limit)
+    {
+    }
+    HPX_TEST_NEQ(get_timers_fired_count(), fired);
+
+    // the sleeper is woken up once the worker thread is available again
+    f.get();
+}
+
+int hpx_main()
+{
+    test_deadline_expires_while_busy();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=1"};
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,146 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/timer_wheel.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+using hpx::threads::detail::timer_wheel;
+
+using std::chrono::nanoseconds;
+using std::chrono::seconds;
+
+///////////////////////////////////////////////////////////////////////////////
+// timers never fire before their deadline and at most one tick late
+void test_timer_wheel_accuracy()
+{
+    constexpr std::size_t num_timers = 10000;
+    constexpr std::int64_t step = 50000;    // [ns]
+
+    timer_wheel wheel;
+    auto const start = timer_wheel::clock_type::now();
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::int64_t> dist(0, 500000000);
+
+    std::vector<std::unique_ptr<timer_wheel::entry>> entries;
+    std::vector<std::int64_t> deadlines(num_timers);
+    std::vector<std::int64_t> fired(num_timers, -1);
+
+    std::int64_t now = 0;
+    for (std::size_t i = 0; i != num_timers; ++i)
+    {
+        entries.emplace_back(new timer_wheel::entry);
+        deadlines[i] = dist(gen);
+        wheel.arm(*entries[i], start + nanoseconds(deadlines[i]),
+            [&fired, &now, i]() { fired[i] = now; });
+    }
+    HPX_TEST(!wheel.empty());
+
+    std::size_t count = 0;
+    for (/**/; now <= 600000000; now += step)
+    {
+        count += wheel.advance(start + nanoseconds(now));
+    }
+
+    HPX_TEST_EQ(count, num_timers);
+    HPX_TEST(wheel.empty());
+    HPX_TEST_EQ(wheel.get_fired_count(), std::int64_t(num_timers));
+
+    for (std::size_t i = 0; i != num_timers; ++i)
+    {
+        HPX_TEST_LTE(deadlines[i], fired[i]);
+        HPX_TEST_LTE(
+            fired[i], deadlines[i] + timer_wheel::default_resolution + step);
+    }
+}
+
+// cancelled timers do not fire
+void test_timer_wheel_cancel()
+{
+    constexpr std::size_t num_timers = 1000;
+
+    timer_wheel wheel;
+    auto const start = timer_wheel::clock_type::now();
+
+    std::vector<std::unique_ptr<timer_wheel::entry>> entries;
+    std::vector<int> fired(num_timers, 0);
+
+    for (std::size_t i = 0; i != num_timers; ++i)
+    {
+        entries.emplace_back(new timer_wheel::entry);
+        wheel.arm(*entries[i], start + nanoseconds(1000000 * (i + 1)),
+            [&fired, i]() { ++fired[i]; });
+    }
+
+    for (std::size_t i = 0; i < num_timers; i += 3)
+    {
+        HPX_TEST(timer_wheel::cancel(*entries[i]));
+    }
+
+    wheel.advance(start + seconds(2));
+    HPX_TEST(wheel.empty());
+
+    for (std::size_t i = 0; i != num_timers; ++i)
+    {
+        HPX_TEST_EQ(fired[i], i % 3 == 0 ? 0 : 1);
+
+        // cancelling a fired timer fails
+        HPX_TEST(!timer_wheel::cancel(*entries[i]));
+    }
+
+    HPX_TEST_EQ(wheel.get_armed_count(), std::int64_t(num_timers));
+    HPX_TEST_EQ(wheel.get_cancelled_count(), std::int64_t(334));
+    HPX_TEST_EQ(wheel.get_fired_count(), std::int64_t(666));
+}
+
+// timers beyond the range of the wheel and timers which have expired already
+void test_timer_wheel_ranges()
+{
+    timer_wheel wheel;
+    auto const start = timer_wheel::clock_type::now();
+
+    int fired_past = 0;
+    timer_wheel::entry past;
+    wheel.arm(past, start - seconds(1), [&]() { ++fired_past; });
+    HPX_TEST(wheel.next_expiry() <= start);
+
+    wheel.advance(start);
+    HPX_TEST_EQ(fired_past, 1);
+
+    int fired_far = 0;
+    timer_wheel::entry far;
+    wheel.arm(far, start + seconds(5000), [&]() { ++fired_far; });
+
+    for (std::int64_t s = 0; s < 5000; s += 10)
+    {
+        wheel.advance(start + seconds(s));
+    }
+    HPX_TEST_EQ(fired_far, 0);
+    HPX_TEST(!wheel.empty());
+    HPX_TEST(wheel.next_expiry() <=
+        start + seconds(5000) + nanoseconds(timer_wheel::default_resolution));
+
+    wheel.advance(start + seconds(5001));
+    HPX_TEST_EQ(fired_far, 1);
+    HPX_TEST(wheel.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_timer_wheel_accuracy();
+    test_timer_wheel_cancel();
+    test_timer_wheel_ranges();
+
+    return hpx::util::report_errors();
+}
@@ -6,6 +6,7 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/allocator_support/numa_slab_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
@@ -133,6 +134,43 @@ namespace hpx { namespace threads { namespace detail {
 #endif
     }
 
+#if defined(HPX_HAVE_NUMA_ALLOCATOR)
+    ///////////////////////////////////////////////////////////////////////////
+    // topology support for the NUMA slab allocator, binding memory is done on
+    // a best effort basis
+    void* numa_slab_allocate_bound(std::size_t len, std::size_t domain)
+    {
+        try
+        {
+            threads::topology& topo = threads::create_topology();
+            if (domain >= topo.get_number_of_numa_nodes())
+                return nullptr;
+
+            hwloc_bitmap_ptr nodeset = topo.cpuset_to_nodeset(
+                topo.get_numa_node_affinity_mask_from_numa_node(domain));
+            return topo.allocate_membind(
+                len, nodeset, threads::membind_bind, 0);
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    std::size_t numa_slab_get_memory_domain(void const* addr)
+    {
+        try
+        {
+            int domain = threads::create_topology().get_numa_domain(addr);
+            return domain < 0 ? std::size_t(-1) :
+                                static_cast<std::size_t>(domain);
+        }
+        catch (...)
+        {
+            return std::size_t(-1);
+        }
+    }
+#endif
 }}}    // namespace hpx::threads::detail
 
 std::size_t hpx::threads::topology::memory_page_size_ =
@@ -288,6 +326,12 @@ namespace hpx { namespace threads {
         {
             thread_affinity_masks_.push_back(init_thread_affinity_mask(i));
         }
+
+#if defined(HPX_HAVE_NUMA_ALLOCATOR)
+        util::numa_slab::set_topology_functions(
+            &detail::numa_slab_allocate_bound,
+            &detail::numa_slab_get_memory_domain);
+#endif
     }    // }}}
 
     void topology::write_to_log() const
@@ -0,0 +1,443 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines the save_checkpoint_chunked and
+/// restore_checkpoint_chunked functions. Other than save_checkpoint, which
+/// creates one contiguous buffer holding all objects, these functions stream
+/// the serialized objects to (from) a std::ostream (std::istream) in chunks of
+/// a fixed size. All objects are serialized concurrently, each chunk can
+/// optionally be compressed using one of the binary filter plugins. The
+/// stored chunk index allows to restore any subset of the stored objects.
+
+/// \file hpx/checkpoint/chunked_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/execution/execution.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/async_local.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+#include <hpx/synchronization/mutex.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Options controlling the creation of a chunked checkpoint
+    struct chunked_checkpoint_options
+    {
+        /// The size (in bytes) of the chunks the serialized data of each
+        /// object is split into. All chunks of an object except the last one
+        /// have this size (before compression).
+        std::size_t chunk_size = std::size_t(4) * 1024 * 1024;
+
+        /// The name of the binary filter plugin used to compress the chunks
+        /// (for instance "zlib_serialization_filter"). The chunks are stored
+        /// uncompressed if this is empty.
+        std::string compression;
+
+        /// The maximal number of chunks of each object which may be in the
+        /// process of being compressed and written at any point in time.
+        /// This bounds the memory used while saving the checkpoint.
+        std::size_t max_pending_chunks = 4;
+    };
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Description of one chunk stored in a chunked checkpoint
+        struct chunked_checkpoint_chunk
+        {
+            std::uint64_t entry_;          // index of the stored object
+            std::uint64_t sequence_;       // position in the object's data
+            std::uint64_t offset_;         // position in the checkpoint
+            std::uint64_t size_;           // number of (uncompressed) bytes
+            std::uint64_t stored_size_;    // number of bytes stored
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The writer compresses the chunks (if requested) and writes them to
+        // the stream, it keeps track of the positions of all chunks.
+        class HPX_EXPORT chunked_checkpoint_writer
+        {
+        public:
+            chunked_checkpoint_writer(std::ostream& ost,
+                chunked_checkpoint_options const& options,
+                std::size_t num_entries);
+
+            HPX_NON_COPYABLE(chunked_checkpoint_writer);
+
+            // compress and write the given chunk, may be called concurrently
+            void write_chunk(std::size_t entry, std::size_t sequence,
+                std::vector<char> const& data);
+
+            // write the chunk index, no chunks may be written afterwards
+            void finalize();
+
+            chunked_checkpoint_options const& options() const noexcept
+            {
+                return options_;
+            }
+
+        private:
+            hpx::lcos::local::mutex mtx_;
+            std::ostream& ost_;
+            chunked_checkpoint_options options_;
+            std::uint64_t offset_;
+            std::vector<chunked_checkpoint_chunk> index_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // 'Container' used by the output archive while saving one object. It
+        // collects the serialized data in chunks and hands full chunks to the
+        // writer, which is done asynchronously.
+        class HPX_EXPORT chunked_output_container
+        {
+        public:
+            chunked_output_container(
+                std::shared_ptr<chunked_checkpoint_writer> writer,
+                std::size_t entry);
+
+            HPX_NON_COPYABLE(chunked_output_container);
+
+            ~chunked_output_container();
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            void resize(std::size_t size) noexcept
+            {
+                size_ = size;
+            }
+
+            void write(std::size_t count, std::size_t current,
+                void const* address);
+
+            // write the last (partial) chunk and wait for all chunks to be
+            // written
+            void finish();
+
+        private:
+            void write_chunk();
+
+            std::shared_ptr<chunked_checkpoint_writer> writer_;
+            std::size_t entry_;
+            std::size_t sequence_;
+            std::size_t size_;
+            std::vector<char> chunk_;
+            std::deque<hpx::future<void>> pending_;
+        };
+
+        class chunked_input_container;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// chunked_checkpoint_reader
+    ///
+    /// The reader gives access to the objects stored in a checkpoint created
+    /// by save_checkpoint_chunked. The checkpoint has to start at the current
+    /// position of the given stream and has to extend to the end of the
+    /// stream. Only the chunks of the objects which are restored are read
+    /// from the stream.
+    class HPX_EXPORT chunked_checkpoint_reader
+    {
+    public:
+        explicit chunked_checkpoint_reader(std::istream& ist);
+
+        HPX_NON_COPYABLE(chunked_checkpoint_reader);
+
+        /// Return the number of objects stored in the checkpoint
+        std::size_t size() const noexcept
+        {
+            return entries_.size();
+        }
+
+        /// Restore the object with the given index (zero based, in the order
+        /// the objects were passed to save_checkpoint_chunked).
+        template <typename T>
+        void restore(std::size_t entry, T& t);
+
+        /// \cond NOINTERNAL
+        // return the overall (uncompressed) size of the data of the given
+        // object
+        std::size_t data_size(std::size_t entry) const;
+
+        // return the (uncompressed) size of the chunks
+        std::size_t chunk_size() const noexcept
+        {
+            return chunk_size_;
+        }
+
+        // return the number of chunks stored for the given object
+        std::size_t num_chunks(std::size_t entry) const;
+
+        // read and decompress the chunk with the given sequence number of the
+        // given object, may be called concurrently
+        void read_chunk(std::size_t entry, std::size_t sequence,
+            std::vector<char>& data);
+        /// \endcond
+
+    private:
+        void check_entry(std::size_t entry) const;
+
+        hpx::lcos::local::mutex mtx_;
+        std::istream& ist_;
+        std::uint64_t base_;
+        std::size_t chunk_size_;
+        std::string compression_;
+        std::vector<std::vector<detail::chunked_checkpoint_chunk>> entries_;
+    };
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // 'Container' used by the input archive while restoring one object.
+        // Chunks are read when needed, the next chunk is read ahead
+        // asynchronously.
+        class HPX_EXPORT chunked_input_container
+        {
+        public:
+            chunked_input_container(
+                chunked_checkpoint_reader& reader, std::size_t entry);
+
+            HPX_NON_COPYABLE(chunked_input_container);
+
+            ~chunked_input_container();
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            void read(std::size_t count, std::size_t current,
+                void* address) const;
+
+        private:
+            void load_chunk(std::size_t sequence) const;
+
+            chunked_checkpoint_reader& reader_;
+            std::size_t entry_;
+            std::size_t size_;
+            std::size_t num_chunks_;
+
+            mutable std::size_t sequence_;
+            mutable std::size_t next_sequence_;
+            mutable std::vector<char> chunk_;
+            mutable hpx::future<std::vector<char>> next_chunk_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        void save_chunked_checkpoint_entry(
+            std::shared_ptr<chunked_checkpoint_writer> const& writer,
+            std::size_t entry, T const& t)
+        {
+            chunked_output_container cont(writer, entry);
+            {
+                hpx::serialization::output_archive ar(cont);
+
+                // force check-pointing flag to be created in the archive,
+                // the serialization of id_type's checks for it
+                ar.get_extra_data<checkpointing_tag>();
+
+                ar << t;
+                ar.flush();
+            }
+            cont.finish();
+        }
+
+        template <typename T>
+        void restore_chunked_checkpoint_entry(
+            chunked_checkpoint_reader& reader, std::size_t entry, T& t)
+        {
+            reader.restore(entry, t);
+        }
+
+        HPX_EXPORT void finalize_chunked_checkpoint(
+            std::shared_ptr<chunked_checkpoint_writer> const& writer,
+            std::vector<hpx::future<void>>&& futures);
+    }    // namespace detail
+
+    template <typename T>
+    void chunked_checkpoint_reader::restore(std::size_t entry, T& t)
+    {
+        check_entry(entry);
+
+        detail::chunked_input_container cont(*this, entry);
+        hpx::serialization::input_archive ar(cont, cont.size());
+        ar >> t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// save_checkpoint_chunked
+    ///
+    /// \tparam Ts          Types of the objects to store
+    ///
+    /// \param ost          The stream the checkpoint is written to
+    /// \param options      Options controlling the chunk size and the
+    ///                     compression of the chunks
+    /// \param ts           The objects to store in the checkpoint
+    ///
+    /// Save_checkpoint_chunked serializes all given objects concurrently and
+    /// writes the serialized data as a sequence of (optionally compressed)
+    /// chunks to the given stream, followed by an index of all chunks. The
+    /// objects are not copied, they (and the stream) have to be kept alive
+    /// until the returned future has become ready.
+    ///
+    /// \returns save_checkpoint_chunked returns a future which becomes ready
+    ///          once the whole checkpoint has been written.
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_chunked(std::ostream& ost,
+        chunked_checkpoint_options const& options, Ts const&... ts)
+    {
+        auto writer = std::make_shared<detail::chunked_checkpoint_writer>(
+            ost, options, sizeof...(Ts));
+
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(sizeof...(Ts));
+
+        std::size_t entry = 0;
+        int const _sequencer[] = {0,
+            (futures.push_back(
+                 hpx::async(&detail::save_chunked_checkpoint_entry<Ts>, writer,
+                     entry++, std::cref(ts))),
+                0)...};
+        (void) _sequencer;
+
+        return hpx::when_all(std::move(futures))
+            .then(hpx::launch::sync,
+                [writer](hpx::future<std::vector<hpx::future<void>>>&& f) {
+                    detail::finalize_chunked_checkpoint(writer, f.get());
+                });
+    }
+
+    /// Same as above, using default options
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_chunked(std::ostream& ost, Ts const&... ts)
+    {
+        return save_checkpoint_chunked(
+            ost, chunked_checkpoint_options{}, ts...);
+    }
+
+    /// Same as above, but waits for the checkpoint to be written
+    template <typename... Ts>
+    void save_checkpoint_chunked(hpx::launch::sync_policy, std::ostream& ost,
+        chunked_checkpoint_options const& options, Ts const&... ts)
+    {
+        save_checkpoint_chunked(ost, options, ts...).get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// restore_checkpoint_chunked
+    ///
+    /// \tparam Ts          Types of the objects to restore
+    ///
+    /// \param ist          The stream the checkpoint is read from
+    /// \param ts           The objects to restore from the checkpoint
+    ///
+    /// Restore_checkpoint_chunked restores all objects stored in a checkpoint
+    /// which was created by save_checkpoint_chunked. The objects are restored
+    /// concurrently. The sequence of objects has to correspond to the
+    /// sequence of objects passed to save_checkpoint_chunked. Use
+    /// chunked_checkpoint_reader to restore only some of the objects.
+    template <typename... Ts>
+    void restore_checkpoint_chunked(std::istream& ist, Ts&... ts)
+    {
+        chunked_checkpoint_reader reader(ist);
+        if (reader.size() != sizeof...(Ts))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "hpx::util::restore_checkpoint_chunked",
+                "the number of objects to restore does not match the "
+                "number of objects stored in the checkpoint");
+        }
+
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(sizeof...(Ts));
+
+        std::size_t entry = 0;
+        int const _sequencer[] = {0,
+            (futures.push_back(
+                 hpx::async(&detail::restore_chunked_checkpoint_entry<Ts>,
+                     std::ref(reader), entry++, std::ref(ts))),
+                0)...};
+        (void) _sequencer;
+
+        hpx::wait_all(futures);
+        for (hpx::future<void>& f : futures)
+        {
+            f.get();    // rethrow exceptions
+        }
+    }
+}}    // namespace hpx::util
+
+namespace hpx { namespace traits {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <>
+    struct serialization_access_data<util::detail::chunked_output_container>
+      : default_serialization_access_data<
+            util::detail::chunked_output_container>
+    {
+        static std::size_t size(
+            util::detail::chunked_output_container const& cont)
+        {
+            return cont.size();
+        }
+
+        static void resize(
+            util::detail::chunked_output_container& cont, std::size_t count)
+        {
+            cont.resize(cont.size() + count);
+        }
+
+        static void write(util::detail::chunked_output_container& cont,
+            std::size_t count, std::size_t current, void const* address)
+        {
+            cont.write(count, current, address);
+        }
+    };
+
+    template <>
+    struct serialization_access_data<util::detail::chunked_input_container>
+      : default_serialization_access_data<
+            util::detail::chunked_input_container>
+    {
+        static std::size_t size(
+            util::detail::chunked_input_container const& cont)
+        {
+            return cont.size();
+        }
+
+        static void read(util::detail::chunked_input_container const& cont,
+            std::size_t count, std::size_t current, void* address)
+        {
+            cont.read(count, current, address);
+        }
+    };
+}}    // namespace hpx::traits
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,520 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint/chunked_checkpoint.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/async_local.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/runtime_fwd.hpp>
+#include <hpx/serialization/binary_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A chunked checkpoint is laid out as follows (all numbers are stored as
+    // 64 bit values in native byte order):
+    //
+    //      header:     magic, chunk size, number of objects,
+    //                  length of compression type, compression type
+    //      chunks:     the (compressed) data of all chunks
+    //      index:      entry, sequence, offset, size, and stored size for
+    //                  each chunk
+    //      trailer:    offset of the index, number of chunks, magic
+    //
+    // All offsets are relative to the beginning of the checkpoint.
+    namespace {
+
+        char const chunked_checkpoint_magic[8] = {
+            'H', 'P', 'X', 'C', 'K', 'P', 'T', '1'};
+
+        constexpr std::size_t trailer_size =
+            2 * sizeof(std::uint64_t) + sizeof(chunked_checkpoint_magic);
+
+        void write_raw(std::ostream& ost, void const* data, std::size_t size)
+        {
+            ost.write(static_cast<char const*>(data),
+                static_cast<std::streamsize>(size));
+            if (!ost)
+            {
+                HPX_THROW_EXCEPTION(hpx::filesystem_error,
+                    "hpx::util::save_checkpoint_chunked",
+                    "failed to write checkpoint data to the stream");
+            }
+        }
+
+        void write_uint64(std::ostream& ost, std::uint64_t value)
+        {
+            write_raw(ost, &value, sizeof(value));
+        }
+
+        void read_raw(std::istream& ist, void* data, std::size_t size)
+        {
+            ist.read(static_cast<char*>(data),
+                static_cast<std::streamsize>(size));
+            if (!ist)
+            {
+                HPX_THROW_EXCEPTION(hpx::filesystem_error,
+                    "hpx::util::chunked_checkpoint_reader",
+                    "failed to read checkpoint data from the stream");
+            }
+        }
+
+        std::uint64_t read_uint64(std::istream& ist)
+        {
+            std::uint64_t value = 0;
+            read_raw(ist, &value, sizeof(value));
+            return value;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        using binary_filter_ptr =
+            std::unique_ptr<hpx::serialization::binary_filter>;
+
+        binary_filter_ptr create_filter(
+            std::string const& compression, bool compress)
+        {
+            binary_filter_ptr filter(
+                hpx::create_binary_filter(compression.c_str(), compress));
+            if (!filter)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "hpx::util::detail::create_filter",
+                    "unknown compression type: " + compression);
+            }
+            return filter;
+        }
+
+        std::vector<char> compress_chunk(
+            std::string const& compression, std::vector<char> const& data)
+        {
+            // Start with a buffer which is a bit larger than the data, retry
+            // with a larger one if the compressed data does not fit. Binary
+            // filters are stateful, so a new one is needed for each attempt.
+            std::size_t capacity = data.size() + data.size() / 16 + 64;
+            while (true)
+            {
+                binary_filter_ptr filter = create_filter(compression, true);
+                filter->set_max_length(data.size());
+                filter->save(data.data(), data.size());
+
+                std::vector<char> result(capacity);
+                std::size_t written = 0;
+                if (filter->flush(result.data(), result.size(), written))
+                {
+                    result.resize(written);
+                    return result;
+                }
+                capacity *= 2;
+            }
+        }
+
+        void decompress_chunk(std::string const& compression,
+            std::vector<char> const& stored, std::vector<char>& data)
+        {
+            binary_filter_ptr filter = create_filter(compression, false);
+            filter->init_data(stored.data(), stored.size(), data.size());
+            filter->load(data.data(), data.size());
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    chunked_checkpoint_writer::chunked_checkpoint_writer(std::ostream& ost,
+        chunked_checkpoint_options const& options, std::size_t num_entries)
+      : ost_(ost)
+      , options_(options)
+      , offset_(0)
+    {
+        if (options_.chunk_size == 0 || options_.max_pending_chunks == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "hpx::util::save_checkpoint_chunked",
+                "the chunk size and the number of pending chunks must not "
+                "be zero");
+        }
+
+        // fail early if the requested compression is not available
+        if (!options_.compression.empty())
+            create_filter(options_.compression, true);
+
+        write_raw(ost_, chunked_checkpoint_magic,
+            sizeof(chunked_checkpoint_magic));
+        write_uint64(ost_, options_.chunk_size);
+        write_uint64(ost_, num_entries);
+        write_uint64(ost_, options_.compression.size());
+        write_raw(
+            ost_, options_.compression.data(), options_.compression.size());
+
+        offset_ = sizeof(chunked_checkpoint_magic) +
+            3 * sizeof(std::uint64_t) + options_.compression.size();
+    }
+
+    void chunked_checkpoint_writer::write_chunk(std::size_t entry,
+        std::size_t sequence, std::vector<char> const& data)
+    {
+        // compress outside of the lock, this is where the time goes
+        std::vector<char> compressed;
+        if (!options_.compression.empty())
+            compressed = compress_chunk(options_.compression, data);
+
+        std::vector<char> const& stored =
+            options_.compression.empty() ? data : compressed;
+
+        std::lock_guard<hpx::lcos::local::mutex> l(mtx_);
+
+        index_.push_back(chunked_checkpoint_chunk{entry, sequence, offset_,
+            data.size(), stored.size()});
+
+        write_raw(ost_, stored.data(), stored.size());
+        offset_ += stored.size();
+    }
+
+    void chunked_checkpoint_writer::finalize()
+    {
+        std::lock_guard<hpx::lcos::local::mutex> l(mtx_);
+
+        std::sort(index_.begin(), index_.end(),
+            [](chunked_checkpoint_chunk const& lhs,
+                chunked_checkpoint_chunk const& rhs) {
+                return lhs.entry_ < rhs.entry_ ||
+                    (lhs.entry_ == rhs.entry_ &&
+                        lhs.sequence_ < rhs.sequence_);
+            });
+
+        for (chunked_checkpoint_chunk const& chunk : index_)
+        {
+            write_uint64(ost_, chunk.entry_);
+            write_uint64(ost_, chunk.sequence_);
+            write_uint64(ost_, chunk.offset_);
+            write_uint64(ost_, chunk.size_);
+            write_uint64(ost_, chunk.stored_size_);
+        }
+
+        write_uint64(ost_, offset_);
+        write_uint64(ost_, index_.size());
+        write_raw(ost_, chunked_checkpoint_magic,
+            sizeof(chunked_checkpoint_magic));
+
+        ost_.flush();
+    }
+
+    void finalize_chunked_checkpoint(
+        std::shared_ptr<chunked_checkpoint_writer> const& writer,
+        std::vector<hpx::future<void>>&& futures)
+    {
+        for (hpx::future<void>& f : futures)
+        {
+            f.get();    // rethrow exceptions
+        }
+        writer->finalize();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    chunked_output_container::chunked_output_container(
+        std::shared_ptr<chunked_checkpoint_writer> writer, std::size_t entry)
+      : writer_(std::move(writer))
+      , entry_(entry)
+      , sequence_(0)
+      , size_(0)
+    {
+        chunk_.reserve(writer_->options().chunk_size);
+    }
+
+    chunked_output_container::~chunked_output_container()
+    {
+        // make sure no chunk is being written once the caller is notified of
+        // an error
+        hpx::wait_all(pending_.begin(), pending_.end());
+    }
+
+    void chunked_output_container::write(
+        std::size_t count, std::size_t, void const* address)
+    {
+        std::size_t const chunk_size = writer_->options().chunk_size;
+        char const* src = static_cast<char const*>(address);
+        while (count != 0)
+        {
+            std::size_t const n = (std::min)(count, chunk_size - chunk_.size());
+            chunk_.insert(chunk_.end(), src, src + n);
+            src += n;
+            count -= n;
+
+            if (chunk_.size() == chunk_size)
+                write_chunk();
+        }
+    }
+
+    void chunked_output_container::write_chunk()
+    {
+        std::vector<char> data;
+        data.reserve(writer_->options().chunk_size);
+        std::swap(data, chunk_);
+
+        pending_.push_back(hpx::async(
+            [writer = writer_, entry = entry_, sequence = sequence_++,
+                data = std::move(data)]() {
+                writer->write_chunk(entry, sequence, data);
+            }));
+
+        // bound the memory held by the chunks which are still in flight
+        while (pending_.size() > writer_->options().max_pending_chunks)
+        {
+            hpx::future<void> f = std::move(pending_.front());
+            pending_.pop_front();
+            f.get();
+        }
+    }
+
+    void chunked_output_container::finish()
+    {
+        // every object is stored using at least one chunk
+        if (!chunk_.empty() || sequence_ == 0)
+            write_chunk();
+
+        hpx::wait_all(pending_.begin(), pending_.end());
+        while (!pending_.empty())
+        {
+            hpx::future<void> f = std::move(pending_.front());
+            pending_.pop_front();
+            f.get();    // rethrow exceptions
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    chunked_input_container::chunked_input_container(
+        chunked_checkpoint_reader& reader, std::size_t entry)
+      : reader_(reader)
+      , entry_(entry)
+      , size_(reader.data_size(entry))
+      , num_chunks_(reader.num_chunks(entry))
+      , sequence_(std::size_t(-1))
+      , next_sequence_(std::size_t(-1))
+    {
+    }
+
+    chunked_input_container::~chunked_input_container()
+    {
+        if (next_chunk_.valid())
+            next_chunk_.wait();
+    }
+
+    void chunked_input_container::load_chunk(std::size_t sequence) const
+    {
+        if (next_chunk_.valid() && next_sequence_ == sequence)
+        {
+            chunk_ = next_chunk_.get();
+        }
+        else
+        {
+            if (next_chunk_.valid())
+                next_chunk_.wait();
+            reader_.read_chunk(entry_, sequence, chunk_);
+        }
+        sequence_ = sequence;
+
+        // the archive reads the data sequentially, read ahead the next chunk
+        next_sequence_ = sequence + 1;
+        if (next_sequence_ < num_chunks_)
+        {
+            next_chunk_ = hpx::async(
+                [&reader = reader_, entry = entry_, sequence = next_sequence_]() {
+                    std::vector<char> data;
+                    reader.read_chunk(entry, sequence, data);
+                    return data;
+                });
+        }
+        else
+        {
+            next_chunk_ = hpx::future<std::vector<char>>();
+        }
+    }
+
+    void chunked_input_container::read(
+        std::size_t count, std::size_t current, void* address) const
+    {
+        std::size_t const chunk_size = reader_.chunk_size();
+        char* dst = static_cast<char*>(address);
+        while (count != 0)
+        {
+            std::size_t const sequence = current / chunk_size;
+            if (sequence != sequence_)
+                load_chunk(sequence);
+
+            std::size_t const pos = current - sequence * chunk_size;
+            if (pos >= chunk_.size())
+            {
+                HPX_THROW_EXCEPTION(hpx::serialization_error,
+                    "chunked_input_container::read",
+                    "archive data bstream is too short");
+            }
+
+            std::size_t const n = (std::min)(count, chunk_.size() - pos);
+            std::memcpy(dst, chunk_.data() + pos, n);
+            dst += n;
+            current += n;
+            count -= n;
+        }
+    }
+}}}    // namespace hpx::util::detail
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    chunked_checkpoint_reader::chunked_checkpoint_reader(std::istream& ist)
+      : ist_(ist)
+      , base_(0)
+      , chunk_size_(0)
+    {
+        using detail::chunked_checkpoint_chunk;
+        using detail::chunked_checkpoint_magic;
+        using detail::read_raw;
+        using detail::read_uint64;
+
+        base_ = static_cast<std::uint64_t>(ist_.tellg());
+
+        char magic[sizeof(chunked_checkpoint_magic)];
+        read_raw(ist_, magic, sizeof(magic));
+        if (std::memcmp(magic, chunked_checkpoint_magic, sizeof(magic)) != 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::serialization_error,
+                "hpx::util::chunked_checkpoint_reader",
+                "the stream does not contain a chunked checkpoint");
+        }
+
+        chunk_size_ = static_cast<std::size_t>(read_uint64(ist_));
+        std::size_t const num_entries =
+            static_cast<std::size_t>(read_uint64(ist_));
+        compression_.resize(static_cast<std::size_t>(read_uint64(ist_)));
+        read_raw(ist_, &compression_[0], compression_.size());
+
+        // the trailer is located at the end of the stream
+        ist_.seekg(0, std::ios_base::end);
+        std::uint64_t const end = static_cast<std::uint64_t>(ist_.tellg());
+        if (!ist_ || end < base_ + detail::trailer_size)
+        {
+            HPX_THROW_EXCEPTION(hpx::serialization_error,
+                "hpx::util::chunked_checkpoint_reader",
+                "the chunked checkpoint is truncated");
+        }
+
+        ist_.seekg(static_cast<std::streamoff>(end - detail::trailer_size));
+        std::uint64_t const index_offset = read_uint64(ist_);
+        std::uint64_t const num_chunks = read_uint64(ist_);
+        read_raw(ist_, magic, sizeof(magic));
+        if (std::memcmp(magic, chunked_checkpoint_magic, sizeof(magic)) != 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::serialization_error,
+                "hpx::util::chunked_checkpoint_reader",
+                "the chunked checkpoint is truncated");
+        }
+
+        // read the index, the chunks are sorted by entry and sequence
+        entries_.resize(num_entries);
+        ist_.seekg(static_cast<std::streamoff>(base_ + index_offset));
+        for (std::uint64_t i = 0; i != num_chunks; ++i)
+        {
+            chunked_checkpoint_chunk chunk;
+            chunk.entry_ = read_uint64(ist_);
+            chunk.sequence_ = read_uint64(ist_);
+            chunk.offset_ = read_uint64(ist_);
+            chunk.size_ = read_uint64(ist_);
+            chunk.stored_size_ = read_uint64(ist_);
+
+            if (chunk.entry_ >= num_entries ||
+                chunk.sequence_ != entries_[chunk.entry_].size() ||
+                chunk.size_ > chunk_size_ ||
+                (chunk.sequence_ != 0 &&
+                    entries_[chunk.entry_].back().size_ != chunk_size_))
+            {
+                HPX_THROW_EXCEPTION(hpx::serialization_error,
+                    "hpx::util::chunked_checkpoint_reader",
+                    "the index of the chunked checkpoint is corrupt");
+            }
+            entries_[chunk.entry_].push_back(chunk);
+        }
+    }
+
+    void chunked_checkpoint_reader::check_entry(std::size_t entry) const
+    {
+        if (entry >= entries_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "hpx::util::chunked_checkpoint_reader",
+                "the checkpoint does not store an object with the given "
+                "index");
+        }
+    }
+
+    std::size_t chunked_checkpoint_reader::data_size(std::size_t entry) const
+    {
+        check_entry(entry);
+
+        std::size_t size = 0;
+        for (detail::chunked_checkpoint_chunk const& chunk : entries_[entry])
+            size += static_cast<std::size_t>(chunk.size_);
+        return size;
+    }
+
+    std::size_t chunked_checkpoint_reader::num_chunks(std::size_t entry) const
+    {
+        check_entry(entry);
+        return entries_[entry].size();
+    }
+
+    void chunked_checkpoint_reader::read_chunk(
+        std::size_t entry, std::size_t sequence, std::vector<char>& data)
+    {
+        check_entry(entry);
+        if (sequence >= entries_[entry].size())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "hpx::util::chunked_checkpoint_reader::read_chunk",
+                "the checkpoint does not store a chunk with the given index");
+        }
+
+        detail::chunked_checkpoint_chunk const& chunk =
+            entries_[entry][sequence];
+
+        std::vector<char> stored(static_cast<std::size_t>(chunk.stored_size_));
+        {
+            std::lock_guard<hpx::lcos::local::mutex> l(mtx_);
+
+            ist_.clear();
+            ist_.seekg(static_cast<std::streamoff>(base_ + chunk.offset_));
+            detail::read_raw(ist_, stored.data(), stored.size());
+        }
+
+        // decompress outside of the lock
+        if (compression_.empty())
+        {
+            if (stored.size() != chunk.size_)
+            {
+                HPX_THROW_EXCEPTION(hpx::serialization_error,
+                    "hpx::util::chunked_checkpoint_reader::read_chunk",
+                    "the chunked checkpoint is corrupt");
+            }
+            data = std::move(stored);
+        }
+        else
+        {
+            data.resize(static_cast<std::size_t>(chunk.size_));
+            detail::decompress_chunk(compression_, stored, data);
+        }
+    }
+}}    // namespace hpx::util
@@ -0,0 +1,169 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the functionality of save_checkpoint_chunked,
+// restore_checkpoint_chunked, and chunked_checkpoint_reader.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <cstddef>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using hpx::util::chunked_checkpoint_options;
+using hpx::util::chunked_checkpoint_reader;
+using hpx::util::restore_checkpoint_chunked;
+using hpx::util::save_checkpoint_chunked;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_checkpoint_chunked(chunked_checkpoint_options const& options)
+{
+    int integer = 42;
+    std::string str = "I am a string of characters";
+    std::vector<double> vec(10000);
+    for (std::size_t i = 0; i != vec.size(); ++i)
+        vec[i] = double(i % 100) * 0.5;
+    std::map<int, std::string> map;
+    for (int i = 0; i != 100; ++i)
+        map[i] = std::to_string(i * i);
+
+    std::stringstream strm(
+        std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    save_checkpoint_chunked(strm, options, integer, str, vec, map).get();
+
+    // restore all objects
+    {
+        int integer2 = 0;
+        std::string str2;
+        std::vector<double> vec2;
+        std::map<int, std::string> map2;
+
+        strm.seekg(0);
+        restore_checkpoint_chunked(strm, integer2, str2, vec2, map2);
+
+        HPX_TEST_EQ(integer, integer2);
+        HPX_TEST_EQ(str, str2);
+        HPX_TEST(vec == vec2);
+        HPX_TEST(map == map2);
+    }
+
+    // restore only some of the objects, in arbitrary order
+    {
+        //[check_chunked_test_2
+        strm.seekg(0);
+        chunked_checkpoint_reader reader(strm);
+        HPX_TEST_EQ(reader.size(), std::size_t(4));
+
+        std::map<int, std::string> map2;
+        reader.restore(3, map2);
+        //]
+        HPX_TEST(map == map2);
+
+        std::vector<double> vec2;
+        reader.restore(2, vec2);
+        HPX_TEST(vec == vec2);
+
+        // the vector does not fit into a single chunk
+        HPX_TEST_LT(options.chunk_size, reader.data_size(2));
+        HPX_TEST_LT(std::size_t(1), reader.num_chunks(2));
+    }
+}
+
+void test_checkpoint_chunked_file()
+{
+    std::vector<int> vec(100000);
+    for (std::size_t i = 0; i != vec.size(); ++i)
+        vec[i] = int(i);
+    std::string str = "another string";
+
+    chunked_checkpoint_options options;
+    options.chunk_size = 4096;
+
+    //[check_chunked_test_1
+    {
+        std::ofstream ofs("checkpoint_chunked_test_file.txt",
+            std::ios_base::out | std::ios_base::binary);
+        save_checkpoint_chunked(hpx::launch::sync, ofs, options, vec, str);
+    }
+    //]
+
+    std::vector<int> vec2;
+    std::string str2;
+    {
+        std::ifstream ifs("checkpoint_chunked_test_file.txt",
+            std::ios_base::in | std::ios_base::binary);
+        restore_checkpoint_chunked(ifs, vec2, str2);
+    }
+
+    HPX_TEST(vec == vec2);
+    HPX_TEST_EQ(str, str2);
+}
+
+void test_checkpoint_chunked_errors()
+{
+    std::stringstream strm(
+        std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    strm << "this is not a checkpoint";
+
+    bool caught_exception = false;
+    try
+    {
+        strm.seekg(0);
+        chunked_checkpoint_reader reader(strm);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // wrong number of objects
+    std::stringstream strm2(
+        std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    save_checkpoint_chunked(strm2, 1, 2).get();
+
+    caught_exception = false;
+    try
+    {
+        int i = 0;
+        strm2.seekg(0);
+        restore_checkpoint_chunked(strm2, i);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_checkpoint_chunked_file();
+    test_checkpoint_chunked_errors();
+
+    chunked_checkpoint_options options;
+    options.chunk_size = 256;
+    options.max_pending_chunks = 2;
+    test_checkpoint_chunked(options);
+
+#if defined(HPX_HAVE_COMPRESSION_ZLIB)
+    options.compression = "zlib_serialization_filter";
+    test_checkpoint_chunked(options);
+#endif
+
+    return hpx::util::report_errors();
+}
@@ -38,6 +38,9 @@ namespace hpx { namespace lcos {
     ///             usage of the \a HPX_REGISTER_ALLTOALL macro to define the
     ///             necessary internal facilities used by \a all_gather.
     ///
+    /// \note       The communication pattern is selected based on the number
+    ///             of participating sites, see \a collective_topology.
+    ///
     /// \returns    This function returns a future holding a vector with all
     ///             values send by all participating sites. It will become
     ///             ready once the all_gather operation has been completed.
@@ -76,6 +79,9 @@ namespace hpx { namespace lcos {
     ///             usage of the \a HPX_REGISTER_ALLTOALL macro to define the
     ///             necessary internal facilities used by \a all_gather.
     ///
+    /// \note       The communication pattern is selected based on the number
+    ///             of participating sites, see \a collective_topology.
+    ///
     /// \returns    This function returns a future holding a vector with all
     ///             values send by all participating sites. It will become
     ///             ready once the all_gather operation has been completed.
@@ -100,6 +106,8 @@ namespace hpx { namespace lcos {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/collectives/detail/communicator.hpp>
+#include <hpx/collectives/detail/topology_algorithms.hpp>
+#include <hpx/collectives/topology.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/modules/execution_base.hpp>
@@ -230,39 +238,6 @@ namespace hpx { namespace lcos {
             std::move(fid), std::move(local_result));
     }
 
-    template <typename T>
-    hpx::future<std::vector<T>> all_gather(char const* basename,
-        hpx::future<T>&& local_result, std::size_t num_sites = std::size_t(-1),
-        std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
-    {
-        if (num_sites == std::size_t(-1))
-        {
-            num_sites = static_cast<std::size_t>(
-                hpx::get_num_localities(hpx::launch::sync));
-        }
-        if (this_site == std::size_t(-1))
-        {
-            this_site = static_cast<std::size_t>(hpx::get_locality_id());
-        }
-
-        if (this_site == root_site)
-        {
-            return all_gather(
-                create_all_gather(basename, num_sites, generation, root_site),
-                std::move(local_result), this_site);
-        }
-
-        std::string name(basename);
-        if (generation != std::size_t(-1))
-        {
-            name += std::to_string(generation) + "/";
-        }
-
-        return all_gather(hpx::find_from_basename(std::move(name), root_site),
-            std::move(local_result), this_site);
-    }
-
     ///////////////////////////////////////////////////////////////////////////
     // all_gather plain values
     template <typename T>
@@ -317,6 +292,15 @@ namespace hpx { namespace lcos {
             this_site = static_cast<std::size_t>(hpx::get_locality_id());
         }
 
+        collective_topology const topology =
+            detail::select_all_gather_topology(num_sites);
+        if (topology != collective_topology::central)
+        {
+            return detail::all_gather_p2p(basename,
+                std::forward<T>(local_result), num_sites, generation,
+                this_site, root_site, topology);
+        }
+
         if (this_site == root_site)
         {
             return all_gather(
@@ -333,6 +317,32 @@ namespace hpx { namespace lcos {
         return all_gather(hpx::find_from_basename(std::move(name), root_site),
             std::forward<T>(local_result), this_site);
     }
+
+    template <typename T>
+    hpx::future<std::vector<T>> all_gather(char const* basename,
+        hpx::future<T>&& local_result, std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
+    {
+        if (num_sites == std::size_t(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                hpx::get_num_localities(hpx::launch::sync));
+        }
+        if (this_site == std::size_t(-1))
+        {
+            this_site = static_cast<std::size_t>(hpx::get_locality_id());
+        }
+
+        // the topology depends on the size of the local value
+        return local_result.then(hpx::launch::sync,
+            [name = std::string(basename), num_sites, generation, this_site,
+                root_site](hpx::future<T>&& f) mutable
+            -> hpx::future<std::vector<T>> {
+                return all_gather(name.c_str(), f.get(), num_sites,
+                    generation, this_site, root_site);
+            });
+    }
 }}    // namespace hpx::lcos
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,10 @@ namespace hpx { namespace lcos {
     ///             usage of the \a HPX_REGISTER_BROADCAST macro to define the
     ///             necessary internal facilities used by \a broadcast.
     ///
+    /// \note       The value may be forwarded along a tree, see
+    ///             \a collective_topology. In this case all receiving sites
+    ///             have to pass the same \a num_sites to \a broadcast_from.
+    ///
     /// \returns    This function returns a future that will become
     ///             ready once the broadcast operation has been completed.
     ///
@@ -75,6 +79,10 @@ namespace hpx { namespace lcos {
     ///             usage of the \a HPX_REGISTER_BROADCAST macro to define the
     ///             necessary internal facilities used by \a broadcast.
     ///
+    /// \note       The value may be forwarded along a tree, see
+    ///             \a collective_topology. In this case all receiving sites
+    ///             have to pass the same \a num_sites to \a broadcast_from.
+    ///
     /// \returns    This function returns a future that will become
     ///             ready once the broadcast operation has been completed.
     ///
@@ -100,11 +108,20 @@ namespace hpx { namespace lcos {
     /// \param this_site    The sequence number of this invocation (usually
     ///                     the locality id). This value is optional and
     ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \params root_site   The site that is responsible for creating the
+    ///                     broadcast support object. This value is optional
+    ///                     and defaults to '0' (zero).
+    /// \param  num_sites   The number of participating sites (default: all
+    ///                     localities).
     ///
     /// \note       Each broadcast operation has to be accompanied with a unique
     ///             usage of the \a HPX_REGISTER_BROADCAST macro to define the
     ///             necessary internal facilities used by \a broadcast.
     ///
+    /// \note       The value may be forwarded along a tree, see
+    ///             \a collective_topology. In this case all receiving sites
+    ///             have to pass the same \a num_sites as the sending site.
+    ///
     /// \returns    This function returns a future holding the value that was
     ///             sent to all participating sites. It will become
     ///             ready once the broadcast operation has been completed.
@@ -112,7 +129,9 @@ namespace hpx { namespace lcos {
     template <typename T>
     hpx::future<T> broadcast_from(char const* basename,
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1))
+        std::size_t this_site = std::size_t(-1),
+        std::size_t root_site = 0,
+        std::size_t num_sites = std::size_t(-1))
 
 }}    // namespace hpx::lcos
 
@@ -126,6 +145,8 @@ namespace hpx { namespace lcos {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/collectives/detail/communicator.hpp>
+#include <hpx/collectives/detail/topology_algorithms.hpp>
+#include <hpx/collectives/topology.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/modules/execution_base.hpp>
@@ -283,27 +304,6 @@ namespace hpx { namespace lcos {
             std::move(fid), std::move(local_result));
     }
 
-    template <typename T>
-    hpx::future<T> broadcast_to(char const* basename,
-        hpx::future<T>&& local_result, std::size_t num_sites = std::size_t(-1),
-        std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
-    {
-        if (num_sites == std::size_t(-1))
-        {
-            num_sites = static_cast<std::size_t>(
-                hpx::get_num_localities(hpx::launch::sync));
-        }
-        if (this_site == std::size_t(-1))
-        {
-            this_site = static_cast<std::size_t>(hpx::get_locality_id());
-        }
-
-        return broadcast_to(
-            create_broadcast(basename, num_sites, generation, root_site),
-            std::move(local_result), this_site);
-    }
-
     template <typename T>
     hpx::future<typename std::decay<T>::type> broadcast_to(
         hpx::future<hpx::id_type>&& fid, T&& local_result,
@@ -354,11 +354,46 @@ namespace hpx { namespace lcos {
             this_site = static_cast<std::size_t>(hpx::get_locality_id());
         }
 
+        // the receiving sites select the topology based on the same number
+        // of participating sites
+        if (detail::select_broadcast_topology(num_sites) !=
+            collective_topology::central)
+        {
+            // the root site is the sending site
+            return detail::broadcast_p2p(basename,
+                std::forward<T>(local_result), num_sites, generation,
+                root_site, root_site);
+        }
+
         return broadcast_to(
             create_broadcast(basename, num_sites, generation, root_site),
             std::forward<T>(local_result), this_site);
     }
 
+    template <typename T>
+    hpx::future<T> broadcast_to(char const* basename,
+        hpx::future<T>&& local_result, std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
+    {
+        if (num_sites == std::size_t(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                hpx::get_num_localities(hpx::launch::sync));
+        }
+        if (this_site == std::size_t(-1))
+        {
+            this_site = static_cast<std::size_t>(hpx::get_locality_id());
+        }
+
+        return local_result.then(hpx::launch::sync,
+            [name = std::string(basename), num_sites, generation, this_site,
+                root_site](hpx::future<T>&& f) -> hpx::future<T> {
+                return broadcast_to(name.c_str(), f.get(), num_sites,
+                    generation, this_site, root_site);
+            });
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     hpx::future<T> broadcast_from(hpx::future<hpx::id_type>&& fid,
@@ -394,13 +429,26 @@ namespace hpx { namespace lcos {
     template <typename T>
     hpx::future<T> broadcast_from(char const* basename,
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        std::size_t num_sites = std::size_t(-1))
     {
+        if (num_sites == std::size_t(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                hpx::get_num_localities(hpx::launch::sync));
+        }
         if (this_site == std::size_t(-1))
         {
             this_site = static_cast<std::size_t>(hpx::get_locality_id());
         }
 
+        if (detail::select_broadcast_topology(num_sites) !=
+            collective_topology::central)
+        {
+            return detail::broadcast_p2p(basename, T(), num_sites, generation,
+                this_site, root_site);
+        }
+
         std::string name(basename);
         if (generation != std::size_t(-1))
         {
@@ -0,0 +1,214 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/detail/communicator.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/futures/traits/future_traits.hpp>
+#include <hpx/runtime/basename_registration.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    // A slot of a point-to-point mailbox. The slots are stored in the type
+    // erased data of the communicator which requires them to be equality
+    // comparable.
+    template <typename T>
+    struct p2p_slot
+    {
+        lcos::local::promise<T> promise_;
+
+        friend bool operator==(
+            p2p_slot const& lhs, p2p_slot const& rhs) noexcept
+        {
+            return &lhs == &rhs;
+        }
+    };
+}}}    // namespace hpx::lcos::detail
+
+namespace hpx { namespace traits {
+
+    namespace communication {
+        struct point_to_point_tag;
+    }    // namespace communication
+
+    ///////////////////////////////////////////////////////////////////////////
+    // support for point-to-point communication: the communicator acts as a
+    // mailbox with one slot for each tag, each slot can be written to and read
+    // from exactly once
+    template <typename Communicator>
+    struct communication_operation<Communicator,
+        communication::point_to_point_tag>
+    {
+        communication_operation(Communicator& comm)
+          : communicator_(comm)
+        {
+        }
+
+        template <typename Result>
+        Result get(std::size_t which)
+        {
+            using arg_type = typename traits::future_traits<Result>::type;
+            using mutex_type = typename Communicator::mutex_type;
+
+            std::unique_lock<mutex_type> l(communicator_.mtx_);
+            auto& data = communicator_.template access_data<
+                lcos::detail::p2p_slot<arg_type>>(l);
+
+            HPX_ASSERT(which < data.size());
+            return data[which].promise_.get_future();
+        }
+
+        template <typename Result, typename T>
+        Result set(std::size_t which, T&& t)
+        {
+            using arg_type = typename std::decay<T>::type;
+            using mutex_type = typename Communicator::mutex_type;
+
+            lcos::local::promise<arg_type>* p = nullptr;
+            {
+                std::unique_lock<mutex_type> l(communicator_.mtx_);
+                auto& data = communicator_.template access_data<
+                    lcos::detail::p2p_slot<arg_type>>(l);
+
+                HPX_ASSERT(which < data.size());
+                p = &data[which].promise_;
+            }
+
+            // the slots are never reallocated, the continuations attached to
+            // the future are run without holding the lock
+            p->set_value(std::forward<T>(t));
+        }
+
+        Communicator& communicator_;
+    };
+}}    // namespace hpx::traits
+
+namespace hpx { namespace lcos { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every participating site creates one p2p_communicator which registers a
+    // communicator_server under the given base name and its site number. The
+    // other sites send values to a particular tag of this mailbox, the owning
+    // site receives them. All values transmitted through one mailbox must
+    // have the same type.
+    //
+    // The member functions block the calling HPX thread, the object is meant
+    // to be used from a single HPX thread running a collective algorithm.
+    class p2p_communicator
+    {
+    public:
+        p2p_communicator(char const* basename, std::size_t num_sites,
+            std::size_t generation, std::size_t this_site,
+            std::size_t num_tags)
+          : name_(basename)
+          , num_sites_(num_sites)
+          , site_(this_site)
+          , peers_(num_sites)
+        {
+            HPX_ASSERT(this_site < num_sites);
+
+            if (generation != std::size_t(-1))
+            {
+                name_ += std::to_string(generation) + "/";
+            }
+
+            peers_[site_] = create_communicator(
+                basename, num_sites, generation, this_site, num_tags)
+                                .get();
+        }
+
+        HPX_NON_COPYABLE(p2p_communicator);
+
+        std::size_t num_sites() const noexcept
+        {
+            return num_sites_;
+        }
+
+        std::size_t site() const noexcept
+        {
+            return site_;
+        }
+
+        // send the given value to the given tag of the given site
+        template <typename T>
+        void send(std::size_t site, std::size_t tag, T&& value)
+        {
+            using arg_type = typename std::decay<T>::type;
+            using action_type = typename communicator_server::
+                template communication_set_action<
+                    traits::communication::point_to_point_tag, void,
+                    arg_type>;
+
+            HPX_ASSERT(site != site_);
+            sends_.push_back(hpx::async(
+                action_type(), get_id(site), tag, std::forward<T>(value)));
+        }
+
+        // wait for the value sent to the given tag of this site
+        template <typename T>
+        T receive(std::size_t tag)
+        {
+            using action_type = typename communicator_server::
+                template communication_get_action<
+                    traits::communication::point_to_point_tag,
+                    hpx::future<T>>;
+
+            hpx::future<T> f = hpx::async(action_type(), peers_[site_], tag);
+            return f.get();
+        }
+
+        // wait for all outstanding sends and unregister this site, this has
+        // to be called after all values sent to this site were received
+        void finalize()
+        {
+            hpx::wait_all(sends_);
+            for (auto& f : sends_)
+            {
+                f.get();    // propagate exceptions
+            }
+            sends_.clear();
+
+            hpx::unregister_with_basename(std::move(name_), site_).get();
+            peers_.clear();
+        }
+
+    private:
+        hpx::id_type const& get_id(std::size_t site)
+        {
+            HPX_ASSERT(site < num_sites_);
+            if (!peers_[site])
+            {
+                peers_[site] = hpx::find_from_basename(name_, site).get();
+            }
+            return peers_[site];
+        }
+
+        std::string name_;
+        std::size_t const num_sites_;
+        std::size_t const site_;
+        std::vector<hpx::id_type> peers_;
+        std::vector<hpx::future<void>> sends_;
+    };
+}}}    // namespace hpx::lcos::detail
+
+#endif    // COMPUTE_HOST_CODE
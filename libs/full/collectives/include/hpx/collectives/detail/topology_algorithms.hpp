@@ -0,0 +1,401 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The collective algorithms implemented here are based on point-to-point
+// communication between the participating sites, see R. Thakur, R.
+// Rabenseifner, W. Gropp: "Optimization of Collective Communication
+// Operations in MPICH".
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/collectives/detail/p2p_communicator.hpp>
+#include <hpx/collectives/topology.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // number of steps needed by a binomial tree spanning num_sites sites
+    inline std::size_t ceil_log2(std::size_t num_sites) noexcept
+    {
+        std::size_t result = 0;
+        while ((std::size_t(1) << result) < num_sites)
+        {
+            ++result;
+        }
+        return result;
+    }
+
+    // largest power of two not larger than num_sites
+    inline std::size_t floor_power_of_two(std::size_t num_sites) noexcept
+    {
+        std::size_t result = 1;
+        while (2 * result <= num_sites)
+        {
+            result *= 2;
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Send the value from the root site to all other sites along a binomial
+    // tree. The value passed on all other sites is ignored. Uses one tag.
+    template <typename T>
+    T broadcast_binomial_tree(
+        p2p_communicator& comm, T value, std::size_t root, std::size_t tag)
+    {
+        std::size_t const num_sites = comm.num_sites();
+        std::size_t const rank = (comm.site() + num_sites - root) % num_sites;
+
+        // the parent of a site is found by clearing the lowest set bit of its
+        // rank (relative to the root)
+        std::size_t mask = 1;
+        while (mask < num_sites)
+        {
+            if (rank & mask)
+            {
+                value = comm.template receive<T>(tag);
+                break;
+            }
+            mask <<= 1;
+        }
+
+        // forward the value to the children, farthest first
+        for (mask >>= 1; mask != 0; mask >>= 1)
+        {
+            if (rank + mask < num_sites)
+            {
+                comm.send((rank + mask + root) % num_sites, tag, value);
+            }
+        }
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Combine the values of all sites along a binomial tree, the result is
+    // valid on the root site only. Uses the tags [0, ceil_log2(num_sites)).
+    template <typename T, typename F>
+    T reduce_binomial_tree(
+        p2p_communicator& comm, T value, F& op, std::size_t root)
+    {
+        std::size_t const num_sites = comm.num_sites();
+        std::size_t const rank = (comm.site() + num_sites - root) % num_sites;
+
+        for (std::size_t mask = 1, step = 0; mask < num_sites;
+             mask <<= 1, ++step)
+        {
+            if (rank & mask)
+            {
+                comm.send((rank - mask + root) % num_sites, step,
+                    std::move(value));
+                break;
+            }
+
+            if (rank + mask < num_sites)
+            {
+                // the child holds the combined values of the next sites
+                T other = comm.template receive<T>(step);
+                value = op(value, other);
+            }
+        }
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reduce along a binomial tree and broadcast the result.
+    template <typename T, typename F>
+    T all_reduce_binomial_tree(
+        p2p_communicator& comm, T value, F& op, std::size_t root)
+    {
+        std::size_t const steps = ceil_log2(comm.num_sites());
+        return broadcast_binomial_tree(comm,
+            reduce_binomial_tree(comm, std::move(value), op, root), root,
+            steps);
+    }
+
+    // Exchange partial results with a partner in each step. If the number of
+    // sites is not a power of two, the first sites fold their values into
+    // their neighbors before and receive the result from them afterwards.
+    // Uses the tags [0, log2(num_sites) + 2).
+    template <typename T, typename F>
+    T all_reduce_recursive_doubling(p2p_communicator& comm, T value, F& op)
+    {
+        std::size_t const num_sites = comm.num_sites();
+        std::size_t const site = comm.site();
+
+        std::size_t const pof2 = floor_power_of_two(num_sites);
+        std::size_t const rem = num_sites - pof2;
+        std::size_t const fold_tag = 0;
+        std::size_t const unfold_tag = ceil_log2(pof2) + 1;
+
+        if (site < 2 * rem && site % 2 == 0)
+        {
+            // this site does not participate in the exchange
+            comm.send(site + 1, fold_tag, value);
+            return comm.template receive<T>(unfold_tag);
+        }
+
+        std::size_t rank = site - rem;
+        if (site < 2 * rem)
+        {
+            T other = comm.template receive<T>(fold_tag);
+            value = op(other, value);
+            rank = site / 2;
+        }
+
+        for (std::size_t mask = 1, step = 1; mask < pof2; mask <<= 1, ++step)
+        {
+            std::size_t const partner_rank = rank ^ mask;
+            std::size_t const partner = partner_rank < rem ?
+                2 * partner_rank + 1 :
+                partner_rank + rem;
+
+            comm.send(partner, step, value);
+            T other = comm.template receive<T>(step);
+
+            // combine in the order of the sites to make sure all sites
+            // calculate exactly the same result
+            value = rank < partner_rank ? op(value, other) : op(other, value);
+        }
+
+        if (site < 2 * rem)
+        {
+            comm.send(site - 1, unfold_tag, value);
+        }
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Collect the values along a binomial tree and broadcast the result.
+    template <typename T>
+    std::vector<T> all_gather_binomial_tree(
+        p2p_communicator& comm, T value, std::size_t root)
+    {
+        std::size_t const num_sites = comm.num_sites();
+        std::size_t const rank = (comm.site() + num_sites - root) % num_sites;
+
+        // the values of the sites [rank, rank + block.size()), relative to the
+        // root
+        std::vector<T> block;
+        block.push_back(std::move(value));
+
+        std::size_t const steps = ceil_log2(num_sites);
+        for (std::size_t mask = 1, step = 0; mask < num_sites;
+             mask <<= 1, ++step)
+        {
+            if (rank & mask)
+            {
+                comm.send((rank - mask + root) % num_sites, step,
+                    std::move(block));
+                break;
+            }
+
+            if (rank + mask < num_sites)
+            {
+                std::vector<T> other =
+                    comm.template receive<std::vector<T>>(step);
+                block.insert(block.end(),
+                    std::make_move_iterator(other.begin()),
+                    std::make_move_iterator(other.end()));
+            }
+        }
+
+        std::vector<T> result;
+        if (rank == 0)
+        {
+            HPX_ASSERT(block.size() == num_sites);
+            result.resize(num_sites);
+            for (std::size_t i = 0; i != num_sites; ++i)
+            {
+                result[(i + root) % num_sites] = std::move(block[i]);
+            }
+        }
+        return broadcast_binomial_tree(comm, std::move(result), root, steps);
+    }
+
+    // Exchange the collected values with a partner in each step, the number
+    // of sites has to be a power of two. Uses the tags [0, log2(num_sites)).
+    template <typename T>
+    std::vector<T> all_gather_recursive_doubling(
+        p2p_communicator& comm, T value)
+    {
+        std::size_t const num_sites = comm.num_sites();
+        std::size_t const site = comm.site();
+        HPX_ASSERT((num_sites & (num_sites - 1)) == 0);
+
+        std::vector<T> result(num_sites);
+        result[site] = std::move(value);
+
+        for (std::size_t mask = 1, step = 0; mask < num_sites;
+             mask <<= 1, ++step)
+        {
+            std::size_t const partner = site ^ mask;
+
+            // both sites hold the values of an aligned block of mask sites
+            auto const first = result.begin() + (site & ~(mask - 1));
+            comm.send(partner, step, std::vector<T>(first, first + mask));
+
+            std::vector<T> other = comm.template receive<std::vector<T>>(step);
+            HPX_ASSERT(other.size() == mask);
+            std::move(other.begin(), other.end(),
+                result.begin() + (partner & ~(mask - 1)));
+        }
+        return result;
+    }
+
+    // Pass the values around the ring of sites, each value travels over each
+    // link once. Uses the tags [0, num_sites - 1).
+    template <typename T>
+    std::vector<T> all_gather_ring(p2p_communicator& comm, T value)
+    {
+        std::size_t const num_sites = comm.num_sites();
+        std::size_t const site = comm.site();
+        std::size_t const right = (site + 1) % num_sites;
+
+        std::vector<T> result(num_sites);
+        result[site] = std::move(value);
+
+        for (std::size_t step = 0; step != num_sites - 1; ++step)
+        {
+            comm.send(
+                right, step, result[(site + num_sites - step) % num_sites]);
+            result[(site + 2 * num_sites - step - 1) % num_sites] =
+                comm.template receive<T>(step);
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // number of tags needed by the algorithms for the given topology
+    inline std::size_t get_num_tags(
+        collective_topology topology, std::size_t num_sites) noexcept
+    {
+        switch (topology)
+        {
+        case collective_topology::recursive_doubling:
+            return ceil_log2(num_sites) + 2;
+
+        case collective_topology::ring:
+            return (std::max)(num_sites - 1, std::size_t(1));
+
+        case collective_topology::binomial_tree:
+        default:
+            break;
+        }
+        return ceil_log2(num_sites) + 1;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Run the given collective algorithm on a new HPX thread
+    template <typename T, typename F>
+    hpx::future<typename std::decay<T>::type> all_reduce_p2p(
+        char const* basename, T&& local_result, F&& op, std::size_t num_sites,
+        std::size_t generation, std::size_t this_site, std::size_t root_site,
+        collective_topology topology)
+    {
+        using arg_type = typename std::decay<T>::type;
+        using func_type = typename std::decay<F>::type;
+
+        return hpx::async(
+            [name = std::string(basename),
+                value = arg_type(std::forward<T>(local_result)),
+                op = func_type(std::forward<F>(op)), num_sites, generation,
+                this_site, root_site, topology]() mutable -> arg_type {
+                p2p_communicator comm(name.c_str(), num_sites, generation,
+                    this_site, get_num_tags(topology, num_sites));
+
+                arg_type result =
+                    topology == collective_topology::recursive_doubling ?
+                    all_reduce_recursive_doubling(comm, std::move(value), op) :
+                    all_reduce_binomial_tree(
+                        comm, std::move(value), op, root_site);
+
+                comm.finalize();
+                return result;
+            });
+    }
+
+    template <typename T>
+    hpx::future<std::vector<typename std::decay<T>::type>> all_gather_p2p(
+        char const* basename, T&& local_result, std::size_t num_sites,
+        std::size_t generation, std::size_t this_site, std::size_t root_site,
+        collective_topology topology)
+    {
+        using arg_type = typename std::decay<T>::type;
+
+        return hpx::async(
+            [name = std::string(basename),
+                value = arg_type(std::forward<T>(local_result)), num_sites,
+                generation, this_site, root_site,
+                topology]() mutable -> std::vector<arg_type> {
+                p2p_communicator comm(name.c_str(), num_sites, generation,
+                    this_site, get_num_tags(topology, num_sites));
+
+                std::vector<arg_type> result;
+                switch (topology)
+                {
+                case collective_topology::recursive_doubling:
+                    result = all_gather_recursive_doubling(
+                        comm, std::move(value));
+                    break;
+
+                case collective_topology::ring:
+                    result = all_gather_ring(comm, std::move(value));
+                    break;
+
+                case collective_topology::binomial_tree:
+                default:
+                    result = all_gather_binomial_tree(
+                        comm, std::move(value), root_site);
+                    break;
+                }
+
+                comm.finalize();
+                return result;
+            });
+    }
+
+    // the value is ignored on all sites but the root site
+    template <typename T>
+    hpx::future<typename std::decay<T>::type> broadcast_p2p(
+        char const* basename, T&& value, std::size_t num_sites,
+        std::size_t generation, std::size_t this_site, std::size_t root_site)
+    {
+        using arg_type = typename std::decay<T>::type;
+
+        return hpx::async(
+            [name = std::string(basename),
+                value = arg_type(std::forward<T>(value)), num_sites,
+                generation, this_site, root_site]() mutable -> arg_type {
+                p2p_communicator comm(name.c_str(), num_sites, generation,
+                    this_site,
+                    get_num_tags(
+                        collective_topology::binomial_tree, num_sites));
+
+                arg_type result = broadcast_binomial_tree(
+                    comm, std::move(value), root_site, 0);
+
+                comm.finalize();
+                return result;
+            });
+    }
+}}}    // namespace hpx::lcos::detail
+
+#endif    // COMPUTE_HOST_CODE
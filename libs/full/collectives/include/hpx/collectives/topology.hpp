@@ -0,0 +1,74 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file topology.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace lcos {
+
+    /// The communication pattern used by \a all_reduce, \a all_gather, and
+    /// \a broadcast_to/\a broadcast_from to exchange data between the
+    /// participating sites.
+    ///
+    /// The topology is selected by the configuration setting
+    /// \a hpx.lcos.collectives.topology, which can be set to one of
+    /// 'automatic' (the default), 'central', 'binomial_tree',
+    /// 'recursive_doubling', or 'ring'. All participating sites have to use
+    /// the same setting. If a topology is not supported by an operation the
+    /// closest supported topology is used instead.
+    enum class collective_topology
+    {
+        /// Choose the topology based on the number of participating sites
+        /// (see \a hpx.lcos.collectives.min_sites).
+        automatic = 0,
+        /// All sites send their values to the root site which performs the
+        /// operation and sends the result back.
+        central = 1,
+        /// The values are combined and distributed along a binomial tree
+        /// rooted at the root site, the root is involved in log(N) exchanges
+        /// only.
+        binomial_tree = 2,
+        /// The sites exchange their (partial) results with a partner whose
+        /// distance doubles in each of the log(N) steps.
+        recursive_doubling = 3,
+        /// Each site forwards the values to its right neighbor in N-1 steps
+        /// (all_gather only).
+        ring = 4
+    };
+
+    /// Return the name of the given topology
+    HPX_EXPORT char const* get_collective_topology_name(
+        collective_topology topology);
+
+    /// Return the topology as configured by the configuration setting
+    /// \a hpx.lcos.collectives.topology
+    HPX_EXPORT collective_topology get_collective_topology();
+}}    // namespace hpx::lcos
+
+namespace hpx { namespace lcos { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Select the topology to use for the given collective operation. All
+    // participating sites have to select the same topology, thus the
+    // selection may depend only on values which are the same on all sites.
+    HPX_EXPORT collective_topology select_all_reduce_topology(
+        std::size_t num_sites);
+
+    HPX_EXPORT collective_topology select_all_gather_topology(
+        std::size_t num_sites);
+
+    HPX_EXPORT collective_topology select_broadcast_topology(
+        std::size_t num_sites);
+}}}    // namespace hpx::lcos::detail
+
+namespace hpx {
+    using lcos::collective_topology;
+}    // namespace hpx
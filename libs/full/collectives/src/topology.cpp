@@ -0,0 +1,191 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/collectives/topology.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace hpx { namespace lcos {
+
+    ///////////////////////////////////////////////////////////////////////////
+    char const* get_collective_topology_name(collective_topology topology)
+    {
+        switch (topology)
+        {
+        case collective_topology::automatic:
+            return "automatic";
+        case collective_topology::central:
+            return "central";
+        case collective_topology::binomial_tree:
+            return "binomial_tree";
+        case collective_topology::recursive_doubling:
+            return "recursive_doubling";
+        case collective_topology::ring:
+            return "ring";
+        default:
+            break;
+        }
+        return "<unknown>";
+    }
+
+    collective_topology get_collective_topology()
+    {
+        std::string const topology =
+            get_config_entry("hpx.lcos.collectives.topology", "automatic");
+
+        if (topology == "automatic")
+            return collective_topology::automatic;
+        if (topology == "central")
+            return collective_topology::central;
+        if (topology == "binomial_tree")
+            return collective_topology::binomial_tree;
+        if (topology == "recursive_doubling")
+            return collective_topology::recursive_doubling;
+        if (topology == "ring")
+            return collective_topology::ring;
+
+        HPX_THROW_EXCEPTION(bad_parameter, "hpx::lcos::get_collective_topology",
+            "unknown collective topology: " + topology);
+        return collective_topology::automatic;
+    }
+}}    // namespace hpx::lcos
+
+namespace hpx { namespace lcos { namespace detail {
+
+    namespace {
+
+        // the minimal number of sites for which the central topology is not
+        // selected automatically
+        std::size_t get_min_sites()
+        {
+            return hpx::util::from_string<std::size_t>(
+                get_config_entry("hpx.lcos.collectives.min_sites", 8));
+        }
+
+        constexpr bool is_power_of_two(std::size_t num_sites) noexcept
+        {
+            return (num_sites & (num_sites - 1)) == 0;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    collective_topology select_all_reduce_topology(std::size_t num_sites)
+    {
+        if (num_sites <= 1)
+        {
+            return collective_topology::central;
+        }
+
+        switch (get_collective_topology())
+        {
+        case collective_topology::central:
+            return collective_topology::central;
+
+        // a ring based reduce-scatter requires values which can be split into
+        // pieces, however the reduction operation combines complete values
+        case collective_topology::binomial_tree:
+        case collective_topology::ring:
+            return collective_topology::binomial_tree;
+
+        case collective_topology::recursive_doubling:
+            return collective_topology::recursive_doubling;
+
+        case collective_topology::automatic:
+        default:
+            break;
+        }
+
+        if (num_sites < get_min_sites())
+        {
+            return collective_topology::central;
+        }
+
+        // recursive doubling needs the least number of steps, the sizes of
+        // the values can't be taken into account as those may differ between
+        // sites
+        return collective_topology::recursive_doubling;
+    }
+
+    collective_topology select_all_gather_topology(std::size_t num_sites)
+    {
+        if (num_sites <= 1)
+        {
+            return collective_topology::central;
+        }
+
+        switch (get_collective_topology())
+        {
+        case collective_topology::central:
+            return collective_topology::central;
+
+        case collective_topology::binomial_tree:
+            return collective_topology::binomial_tree;
+
+        // recursive doubling requires the number of sites to be a power of
+        // two, fall back to the same topology as the automatic selection
+        case collective_topology::recursive_doubling:
+            return is_power_of_two(num_sites) ?
+                collective_topology::recursive_doubling :
+                collective_topology::binomial_tree;
+
+        case collective_topology::ring:
+            return collective_topology::ring;
+
+        case collective_topology::automatic:
+        default:
+            break;
+        }
+
+        if (num_sites < get_min_sites())
+        {
+            return collective_topology::central;
+        }
+
+        // the sizes of the values can't be taken into account as those may
+        // differ between sites, the ring (which sends each value exactly once
+        // over each link) has to be selected explicitly
+        return is_power_of_two(num_sites) ?
+            collective_topology::recursive_doubling :
+            collective_topology::binomial_tree;
+    }
+
+    collective_topology select_broadcast_topology(std::size_t num_sites)
+    {
+        if (num_sites <= 1)
+        {
+            return collective_topology::central;
+        }
+
+        switch (get_collective_topology())
+        {
+        case collective_topology::central:
+            return collective_topology::central;
+
+        case collective_topology::binomial_tree:
+        case collective_topology::recursive_doubling:
+        case collective_topology::ring:
+            return collective_topology::binomial_tree;
+
+        case collective_topology::automatic:
+        default:
+            break;
+        }
+
+        return num_sites < get_min_sites() ?
+            collective_topology::central :
+            collective_topology::binomial_tree;
+    }
+}}}    // namespace hpx::lcos::detail
+
+#endif
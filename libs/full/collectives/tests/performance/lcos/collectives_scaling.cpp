@@ -0,0 +1,184 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure all_reduce, all_gather, and broadcast for all collective topologies.
+// Every locality runs --sites-per-locality sites, which allows to emulate a
+// large number of participating sites with a couple of localities running on
+// one host.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/program_options.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+char const* const topologies[] = {
+    "central", "binomial_tree", "recursive_doubling", "ring"};
+
+///////////////////////////////////////////////////////////////////////////////
+struct elementwise_plus
+{
+    std::vector<double> operator()(
+        std::vector<double> const& lhs, std::vector<double> const& rhs) const
+    {
+        std::vector<double> result(lhs);
+        for (std::size_t i = 0; i != result.size(); ++i)
+        {
+            result[i] += rhs[i];
+        }
+        return result;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+double run_all_reduce(std::string const& basename, std::size_t num_sites,
+    std::vector<std::size_t> const& sites, std::size_t size,
+    std::size_t iterations)
+{
+    hpx::util::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::vector<hpx::future<std::vector<double>>> results;
+        for (std::size_t site : sites)
+        {
+            results.push_back(hpx::all_reduce(basename.c_str(),
+                std::vector<double>(size, 1.0), elementwise_plus{}, num_sites,
+                i, site));
+        }
+        hpx::wait_all(results);
+    }
+    return t.elapsed() / iterations;
+}
+
+double run_all_gather(std::string const& basename, std::size_t num_sites,
+    std::vector<std::size_t> const& sites, std::size_t size,
+    std::size_t iterations)
+{
+    hpx::util::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::vector<hpx::future<std::vector<std::vector<double>>>> results;
+        for (std::size_t site : sites)
+        {
+            results.push_back(hpx::all_gather(basename.c_str(),
+                std::vector<double>(size, 1.0), num_sites, i, site));
+        }
+        hpx::wait_all(results);
+    }
+    return t.elapsed() / iterations;
+}
+
+double run_broadcast(
+    std::string const& basename, std::size_t size, std::size_t iterations)
+{
+    hpx::util::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        if (hpx::get_locality_id() == 0)
+        {
+            hpx::broadcast_to(basename.c_str(), std::vector<double>(size, 1.0),
+                std::size_t(-1), i)
+                .get();
+        }
+        else
+        {
+            hpx::broadcast_from<std::vector<double>>(basename.c_str(), i)
+                .get();
+        }
+    }
+    return t.elapsed() / iterations;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    std::size_t const sites_per_locality =
+        vm["sites-per-locality"].as<std::size_t>();
+    std::size_t const max_size = vm["max-size"].as<std::size_t>();
+
+    std::size_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+    std::size_t const here = hpx::get_locality_id();
+
+    // the sites are distributed round robin over the localities
+    std::size_t const num_sites = sites_per_locality * num_localities;
+    std::vector<std::size_t> sites;
+    for (std::size_t site = here; site < num_sites; site += num_localities)
+    {
+        sites.push_back(site);
+    }
+
+    if (here == 0)
+    {
+        std::cout << "localities: " << num_localities
+                  << ", sites: " << num_sites << "\n"
+                  << "operation,topology,size (bytes),time (seconds)\n";
+    }
+
+    for (char const* topology : topologies)
+    {
+        hpx::set_config_entry("hpx.lcos.collectives.topology", topology);
+
+        for (std::size_t size = 1; size <= max_size; size *= 16)
+        {
+            std::string const basename = std::string("/perf/collectives/") +
+                topology + "/" + std::to_string(size) + "/";
+
+            double const all_reduce_time = run_all_reduce(
+                basename + "all_reduce/", num_sites, sites, size, iterations);
+            double const all_gather_time = run_all_gather(
+                basename + "all_gather/", num_sites, sites, size, iterations);
+            double const broadcast_time =
+                run_broadcast(basename + "broadcast/", size, iterations);
+
+            if (here == 0)
+            {
+                std::size_t const bytes = size * sizeof(double);
+                std::cout << "all_reduce," << topology << "," << bytes << ","
+                          << all_reduce_time << "\n"
+                          << "all_gather," << topology << "," << bytes << ","
+                          << all_gather_time << "\n"
+                          << "broadcast," << topology << "," << bytes << ","
+                          << broadcast_time << "\n";
+            }
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("iterations", value<std::size_t>()->default_value(100),
+         "number of times each operation is repeated (default: 100)")
+        ("sites-per-locality", value<std::size_t>()->default_value(4),
+         "number of participating sites run by each locality (default: 4)")
+        ("max-size", value<std::size_t>()->default_value(65536),
+         "maximal number of doubles contributed by each site "
+         "(default: 65536)");
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    return hpx::init(desc_commandline, argc, argv, cfg);
+}
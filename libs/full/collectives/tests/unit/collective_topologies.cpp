@@ -0,0 +1,304 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Run all_reduce, all_gather, and broadcast for all topologies. Every locality
+// runs several sites to exercise the algorithms with a number of sites which
+// is not a power of two.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+constexpr char const* topologies[] = {
+    "central", "binomial_tree", "recursive_doubling", "ring", "automatic"};
+
+constexpr int num_generations = 5;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_all_reduce(std::string const& basename, std::size_t num_sites,
+    std::vector<std::size_t> const& sites)
+{
+    for (int i = 0; i != num_generations; ++i)
+    {
+        std::vector<hpx::future<std::uint32_t>> results;
+        for (std::size_t site : sites)
+        {
+            results.push_back(hpx::all_reduce(basename.c_str(),
+                static_cast<std::uint32_t>(site), std::plus<std::uint32_t>{},
+                num_sites, i, site));
+        }
+
+        std::uint32_t const expected =
+            static_cast<std::uint32_t>(num_sites * (num_sites - 1) / 2);
+        for (auto&& f : results)
+        {
+            HPX_TEST_EQ(f.get(), expected);
+        }
+    }
+}
+
+// the values are combined in the order of the sites
+void test_all_reduce_ordered(std::string const& basename,
+    std::size_t num_sites, std::vector<std::size_t> const& sites)
+{
+    std::string expected;
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        expected += std::to_string(site) + ",";
+    }
+
+    for (int i = 0; i != num_generations; ++i)
+    {
+        std::vector<hpx::future<std::string>> results;
+        for (std::size_t site : sites)
+        {
+            results.push_back(hpx::all_reduce(basename.c_str(),
+                std::to_string(site) + ",", std::plus<std::string>{},
+                num_sites, i, site));
+        }
+
+        for (auto&& f : results)
+        {
+            HPX_TEST_EQ(f.get(), expected);
+        }
+    }
+}
+
+void test_all_gather(std::string const& basename, std::size_t num_sites,
+    std::vector<std::size_t> const& sites)
+{
+    for (int i = 0; i != num_generations; ++i)
+    {
+        std::vector<hpx::future<std::vector<std::uint32_t>>> results;
+        for (std::size_t site : sites)
+        {
+            results.push_back(hpx::all_gather(basename.c_str(),
+                static_cast<std::uint32_t>(site + i), num_sites, i, site));
+        }
+
+        for (auto&& f : results)
+        {
+            std::vector<std::uint32_t> r = f.get();
+            HPX_TEST_EQ(r.size(), num_sites);
+            for (std::size_t j = 0; j != r.size(); ++j)
+            {
+                HPX_TEST_EQ(r[j], static_cast<std::uint32_t>(j + i));
+            }
+        }
+    }
+}
+
+void test_broadcast(std::string const& basename)
+{
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    for (int i = 0; i != num_generations; ++i)
+    {
+        std::vector<std::uint32_t> const expected(100, std::uint32_t(i + 42));
+        if (hpx::get_locality_id() == 0)
+        {
+            hpx::future<std::vector<std::uint32_t>> result = hpx::broadcast_to(
+                basename.c_str(), expected, num_localities, i);
+
+            HPX_TEST(result.get() == expected);
+        }
+        else
+        {
+            hpx::future<std::vector<std::uint32_t>> result =
+                hpx::broadcast_from<std::vector<std::uint32_t>>(
+                    basename.c_str(), i);
+
+            HPX_TEST(result.get() == expected);
+        }
+    }
+}
+
+// the sites supply values of different sizes, all of them have to select the
+// same topology nevertheless
+std::size_t get_payload_size(std::size_t site)
+{
+    return site % 2 ? 1 : 1024;
+}
+
+void test_all_reduce_sizes(std::string const& basename,
+    std::size_t num_sites, std::vector<std::size_t> const& sites)
+{
+    std::size_t expected = 0;
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        expected += get_payload_size(site);
+    }
+
+    for (int i = 0; i != num_generations; ++i)
+    {
+        std::vector<hpx::future<std::string>> results;
+        for (std::size_t site : sites)
+        {
+            results.push_back(hpx::all_reduce(basename.c_str(),
+                std::string(get_payload_size(site), 'x'),
+                std::plus<std::string>{}, num_sites, i, site));
+        }
+
+        for (auto&& f : results)
+        {
+            HPX_TEST_EQ(f.get().size(), expected);
+        }
+    }
+}
+
+void test_all_gather_sizes(std::string const& basename,
+    std::size_t num_sites, std::vector<std::size_t> const& sites)
+{
+    for (int i = 0; i != num_generations; ++i)
+    {
+        std::vector<hpx::future<std::vector<std::vector<std::uint32_t>>>>
+            results;
+        for (std::size_t site : sites)
+        {
+            results.push_back(hpx::all_gather(basename.c_str(),
+                std::vector<std::uint32_t>(get_payload_size(site),
+                    static_cast<std::uint32_t>(site + i)),
+                num_sites, i, site));
+        }
+
+        for (auto&& f : results)
+        {
+            std::vector<std::vector<std::uint32_t>> r = f.get();
+            HPX_TEST_EQ(r.size(), num_sites);
+            for (std::size_t j = 0; j != r.size(); ++j)
+            {
+                HPX_TEST(r[j] ==
+                    std::vector<std::uint32_t>(get_payload_size(j),
+                        static_cast<std::uint32_t>(j + i)));
+            }
+        }
+    }
+}
+
+// the number of participating sites differs from the number of localities,
+// the receiving sites have to select the same topology as the sending site
+void test_broadcast_subset(std::string const& basename,
+    std::size_t num_sites, std::vector<std::size_t> const& sites)
+{
+    for (int i = 0; i != num_generations; ++i)
+    {
+        std::vector<std::uint32_t> const expected(100, std::uint32_t(i + 42));
+
+        std::vector<hpx::future<std::vector<std::uint32_t>>> results;
+        for (std::size_t site : sites)
+        {
+            if (site == 0)
+            {
+                results.push_back(hpx::broadcast_to(
+                    basename.c_str(), expected, num_sites, i, site));
+            }
+            else
+            {
+                results.push_back(
+                    hpx::broadcast_from<std::vector<std::uint32_t>>(
+                        basename.c_str(), i, site, 0, num_sites));
+            }
+        }
+
+        for (auto&& f : results)
+        {
+            HPX_TEST(f.get() == expected);
+        }
+    }
+}
+
+// recursive doubling falls back to the same topology whether it was
+// selected explicitly or automatically
+void test_all_gather_fallback(std::size_t num_sites)
+{
+    using hpx::lcos::collective_topology;
+    using hpx::lcos::detail::select_all_gather_topology;
+
+    hpx::set_config_entry(
+        "hpx.lcos.collectives.topology", "recursive_doubling");
+    collective_topology const selected = select_all_gather_topology(num_sites);
+
+    hpx::set_config_entry("hpx.lcos.collectives.topology", "automatic");
+    HPX_TEST(selected == select_all_gather_topology(num_sites));
+    HPX_TEST(selected == collective_topology::binomial_tree);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the sites are distributed round robin over the localities
+std::vector<std::size_t> get_local_sites(std::size_t num_sites)
+{
+    std::size_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    std::vector<std::size_t> sites;
+    for (std::size_t site = hpx::get_locality_id(); site < num_sites;
+         site += num_localities)
+    {
+        sites.push_back(site);
+    }
+    return sites;
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    std::size_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    std::size_t const num_sites = 2 * num_localities + 1;
+    std::vector<std::size_t> const sites = get_local_sites(num_sites);
+
+    // enough sites for the automatic selection to not use the central
+    // topology (see hpx.lcos.collectives.min_sites)
+    std::size_t const many_sites = 2 * num_localities + 9;
+    std::vector<std::size_t> const many_local_sites =
+        get_local_sites(many_sites);
+
+    for (char const* topology : topologies)
+    {
+        hpx::set_config_entry("hpx.lcos.collectives.topology", topology);
+
+        std::string const basename =
+            std::string("/test/collective_topologies/") + topology + "/";
+
+        test_all_reduce(basename + "all_reduce/", num_sites, sites);
+        test_all_gather(basename + "all_gather/", num_sites, sites);
+        test_broadcast(basename + "broadcast/");
+
+        if (std::string(topology) != "central")
+        {
+            test_all_reduce_ordered(
+                basename + "all_reduce_ordered/", num_sites, sites);
+        }
+
+        test_all_reduce_sizes(
+            basename + "all_reduce_sizes/", many_sites, many_local_sites);
+        test_all_gather_sizes(
+            basename + "all_gather_sizes/", many_sites, many_local_sites);
+        test_broadcast_subset(
+            basename + "broadcast_subset/", many_sites, many_local_sites);
+    }
+
+    test_all_gather_fallback(many_sites);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -650,6 +650,22 @@ namespace hpx { namespace util {
                   "each locality prints only its own local counters")
                 ("hpx:print-counter-types",
                   "append counter type description to generated output")
+                ("hpx:export-counter",
+                    value<std::vector<std::string> >()->composing(),
+                  "periodically publish the values of the specified local "
+                  "performance counter(s) to a shared memory segment which "
+                  "can be read by external tools (see also options "
+                  "--hpx:export-counter-interval and "
+                  "--hpx:export-counter-destination)")
+                ("hpx:export-counter-interval", value<std::size_t>(),
+                  "update the performance counter(s) specified with "
+                  "--hpx:export-counter after the time interval (specified "
+                  "in milliseconds) (default: 1000)")
+                ("hpx:export-counter-destination", value<std::string>(),
+                  "the name of the shared memory segment the performance "
+                  "counter(s) specified with --hpx:export-counter are "
+                  "published to, localities other than 0 append their id "
+                  "(default: /hpx_counters.<pid>.<locality>)")
             ;
 #endif
 
@@ -6,8 +6,13 @@
 
 #pragma once
 
+#include <hpx/config.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/algorithms/sort_by_key.hpp>
 #include <hpx/parallel/algorithms/stable_sort.hpp>
 #include <hpx/parallel/container_algorithms/sort.hpp>
 #include <hpx/parallel/container_algorithms/stable_sort.hpp>
+
+#if defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
+#include <hpx/parallel/segmented_algorithms/sort.hpp>
+#endif
@@ -67,6 +67,7 @@
 #include <hpx/runtime/find_localities.hpp>
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/util/bind_action.hpp>
+#include <hpx/util/export_counters.hpp>
 #include <hpx/util/init_logging.hpp>
 #include <hpx/util/query_counters.hpp>
 #include <hpx/util/register_locks_globally.hpp>
@@ -361,6 +362,8 @@ namespace hpx {
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cms.rtcfg_.use_stack_guard_pages();
+            threads::coroutines::detail::posix::use_stack_pool =
+                cms.rtcfg_.use_stack_pool();
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cms.rtcfg_.enable_lock_detection())
@@ -591,6 +594,56 @@ namespace hpx {
                     "--hpx:reset-counters, valid in conjunction with "
                     "--hpx:print-counter only");
             }
+
+            if (vm.count("hpx:export-counter"))
+            {
+                std::size_t interval = 1000;
+                if (vm.count("hpx:export-counter-interval"))
+                {
+                    interval =
+                        vm["hpx:export-counter-interval"].as<std::size_t>();
+                    if (interval == 0)
+                    {
+                        throw detail::command_line_error(
+                            "Invalid command line option "
+                            "--hpx:export-counter-interval, the interval "
+                            "has to be larger than zero");
+                    }
+                }
+
+                std::string destination;
+                if (vm.count("hpx:export-counter-destination"))
+                {
+                    destination =
+                        vm["hpx:export-counter-destination"].as<std::string>();
+                }
+
+                std::shared_ptr<util::export_counters> ec =
+                    std::make_shared<util::export_counters>(
+                        vm["hpx:export-counter"].as<std::vector<std::string>>(),
+                        interval, destination);
+
+                // schedule to start exporting at startup, the segment is
+                // removed again before the runtime shuts down
+                rt.add_startup_function(
+                    util::bind_front(&util::export_counters::start, ec));
+                rt.add_pre_shutdown_function(
+                    util::bind_front(&util::export_counters::stop, ec));
+            }
+            else if (vm.count("hpx:export-counter-interval"))
+            {
+                throw detail::command_line_error(
+                    "Invalid command line option "
+                    "--hpx:export-counter-interval, valid in conjunction "
+                    "with --hpx:export-counter only");
+            }
+            else if (vm.count("hpx:export-counter-destination"))
+            {
+                throw detail::command_line_error(
+                    "Invalid command line option "
+                    "--hpx:export-counter-destination, valid in conjunction "
+                    "with --hpx:export-counter only");
+            }
         }
 #endif
 
@@ -10,6 +10,7 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/performance_counters/counters_fwd.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 
 #include <cstdint>
 #include <string>
@@ -109,6 +110,19 @@ namespace hpx { namespace performance_counters {
         hpx::util::function_nonser<std::vector<std::int64_t>(bool)> const&,
         error_code&);
 
+    /// Creation function for raw counters reporting a percentile of a
+    /// distribution. The passed function merges the distribution to monitor
+    /// into the supplied histogram, the percentile is given as the counter
+    /// parameter (default: 99). The counter name has to follow the scheme:
+    ///
+    ///   /<objectname>(locality#<locality_id>/total)/<instancename>@<percentile>
+    ///
+    HPX_EXPORT naming::gid_type locality_raw_percentile_counter_creator(
+        counter_info const&,
+        hpx::util::function_nonser<void(
+            hpx::util::log_histogram&, bool)> const&,
+        error_code&);
+
     ///////////////////////////////////////////////////////////////////////////
     /// Creation function for raw counters. The passed function is encapsulating
     /// the actual value to monitor. This function checks the validity of the
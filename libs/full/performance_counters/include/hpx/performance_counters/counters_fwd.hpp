@@ -12,6 +12,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -563,6 +564,16 @@ namespace hpx { namespace performance_counters {
                     bool)> const&,
                 error_code&);
 
+            // Helper function for creating counters reporting a percentile of
+            // the distribution which the given function merges into the
+            // supplied histogram. The percentile is taken from the counter
+            // parameters (default: 99).
+            HPX_EXPORT naming::gid_type create_raw_percentile_counter(
+                counter_info const&,
+                hpx::util::function_nonser<void(
+                    hpx::util::log_histogram&, bool)> const&,
+                error_code&);
+
             // Helper function for creating a new performance counter instance
             // based on a given counter value.
             HPX_EXPORT naming::gid_type create_raw_counter_value(
@@ -10,6 +10,7 @@
 
 #include <hpx/assert.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 #include <hpx/synchronization/no_mutex.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/util/get_and_reset_value.hpp>
@@ -48,6 +49,10 @@ namespace hpx { namespace performance_counters { namespace parcels {
             std::int64_t total_serialization_time(bool reset);
             std::int64_t total_buffer_allocate_time(bool reset);
 
+            // merge the distribution of the per-message times into the given
+            // histogram
+            void time_histogram(util::log_histogram& result, bool reset);
+
         private:
             std::int64_t overall_bytes_;
             std::int64_t overall_time_;
@@ -58,6 +63,10 @@ namespace hpx { namespace performance_counters { namespace parcels {
 
             std::int64_t buffer_allocate_time_;
 
+            // distribution of the per-message times, this is updated and
+            // queried without holding the lock
+            util::log_histogram time_histogram_;
+
             // Create mutex for accumulator functions.
             mutable mutex_type acc_mtx;
         };
@@ -65,6 +74,8 @@ namespace hpx { namespace performance_counters { namespace parcels {
         template <typename Mutex>
         inline void gatherer<Mutex>::add_data(data_point const& x)
         {
+            time_histogram_.record(static_cast<std::uint64_t>(x.time_));
+
             std::lock_guard<mutex_type> l(acc_mtx);
 
             overall_bytes_ += x.bytes_;
@@ -126,6 +137,13 @@ namespace hpx { namespace performance_counters { namespace parcels {
             std::lock_guard<mutex_type> l(acc_mtx);
             return util::get_and_reset_value(buffer_allocate_time_, reset);
         }
+
+        template <typename Mutex>
+        inline void gatherer<Mutex>::time_histogram(
+            util::log_histogram& result, bool reset)
+        {
+            result.merge(time_histogram_, reset);
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,267 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This header defines the layout of the shared memory segment the values of
+// the counters specified with --hpx:export-counter are published to. It
+// deliberately depends on the C++ standard library and POSIX only, which
+// allows for external monitoring tools to read the counter values without
+// linking with HPX or interacting with the HPX runtime in any way.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hpx { namespace performance_counters { namespace shared_memory {
+
+    // All values in the segment are accessed concurrently from different
+    // processes, which is safe only for lock-free atomics.
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_LONG_LOCK_FREE == 2,
+        "exporting counters requires lock-free 64 bit atomics");
+
+    constexpr std::uint64_t segment_magic = 0x5352544e43585048;    // HPXCNTRS
+    constexpr std::uint64_t segment_version = 1;
+
+    constexpr std::size_t max_name_length = 192;
+    constexpr std::size_t max_unit_length = 32;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The segment starts with a header which is followed by one entry per
+    // exported counter. The header fields and the counter names are written
+    // once before the magic number is published. The counter values are
+    // protected by a sequence lock: the sequence number is odd while the
+    // exporter updates the values, readers retry whenever the sequence number
+    // was odd or has changed while they were copying the values.
+    struct segment_header
+    {
+        std::atomic<std::uint64_t> magic;
+        std::atomic<std::uint64_t> version;
+        std::atomic<std::uint64_t> num_counters;
+        std::atomic<std::uint64_t> sequence;
+        std::atomic<std::int64_t> timestamp;    // ns since epoch, last update
+    };
+
+    // The members mirror hpx::performance_counters::counter_value
+    struct segment_entry
+    {
+        char name[max_name_length];
+        char unit[max_unit_length];
+        std::atomic<std::int64_t> value;
+        std::atomic<std::int64_t> scaling;
+        std::atomic<std::int64_t> scale_inverse;
+        std::atomic<std::int64_t> time;
+        std::atomic<std::uint64_t> count;
+        std::atomic<std::int64_t> status;
+    };
+
+    inline std::size_t segment_size(std::size_t num_counters)
+    {
+        return sizeof(segment_header) + num_counters * sizeof(segment_entry);
+    }
+
+    inline segment_entry* segment_entries(segment_header* header)
+    {
+        return reinterpret_cast<segment_entry*>(header + 1);
+    }
+
+    inline segment_entry const* segment_entries(segment_header const* header)
+    {
+        return reinterpret_cast<segment_entry const*>(header + 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Writer side of the sequence lock
+    inline void begin_update(segment_header* header)
+    {
+        std::uint64_t const seq =
+            header->sequence.load(std::memory_order_relaxed);
+        header->sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    inline void end_update(segment_header* header, std::int64_t timestamp)
+    {
+        header->timestamp.store(timestamp, std::memory_order_relaxed);
+        std::uint64_t const seq =
+            header->sequence.load(std::memory_order_relaxed);
+        header->sequence.store(seq + 1, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A consistent copy of one exported counter value
+    struct counter_sample
+    {
+        std::string name;
+        std::string unit;
+        std::int64_t value = 0;
+        std::int64_t scaling = 1;
+        bool scale_inverse = false;
+        std::int64_t time = 0;
+        std::uint64_t count = 0;
+        std::int64_t status = 0;
+
+        // return the counter value with the scaling applied
+        double get_value() const
+        {
+            if (scaling == 0 || scaling == 1)
+                return double(value);
+            return scale_inverse ? double(value) / double(scaling) :
+                                   double(value) * double(scaling);
+        }
+    };
+
+#if !defined(_WIN32)
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps an exported segment read-only and takes consistent snapshots of
+    // the counter values published to it.
+    class segment_reader
+    {
+    public:
+        segment_reader() = default;
+
+        explicit segment_reader(std::string const& name)
+        {
+            open(name);
+        }
+
+        ~segment_reader()
+        {
+            close();
+        }
+
+        segment_reader(segment_reader const&) = delete;
+        segment_reader& operator=(segment_reader const&) = delete;
+
+        // Map the segment with the given name, returns false (leaving errno
+        // set, if applicable) if the segment does not exist or has not been
+        // initialized yet.
+        bool open(std::string const& name)
+        {
+            close();
+
+            int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+            if (fd == -1)
+                return false;
+
+            struct stat st;
+            if (::fstat(fd, &st) == -1 ||
+                std::size_t(st.st_size) < sizeof(segment_header))
+            {
+                ::close(fd);
+                return false;
+            }
+
+            void* p = ::mmap(nullptr, std::size_t(st.st_size), PROT_READ,
+                MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (p == MAP_FAILED)
+                return false;
+
+            header_ = static_cast<segment_header const*>(p);
+            size_ = std::size_t(st.st_size);
+
+            if (header_->magic.load(std::memory_order_acquire) !=
+                    segment_magic ||
+                header_->version.load(std::memory_order_relaxed) !=
+                    segment_version ||
+                size_ < segment_size(num_counters()))
+            {
+                close();
+                return false;
+            }
+            return true;
+        }
+
+        void close()
+        {
+            if (header_ != nullptr)
+            {
+                ::munmap(const_cast<segment_header*>(header_), size_);
+                header_ = nullptr;
+                size_ = 0;
+            }
+        }
+
+        bool is_open() const
+        {
+            return header_ != nullptr;
+        }
+
+        std::size_t num_counters() const
+        {
+            return header_ == nullptr ?
+                0 :
+                std::size_t(
+                    header_->num_counters.load(std::memory_order_relaxed));
+        }
+
+        // Copy all counter values, returns false if no consistent snapshot
+        // could be taken within the given number of attempts. The timestamp
+        // of the last update (in ns since epoch) is stored in 'timestamp'.
+        bool read(std::vector<counter_sample>& samples,
+            std::int64_t& timestamp, std::size_t max_attempts = 100) const
+        {
+            if (header_ == nullptr)
+                return false;
+
+            std::size_t const count = num_counters();
+            segment_entry const* entries = segment_entries(header_);
+
+            samples.resize(count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                samples[i].name = std::string(entries[i].name,
+                    strnlen(entries[i].name, max_name_length));
+                samples[i].unit = std::string(entries[i].unit,
+                    strnlen(entries[i].unit, max_unit_length));
+            }
+
+            for (std::size_t attempt = 0; attempt != max_attempts; ++attempt)
+            {
+                std::uint64_t const seq =
+                    header_->sequence.load(std::memory_order_acquire);
+                if (seq & 1)
+                    continue;    // update in progress
+
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    segment_entry const& e = entries[i];
+                    counter_sample& s = samples[i];
+
+                    s.value = e.value.load(std::memory_order_relaxed);
+                    s.scaling = e.scaling.load(std::memory_order_relaxed);
+                    s.scale_inverse =
+                        e.scale_inverse.load(std::memory_order_relaxed) != 0;
+                    s.time = e.time.load(std::memory_order_relaxed);
+                    s.count = e.count.load(std::memory_order_relaxed);
+                    s.status = e.status.load(std::memory_order_relaxed);
+                }
+                timestamp = header_->timestamp.load(std::memory_order_relaxed);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (header_->sequence.load(std::memory_order_relaxed) == seq)
+                    return true;
+            }
+            return false;
+        }
+
+    private:
+        segment_header const* header_ = nullptr;
+        std::size_t size_ = 0;
+    };
+#endif
+}}}    // namespace hpx::performance_counters::shared_memory
@@ -16,6 +16,7 @@
 #include <hpx/runtime/agas/server/primary_namespace.hpp>
 #include <hpx/runtime/agas/server/symbol_namespace.hpp>
 #include <hpx/runtime/naming/name.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 
 #include <cstdint>
 #include <string>
@@ -494,6 +495,39 @@ namespace hpx { namespace performance_counters {
         return naming::invalid_gid;
     }
 
+    naming::gid_type locality_raw_percentile_counter_creator(
+        counter_info const& info,
+        hpx::util::function_nonser<void(hpx::util::log_histogram&, bool)> const&
+            f,
+        error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, bad_parameter,
+                "locality_raw_percentile_counter_creator",
+                "invalid counter instance parent name: " +
+                    paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+        {
+            return detail::create_raw_percentile_counter(
+                info, f, ec);    // overall counter
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter,
+            "locality_raw_percentile_counter_creator",
+            "invalid counter instance name: " + paths.instancename_);
+        return naming::invalid_gid;
+    }
+
     namespace detail {
         naming::gid_type retrieve_agas_counter(std::string const& name,
             naming::id_type const& agas_id, error_code& ec)
@@ -20,6 +20,7 @@
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/performance_counters/registry.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 #include <hpx/runtime/actions/continuation.hpp>
 #include <hpx/runtime/agas/interface.hpp>
 #include <hpx/runtime/components/stubs/runtime_support.hpp>
@@ -664,6 +665,41 @@ namespace hpx { namespace performance_counters {
             return gid;
         }
 
+        naming::gid_type create_raw_percentile_counter(counter_info const& info,
+            hpx::util::function_nonser<void(hpx::util::log_histogram&, bool)>
+                const& f,
+            error_code& ec)
+        {
+            counter_path_elements paths;
+            get_counter_path_elements(info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            double percentile = 99.;
+            if (!paths.parameters_.empty())
+            {
+                percentile = util::from_string<double>(paths.parameters_, -1.);
+                if (!(percentile > 0. && percentile <= 100.))
+                {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "create_raw_percentile_counter",
+                        "invalid percentile specification for this counter "
+                        "(must be in (0, 100]): " +
+                            paths.parameters_);
+                    return naming::invalid_gid;
+                }
+            }
+
+            hpx::util::function_nonser<std::int64_t(bool)> value =
+                [f, percentile](bool reset) -> std::int64_t {
+                hpx::util::log_histogram histogram;
+                f(histogram, reset);
+                return static_cast<std::int64_t>(
+                    histogram.value_at_percentile(percentile));
+            };
+            return create_raw_counter(info, std::move(value), ec);
+        }
+
         // \brief Create a new performance counter instance based on given
         //        counter info
         naming::gid_type create_counter(
@@ -22,6 +22,8 @@ char const* const locality_pool_thread_counter_names[] =
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
     "/threads/wait-time/pending",
     "/threads/wait-time/staged",
+    "/threads/wait-time/pending-percentile",
+    "/threads/wait-time/staged-percentile",
 #endif
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
     "/threads/idle-rate",
@@ -43,6 +45,7 @@ char const* const locality_pool_thread_counter_names[] =
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
     "/threads/time/average",
     "/threads/time/average-phase",
+    "/threads/time/phase-percentile",
     "/threads/time/average-overhead",
     "/threads/time/average-phase-overhead",
     "/threads/time/cumulative",
@@ -57,6 +60,14 @@ char const* const locality_pool_thread_counter_names[] =
     "/threads/count/stolen-to-pending",
     "/threads/count/stolen-to-staged",
 #endif
+    "/threads/count/idle-parked",
+    "/threads/count/idle-unparked",
+    "/threads/time/idle-wake-latency",
+    "/threads/count/timers-armed",
+    "/threads/count/timers-fired",
+    "/threads/count/timers-cancelled",
+    "/threads/time/timer-lateness",
+    "/threads/time/timer-overhead",
     nullptr
 };
 
@@ -0,0 +1,142 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/performance_counters/shared_memory_segment.hpp>
+#include <hpx/util/export_counters.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace hpx::performance_counters::shared_memory;
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::int64_t> value(0);
+
+std::int64_t get_value(bool)
+{
+    return value.load();
+}
+
+void register_counter_type()
+{
+    hpx::performance_counters::install_counter_type(
+        "/test/exported", &get_value, "returns the value set by the test");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_export_counters()
+{
+    std::string const name =
+        "/hpx_export_counters_test." + std::to_string(::getpid());
+
+    // the interval is long enough for all updates to be triggered explicitly
+    value = 42;
+    hpx::util::export_counters exporter({"/test/exported"}, 3600000, name);
+    exporter.start();
+    HPX_TEST_EQ(exporter.segment_name(), name);
+
+    // map the segment writable to inspect the header and to be able to
+    // simulate an update in progress
+    int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    HPX_TEST(fd != -1);
+
+    std::size_t const size = segment_size(1);
+    void* p =
+        ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    HPX_TEST(p != MAP_FAILED);
+
+    segment_header* header = static_cast<segment_header*>(p);
+    HPX_TEST_EQ(header->magic.load(), segment_magic);
+    HPX_TEST_EQ(header->version.load(), segment_version);
+    HPX_TEST_EQ(header->num_counters.load(), std::uint64_t(1));
+
+    segment_reader reader;
+    HPX_TEST(reader.open(name));
+    HPX_TEST_EQ(reader.num_counters(), std::size_t(1));
+
+    // the values of the initial evaluation are visible
+    std::vector<counter_sample> samples;
+    std::int64_t timestamp = 0;
+    HPX_TEST(reader.read(samples, timestamp));
+    HPX_TEST_EQ(samples.size(), std::size_t(1));
+    HPX_TEST_EQ(
+        samples[0].name, std::string("/test{locality#0/total}/exported"));
+    HPX_TEST_EQ(samples[0].value, std::int64_t(42));
+    HPX_TEST_EQ(samples[0].get_value(), 42.0);
+    HPX_TEST(timestamp != 0);
+
+    // an explicit evaluation publishes the new value
+    value = 4711;
+    HPX_TEST(exporter.evaluate());
+
+    std::int64_t next_timestamp = 0;
+    HPX_TEST(reader.read(samples, next_timestamp));
+    HPX_TEST_EQ(samples[0].value, std::int64_t(4711));
+    HPX_TEST_LTE(timestamp, next_timestamp);
+
+    // readers retry while an update is in progress and eventually give up
+    begin_update(header);
+    HPX_TEST(!reader.read(samples, timestamp, 10));
+    end_update(header, next_timestamp);
+    HPX_TEST(reader.read(samples, timestamp, 10));
+    HPX_TEST_EQ(samples[0].value, std::int64_t(4711));
+
+    ::munmap(p, size);
+    reader.close();
+
+    // the segment is removed once the exporter has been stopped
+    exporter.stop();
+    HPX_TEST(!reader.open(name));
+}
+
+// counters not belonging to a particular locality can't be exported
+void test_export_non_local_counter()
+{
+    hpx::util::export_counters exporter(
+        {"/statistics{/test{locality#0/total}/exported}/max@100"}, 3600000,
+        "/hpx_export_counters_test_invalid." + std::to_string(::getpid()));
+
+    bool caught_exception = false;
+    try
+    {
+        exporter.start();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    test_export_counters();
+    test_export_non_local_counter();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::register_startup_function(&register_counter_type);
+
+    // Initialize and run HPX.
+    std::vector<std::string> const cfg = {"hpx.os_threads=1"};
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+
+    return hpx::util::report_errors();
+}
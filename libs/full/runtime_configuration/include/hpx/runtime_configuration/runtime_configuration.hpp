@@ -82,6 +82,10 @@ namespace hpx { namespace util {
         std::size_t get_agas_local_cache_size(
             std::size_t dflt = HPX_AGAS_LOCAL_CACHE_SIZE) const;
 
+        // Get number of shards the AGAS client-side local cache is split
+        // into (zero means one shard per OS thread)
+        std::size_t get_agas_local_cache_shards() const;
+
         bool get_agas_caching_mode() const;
 
         bool get_agas_range_caching_mode() const;
@@ -110,6 +114,7 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+        bool use_stack_pool() const;
 #endif
 
         // return trace_depth for stack-backtraces
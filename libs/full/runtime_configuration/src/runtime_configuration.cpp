@@ -202,6 +202,9 @@ namespace hpx { namespace util {
             "[hpx.lcos.collectives]",
             "arity = ${HPX_LCOS_COLLECTIVES_ARITY:32}",
             "cut_off = ${HPX_LCOS_COLLECTIVES_CUT_OFF:-1}",
+            // topology used by all_reduce, all_gather, and broadcast_to/from
+            "topology = ${HPX_LCOS_COLLECTIVES_TOPOLOGY:automatic}",
+            "min_sites = ${HPX_LCOS_COLLECTIVES_MIN_SITES:8}",
 
             // connect back to the given latch if specified
             "[hpx.on_startup]",
@@ -225,6 +228,7 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_pool = ${HPX_USE_STACK_POOL:0}",
 #endif
 
             "[hpx.threadpools]",
@@ -315,6 +319,7 @@ namespace hpx { namespace util {
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
+            "local_cache_shards = ${HPX_AGAS_LOCAL_CACHE_SHARDS:0}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
 
@@ -924,6 +929,20 @@ namespace hpx { namespace util {
         return cache_size;
     }
 
+    std::size_t runtime_configuration::get_agas_local_cache_shards() const
+    {
+        if (has_section("hpx.agas"))
+        {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "local_cache_shards", 0);
+            }
+        }
+        return 0;
+    }
+
     bool runtime_configuration::get_agas_caching_mode() const
     {
         if (has_section("hpx.agas"))
@@ -1214,6 +1233,19 @@ namespace hpx { namespace util {
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::use_stack_pool() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<int>(*sec, "use_pool", 0) != 0;
+            }
+        }
+        return false;    // default is false
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
@@ -0,0 +1,422 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_local/dataflow.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Every segment contributes this many samples per participating
+        // segment to the selection of the splitters.
+        static const std::size_t sample_sort_oversampling = 16;
+
+        // generate a name for the collective operations of one invocation of
+        // the segmented sort which is unique across all localities
+        inline std::string segmented_sort_basename()
+        {
+            static std::atomic<std::size_t> invocation(0);
+            return "/hpx/segmented_sort/" +
+                std::to_string(hpx::get_locality_id()) + "/" +
+                std::to_string(++invocation) + "/";
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        void sample_sort_local(ExPolicy& policy, RandomIt first, RandomIt last,
+            Compare& comp, Proj& proj, std::true_type)
+        {
+            sort<RandomIt>::sequential(policy, first, last, comp, proj);
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        void sample_sort_local(ExPolicy& policy, RandomIt first, RandomIt last,
+            Compare& comp, Proj& proj, std::false_type)
+        {
+            sort<RandomIt>::sort_async(policy, first, last, comp, proj,
+                std::integral_constant<bool,
+                    is_radix_sortable<RandomIt, Compare, Proj>::value>())
+                .get();
+        }
+
+        // Sort one segment of a segmented range as one of num_sites
+        // participants in a distributed sample sort (a single segment is
+        // just sorted locally):
+        //
+        //  - sort the segment locally,
+        //  - select num_sites-1 splitters from regular samples of all
+        //    segments (all_gather),
+        //  - send the elements falling between two splitters to the segment
+        //    owning the corresponding bucket (all_to_all) and merge the
+        //    received sorted runs,
+        //  - move the merged buckets back into place, keeping the size of
+        //    every segment unchanged (all_to_all).
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj, typename IsSeq>
+        RandomIt sample_sort_segment(ExPolicy&& policy, RandomIt first,
+            RandomIt last, std::string const& basename, std::size_t this_site,
+            std::size_t num_sites, Compare&& comp, Proj&& proj, IsSeq)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            util::compare_projected<typename std::decay<Compare>::type,
+                typename std::decay<Proj>::type>
+                less(comp, proj);
+
+            // sort the local part of the sequence
+            sample_sort_local(policy, first, last, comp, proj, IsSeq());
+            if (num_sites == 1)
+                return last;
+
+            // pick regularly spaced samples from the sorted segment, all
+            // segments contribute the same number of samples regardless of
+            // their size (short segments contribute some elements repeatedly)
+            std::size_t const count = std::distance(first, last);
+            std::size_t const num_samples =
+                sample_sort_oversampling * num_sites;
+
+            std::vector<value_type> samples;
+            samples.reserve(num_samples);
+            for (std::size_t i = 0; i != num_samples; ++i)
+            {
+                samples.push_back(
+                    *std::next(first, (2 * i + 1) * count / (2 * num_samples)));
+            }
+
+            // all segments select the same splitters from the combined samples
+            std::string const samples_name = basename + "samples/";
+            std::vector<std::vector<value_type>> all_samples =
+                hpx::lcos::all_gather(samples_name.c_str(), std::move(samples),
+                    num_sites, std::size_t(-1), this_site)
+                    .get();
+
+            std::vector<value_type> combined;
+            combined.reserve(num_samples * num_sites);
+            for (auto& s : all_samples)
+            {
+                HPX_ASSERT(s.size() == num_samples);
+                std::move(s.begin(), s.end(), std::back_inserter(combined));
+            }
+            std::sort(combined.begin(), combined.end(), less);
+
+            // bucket j holds the local elements in between splitter j-1 and
+            // splitter j
+            std::vector<std::size_t> bounds(num_sites + 1, 0);
+            for (std::size_t j = 1; j != num_sites; ++j)
+            {
+                value_type const& splitter =
+                    combined[j * combined.size() / num_sites];
+                bounds[j] = std::distance(first,
+                    std::upper_bound(std::next(first, bounds[j - 1]), last,
+                        splitter, less));
+            }
+            bounds[num_sites] = count;
+
+            std::vector<std::size_t> bucket_sizes(num_sites);
+            for (std::size_t j = 0; j != num_sites; ++j)
+            {
+                bucket_sizes[j] = bounds[j + 1] - bounds[j];
+            }
+
+            // all segments need to know the sizes of all buckets to calculate
+            // where the merged buckets go
+            std::string const counts_name = basename + "counts/";
+            std::vector<std::vector<std::size_t>> all_sizes =
+                hpx::lcos::all_gather(counts_name.c_str(),
+                    std::move(bucket_sizes), num_sites, std::size_t(-1),
+                    this_site)
+                    .get();
+
+            // global offset of every segment and of the bucket owned by this
+            // segment
+            std::vector<std::size_t> segment_offsets(num_sites + 1, 0);
+            std::size_t bucket_offset = 0;
+            for (std::size_t i = 0; i != num_sites; ++i)
+            {
+                std::size_t segment_size = 0;
+                for (std::size_t j = 0; j != num_sites; ++j)
+                {
+                    segment_size += all_sizes[i][j];
+                    if (j < this_site)
+                        bucket_offset += all_sizes[i][j];
+                }
+                segment_offsets[i + 1] = segment_offsets[i] + segment_size;
+            }
+
+            // send every bucket to the segment owning it
+            std::vector<std::vector<value_type>> outgoing(num_sites);
+            for (std::size_t j = 0; j != num_sites; ++j)
+            {
+                outgoing[j].assign(
+                    std::make_move_iterator(std::next(first, bounds[j])),
+                    std::make_move_iterator(std::next(first, bounds[j + 1])));
+            }
+
+            std::string const data_name = basename + "data/";
+            std::vector<std::vector<value_type>> incoming =
+                hpx::lcos::all_to_all(data_name.c_str(), std::move(outgoing),
+                    num_sites, std::size_t(-1), this_site)
+                    .get();
+
+            // merge the received sorted runs
+            std::vector<value_type> bucket;
+            std::vector<std::size_t> runs(1, 0);
+            for (auto& run : incoming)
+            {
+                std::move(run.begin(), run.end(), std::back_inserter(bucket));
+                runs.push_back(bucket.size());
+            }
+            incoming.clear();
+
+            while (runs.size() > 2)
+            {
+                std::vector<std::size_t> merged(1, 0);
+                std::size_t i = 2;
+                for (/**/; i < runs.size(); i += 2)
+                {
+                    std::inplace_merge(bucket.begin() + runs[i - 2],
+                        bucket.begin() + runs[i - 1], bucket.begin() + runs[i],
+                        less);
+                    merged.push_back(runs[i]);
+                }
+                if (i == runs.size())
+                    merged.push_back(runs.back());
+                runs = std::move(merged);
+            }
+
+            // the merged bucket covers the global positions
+            // [bucket_offset, bucket_offset + bucket.size()), send every
+            // segment the part overlapping with its range
+            std::size_t const bucket_end = bucket_offset + bucket.size();
+            outgoing.assign(num_sites, std::vector<value_type>());
+            for (std::size_t i = 0; i != num_sites; ++i)
+            {
+                std::size_t const lo =
+                    (std::max)(segment_offsets[i], bucket_offset);
+                std::size_t const hi =
+                    (std::min)(segment_offsets[i + 1], bucket_end);
+                if (lo < hi)
+                {
+                    outgoing[i].assign(std::make_move_iterator(bucket.begin() +
+                                           (lo - bucket_offset)),
+                        std::make_move_iterator(
+                            bucket.begin() + (hi - bucket_offset)));
+                }
+            }
+            bucket.clear();
+
+            std::string const redistribute_name = basename + "redistribute/";
+            incoming = hpx::lcos::all_to_all(redistribute_name.c_str(),
+                std::move(outgoing), num_sites, std::size_t(-1), this_site)
+                           .get();
+
+            // the buckets are ordered by site, so the received pieces form
+            // the contiguous sorted range owned by this segment
+            RandomIt dest = first;
+            for (auto& piece : incoming)
+            {
+                dest = std::move(piece.begin(), piece.end(), dest);
+            }
+            HPX_ASSERT(dest == last);
+
+            return last;
+        }
+
+        template <typename Iter>
+        struct sample_sort_segment_algo
+          : public detail::algorithm<sample_sort_segment_algo<Iter>, Iter>
+        {
+            sample_sort_segment_algo()
+              : sample_sort_segment_algo::algorithm("sample_sort_segment")
+            {
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static RandomIt sequential(ExPolicy&& policy, RandomIt first,
+                RandomIt last, std::string const& basename,
+                std::size_t this_site, std::size_t num_sites, Compare&& comp,
+                Proj&& proj)
+            {
+                return sample_sort_segment(std::forward<ExPolicy>(policy),
+                    first, last, basename, this_site, num_sites,
+                    std::forward<Compare>(comp), std::forward<Proj>(proj),
+                    std::true_type());
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt last,
+                std::string const& basename, std::size_t this_site,
+                std::size_t num_sites, Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    return algorithm_result::get(
+                        sample_sort_segment(std::forward<ExPolicy>(policy),
+                            first, last, basename, this_site, num_sites,
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj), std::false_type()));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj, typename IsSeq>
+        static typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_sort(ExPolicy const& policy, SegIter first, SegIter last,
+            Compare&& comp, Proj&& proj, IsSeq)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef util::detail::algorithm_result<ExPolicy, SegIter> result;
+
+            // collect all non-empty parts of the segments in the range
+            std::vector<id_type> ids;
+            std::vector<local_iterator_type> begins;
+            std::vector<local_iterator_type> ends;
+
+            auto add_segment = [&](segment_iterator const& sit,
+                                   local_iterator_type const& beg,
+                                   local_iterator_type const& end) {
+                if (beg != end)
+                {
+                    ids.push_back(traits::get_id(sit));
+                    begins.push_back(beg);
+                    ends.push_back(end);
+                }
+            };
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                add_segment(sit, traits::local(first), traits::local(last));
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                add_segment(sit, traits::local(first), traits::end(sit));
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    add_segment(sit, traits::begin(sit), traits::end(sit));
+                }
+
+                // handle the beginning of the last partition
+                add_segment(sit, traits::begin(sit), traits::local(last));
+            }
+
+            std::size_t const num_sites = ids.size();
+
+            // all segments participate in the collective operations, so they
+            // have to run concurrently regardless of the execution policy
+            std::string const basename =
+                num_sites == 1 ? std::string() : segmented_sort_basename();
+
+            std::vector<future<local_iterator_type>> segments;
+            segments.reserve(num_sites);
+
+            for (std::size_t i = 0; i != num_sites; ++i)
+            {
+                segments.push_back(dispatch_async(ids[i],
+                    sample_sort_segment_algo<local_iterator_type>(), policy,
+                    IsSeq(), begins[i], ends[i], basename, i, num_sites, comp,
+                    proj));
+            }
+
+            return result::get(dataflow(
+                [last](std::vector<hpx::future<local_iterator_type>>&& r)
+                    -> SegIter {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy>::call(r, errors);
+                    return last;
+                },
+                std::move(segments)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        sort_(ExPolicy&& policy, SegIter first, SegIter last, Compare&& comp,
+            Proj&& proj, std::true_type)
+        {
+            typedef parallel::execution::is_sequenced_execution_policy<ExPolicy>
+                is_seq;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<ExPolicy, SegIter>::get(
+                    std::move(last));
+            }
+
+            return segmented_sort(std::forward<ExPolicy>(policy), first, last,
+                std::forward<Compare>(comp), std::forward<Proj>(proj),
+                is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy&& policy, RandomIt first, RandomIt last, Compare&& comp,
+            Proj&& proj, std::false_type);
+
+        /// \endcond
+    }    // namespace detail
+}}}    // namespace hpx::parallel::v1
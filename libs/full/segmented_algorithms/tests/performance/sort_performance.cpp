@@ -0,0 +1,158 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares sorting a partitioned_vector in place with the
+// segmented (sample) sort against gathering all elements on the calling
+// locality, sorting them there, and scattering them back. Run it with several
+// localities on one host, e.g. using --hpx:localities=4.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/parallel_generate.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+unsigned int seed = (unsigned int) std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+struct random_fill
+{
+    random_fill()
+      : gen(seed)
+      , dist(0, RAND_MAX)
+    {
+    }
+
+    int operator()()
+    {
+        return dist(gen);
+    }
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<> dist;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+double run_segmented_sort_benchmark(
+    int test_count, hpx::partitioned_vector<int>& v)
+{
+    std::uint64_t time = 0;
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::generate(hpx::execution::par, v.begin(), v.end(), random_fill());
+
+        std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+        hpx::parallel::sort(hpx::execution::par, v.begin(), v.end());
+
+        time += hpx::util::high_resolution_clock::now() - start;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double run_gather_sort_benchmark(
+    int test_count, hpx::partitioned_vector<int>& v)
+{
+    std::vector<std::size_t> positions(v.size());
+    std::iota(positions.begin(), positions.end(), std::size_t(0));
+
+    std::uint64_t time = 0;
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::generate(hpx::execution::par, v.begin(), v.end(), random_fill());
+
+        std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+        std::vector<int> values = v.get_values(hpx::launch::sync, positions);
+        hpx::parallel::sort(hpx::execution::par, values.begin(), values.end());
+        v.set_values(hpx::launch::sync, positions, values);
+
+        time += hpx::util::high_resolution_clock::now() - start;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        // pull values from cmd
+        std::size_t size = vm["vector_size"].as<std::size_t>();
+        int test_count = vm["test_count"].as<int>();
+
+        if (vm.count("seed"))
+            seed = vm["seed"].as<unsigned int>();
+
+        // create as many partitions as we have localities
+        std::vector<hpx::id_type> localities = hpx::find_all_localities();
+        hpx::partitioned_vector<int> v(
+            size, hpx::container_layout(localities));
+
+        // run benchmark
+        double time_segmented = run_segmented_sort_benchmark(test_count, v);
+        double time_gather = run_gather_sort_benchmark(test_count, v);
+
+        std::cout << "localities," << localities.size() << std::endl;
+        std::cout << "segmented_sort" << test_count << "," << time_segmented
+                  << std::endl;
+        std::cout << "gather_sort" << test_count << "," << time_gather
+                  << std::endl;
+
+        return hpx::finalize();
+    }
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    // initialize program
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all", "hpx.run_hpx_main!=1"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size",
+         hpx::program_options::value<std::size_t>()->default_value(1000000),
+         "size of vector (default: 1000000)")
+        ("test_count",
+         hpx::program_options::value<int>()->default_value(10),
+         "number of tests to be averaged (default: 10)")
+        ("seed,s", hpx::program_options::value<unsigned int>(),
+         "the random number generator seed to use for this run");
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
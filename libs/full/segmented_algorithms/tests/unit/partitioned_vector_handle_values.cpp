@@ -104,6 +104,72 @@ void handle_values_tests_distributed_access(hpx::partitioned_vector<T>& v)
     compare_vectors(values2, result2);
 }
 
+template <typename T>
+void handle_values_tests_scattered_access(hpx::partitioned_vector<T>& v)
+{
+    fill_vector(v, T(42));
+
+    // positions spread over all partitions, in no particular order
+    std::vector<std::size_t> positions = {11, 0, 7, 3, 10, 1, 5, 6};
+
+    std::vector<T> values(positions.size());
+    fill_vector(values, T(48), T(3));
+
+    v.set_values(hpx::launch::sync, positions, values);
+
+    std::vector<T> result = v.get_values(hpx::launch::sync, positions);
+    compare_vectors(values, result);
+
+    std::vector<std::size_t> order;
+    std::vector<T> unordered =
+        v.get_values_unordered(hpx::launch::sync, positions, order);
+
+    HPX_TEST_EQ(unordered.size(), positions.size());
+    HPX_TEST_EQ(order.size(), positions.size());
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(unordered[i], values[order[i]]);
+    }
+
+    // the values are grouped by partition
+    for (std::size_t i = 1; i < order.size(); ++i)
+    {
+        HPX_TEST_LTE(v.get_partition(positions[order[i - 1]]),
+            v.get_partition(positions[order[i]]));
+    }
+}
+
+template <typename T>
+void handle_values_tests_last_partition(hpx::partitioned_vector<T>& v)
+{
+    fill_vector(v, T(42));
+
+    // all positions of the last partition, in reverse order
+    std::size_t const part = v.get_partition(v.size() - 1);
+
+    std::vector<std::size_t> positions;
+    std::vector<std::size_t> global_positions;
+    for (std::size_t i = v.size(); i != 0 && v.get_partition(i - 1) == part;
+         --i)
+    {
+        positions.push_back(v.get_local_index(i - 1));
+        global_positions.push_back(i - 1);
+    }
+
+    std::vector<T> values(positions.size());
+    fill_vector(values, T(48), T(3));
+
+    v.set_values(hpx::launch::sync, part, positions, values);
+
+    std::vector<T> result =
+        v.get_values(hpx::launch::sync, part, positions);
+    compare_vectors(values, result);
+
+    std::vector<T> result2 =
+        v.get_values(hpx::launch::sync, global_positions);
+    compare_vectors(values, result2);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 template <typename T, typename DistPolicy>
@@ -119,6 +185,16 @@ void handle_values_tests_with_policy(
         hpx::partitioned_vector<T> v(size, policy);
         handle_values_tests_distributed_access(v);
     }
+
+    {
+        hpx::partitioned_vector<T> v(size, policy);
+        handle_values_tests_scattered_access(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(size, policy);
+        handle_values_tests_last_partition(v);
+    }
 }
 
 template <typename T>
@@ -0,0 +1,153 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_random(hpx::partitioned_vector<T>& v)
+{
+    // use a small range of values to get plenty of duplicates
+    std::uniform_int_distribution<int> dis(0, int(v.size() / 4));
+
+    std::vector<T> values(v.size());
+    for (auto& val : values)
+        val = T(dis(gen));
+
+    std::copy(values.begin(), values.end(), v.begin());
+    return values;
+}
+
+template <typename T, typename Compare>
+void verify_sorted(hpx::partitioned_vector<T> const& v,
+    std::vector<T> expected, std::size_t front, std::size_t back,
+    Compare comp)
+{
+    std::sort(expected.begin() + front, expected.end() - back, comp);
+
+    std::size_t count = 0;
+    for (T const& val : v)
+    {
+        HPX_TEST_EQ(val, expected[count]);
+        ++count;
+    }
+    HPX_TEST_EQ(count, expected.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& sort_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+
+    // sort the whole vector
+    std::vector<T> values = fill_random(c);
+    auto result = hpx::parallel::sort(sort_policy, c.begin(), c.end());
+    HPX_TEST(result == c.end());
+    verify_sorted(c, values, 0, 0, std::less<T>());
+
+    // sort a sub-range spanning partial segments, descending
+    values = fill_random(c);
+    hpx::parallel::sort(
+        sort_policy, c.begin() + 1, c.end() - 1, std::greater<T>());
+    verify_sorted(c, values, 1, 1, std::greater<T>());
+}
+
+// the sorted range covers parts of the first and the last segment of
+// different lengths, thus every segment holds a different number of elements
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_uneven_with_policy(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& sort_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+
+    std::size_t const front = size / 20 + 1;
+    std::size_t const back = size / 50;
+
+    std::vector<T> values = fill_random(c);
+    auto result = hpx::parallel::sort(
+        sort_policy, c.begin() + front, c.end() - back, std::less<T>());
+    HPX_TEST(result == c.end() - back);
+    verify_sorted(c, values, front, back, std::less<T>());
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy_async(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& sort_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+
+    std::vector<T> values = fill_random(c);
+    auto f = hpx::parallel::sort(sort_policy, c.begin(), c.end());
+    HPX_TEST(f.get() == c.end());
+    verify_sorted(c, values, 0, 0, std::less<T>());
+}
+
+template <typename T, typename DistPolicy>
+void sort_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    sort_algo_tests_with_policy<T>(size, policy, seq);
+    sort_algo_tests_with_policy<T>(size, policy, par);
+    sort_algo_tests_uneven_with_policy<T>(size, policy, seq);
+    sort_algo_tests_uneven_with_policy<T>(size, policy, par);
+
+    //async
+    sort_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    sort_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void sort_tests()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    for (std::size_t length : {std::size_t(12), std::size_t(10007)})
+    {
+        sort_tests_with_policy<T>(length, hpx::container_layout);
+        sort_tests_with_policy<T>(length, hpx::container_layout(3));
+        sort_tests_with_policy<T>(
+            length, hpx::container_layout(3, localities));
+        sort_tests_with_policy<T>(length, hpx::container_layout(localities));
+
+        // more segments than fit evenly into the sequence
+        sort_tests_with_policy<T>(length, hpx::container_layout(9));
+        sort_tests_with_policy<T>(
+            length, hpx::container_layout(11, localities));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::cout << "using seed: " << seed << std::endl;
+
+    sort_tests<double>();
+    sort_tests<int>();
+
+    return 0;
+}
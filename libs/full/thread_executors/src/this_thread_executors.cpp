@@ -24,6 +24,7 @@
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 #include <hpx/thread_executors/detail/on_self_reset.hpp>
 #include <hpx/thread_executors/manage_thread_executor.hpp>
 #include <hpx/thread_executors/resource_manager.hpp>
@@ -343,10 +344,17 @@ namespace hpx { namespace threads { namespace executors { namespace detail {
             std::int64_t bg_work = 0;
             std::int64_t bg_send = 0;
             std::int64_t bg_receive = 0;
+            util::log_histogram thread_times_histogram;
             threads::detail::scheduling_counters counters(executed_threads,
                 executed_thread_phases, overall_times, thread_times,
                 idle_loop_count, busy_loop_count, task_active, bg_work, bg_send,
-                bg_receive);
+                bg_receive, thread_times_histogram, 1.0);
+#elif defined(HPX_HAVE_THREAD_IDLE_RATES)
+            util::log_histogram thread_times_histogram;
+            threads::detail::scheduling_counters counters(executed_threads,
+                executed_thread_phases, overall_times, thread_times,
+                idle_loop_count, busy_loop_count, task_active,
+                thread_times_histogram, 1.0);
 #else
             threads::detail::scheduling_counters counters(executed_threads,
                 executed_thread_phases, overall_times, thread_times,
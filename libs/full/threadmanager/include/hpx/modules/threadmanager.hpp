@@ -14,6 +14,7 @@
 #include <hpx/io_service/io_service_pool.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/statistics/log_histogram.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
@@ -313,6 +314,10 @@ namespace hpx { namespace threads {
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::int64_t get_average_thread_wait_time(bool reset);
         std::int64_t get_average_task_wait_time(bool reset);
+        void get_thread_wait_time_histogram(
+            util::log_histogram& result, bool reset);
+        void get_task_wait_time_histogram(
+            util::log_histogram& result, bool reset);
 #endif
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
@@ -373,6 +378,8 @@ namespace hpx { namespace threads {
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
         std::int64_t get_thread_duration(bool reset);
         std::int64_t get_thread_phase_duration(bool reset);
+        void get_thread_phase_duration_histogram(
+            util::log_histogram& result, bool reset);
         std::int64_t get_thread_overhead(bool reset);
         std::int64_t get_thread_phase_overhead(bool reset);
         std::int64_t get_cumulative_thread_duration(bool reset);
@@ -389,6 +396,16 @@ namespace hpx { namespace threads {
         std::int64_t get_num_stolen_to_staged(bool reset);
 #endif
 
+        std::int64_t get_idle_park_count(bool reset);
+        std::int64_t get_idle_unpark_count(bool reset);
+        std::int64_t get_idle_wake_latency(bool reset);
+
+        std::int64_t get_timers_armed_count(bool reset);
+        std::int64_t get_timers_fired_count(bool reset);
+        std::int64_t get_timers_cancelled_count(bool reset);
+        std::int64_t get_timer_lateness(bool reset);
+        std::int64_t get_timer_overhead(bool reset);
+
     private:
         mutable mutex_type mtx_;    // mutex protecting the members
 
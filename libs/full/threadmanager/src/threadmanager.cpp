@@ -840,6 +840,21 @@ namespace hpx { namespace threads {
             result += pool_iter->get_average_task_wait_time(all_threads, reset);
         return result;
     }
+
+    void threadmanager::get_thread_wait_time_histogram(
+        util::log_histogram& result, bool reset)
+    {
+        for (auto const& pool_iter : pools_)
+            pool_iter->get_thread_wait_time_histogram(
+                all_threads, result, reset);
+    }
+
+    void threadmanager::get_task_wait_time_histogram(
+        util::log_histogram& result, bool reset)
+    {
+        for (auto const& pool_iter : pools_)
+            pool_iter->get_task_wait_time_histogram(all_threads, result, reset);
+    }
 #endif
 
     std::int64_t threadmanager::get_cumulative_duration(bool reset)
@@ -968,6 +983,14 @@ namespace hpx { namespace threads {
         return result;
     }
 
+    void threadmanager::get_thread_phase_duration_histogram(
+        util::log_histogram& result, bool reset)
+    {
+        for (auto const& pool_iter : pools_)
+            pool_iter->get_thread_phase_duration_histogram(
+                all_threads, result, reset);
+    }
+
     std::int64_t threadmanager::get_thread_overhead(bool reset)
     {
         std::int64_t result = 0;
@@ -1055,6 +1078,100 @@ namespace hpx { namespace threads {
     }
 #endif
 
+    std::int64_t threadmanager::get_idle_park_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_idle_park_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_idle_unpark_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_idle_unpark_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_idle_wake_latency(bool reset)
+    {
+        // average over all pools which have woken up parked threads
+        std::int64_t result = 0;
+        std::int64_t count = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            std::int64_t latency =
+                pool_iter->get_idle_wake_latency(all_threads, reset);
+            if (latency != 0)
+            {
+                result += latency;
+                ++count;
+            }
+        }
+        return count == 0 ? 0 : result / count;
+    }
+
+    std::int64_t threadmanager::get_timers_armed_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_timers_armed_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_timers_fired_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_timers_fired_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_timers_cancelled_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_timers_cancelled_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_timer_lateness(bool reset)
+    {
+        // average over all pools which have fired timers
+        std::int64_t result = 0;
+        std::int64_t count = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            std::int64_t lateness =
+                pool_iter->get_timer_lateness(all_threads, reset);
+            if (lateness != 0)
+            {
+                result += lateness;
+                ++count;
+            }
+        }
+        return count == 0 ? 0 : result / count;
+    }
+
+    std::int64_t threadmanager::get_timer_overhead(bool reset)
+    {
+        // average over all pools which have fired timers
+        std::int64_t result = 0;
+        std::int64_t count = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            std::int64_t overhead =
+                pool_iter->get_timer_overhead(all_threads, reset);
+            if (overhead != 0)
+            {
+                result += overhead;
+                ++count;
+            }
+        }
+        return count == 0 ? 0 : result / count;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     std::size_t threadmanager::shrink_pool(std::string const& pool_name)
     {
@@ -0,0 +1,55 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Find the point where the given diagonal crosses the merge path of the
+    // sorted sequences [first1, first1 + len1) and [first2, first2 + len2),
+    // i.e. the number of elements taken from the first sequence when
+    // producing the first 'diagonal' elements of the merged sequence.
+    // Elements of the first sequence precede equivalent elements of the
+    // second one, which keeps the merge stable.
+    template <typename RanIter1, typename RanIter2, typename Comp,
+        typename Proj1, typename Proj2>
+    std::size_t merge_path_search(RanIter1 first1, std::size_t len1,
+        RanIter2 first2, std::size_t len2, std::size_t diagonal, Comp&& comp,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        std::size_t lo = diagonal > len2 ? diagonal - len2 : 0;
+        std::size_t hi = (std::min)(diagonal, len1);
+
+        while (lo < hi)
+        {
+            std::size_t mid = lo + (hi - lo) / 2;
+            RanIter1 it1 = first1 + mid;
+            RanIter2 it2 = first2 + (diagonal - mid - 1);
+
+            if (!hpx::util::invoke(comp, hpx::util::invoke(proj2, *it2),
+                    hpx::util::invoke(proj1, *it1)))
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        return lo;
+    }
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,395 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/iterator_support.hpp>
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // Sequences shorter than this are sorted using the comparison based
+    // algorithms.
+    static constexpr std::size_t radix_sort_limit = 65536ul;
+
+    // Each pass of the radix sort handles one digit of this many bits.
+    static constexpr std::size_t radix_sort_digit_bits = 8;
+    static constexpr std::size_t radix_sort_num_buckets =
+        std::size_t(1) << radix_sort_digit_bits;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Map arithmetic values onto unsigned integers preserving their order.
+    template <typename T, typename Enable = void>
+    struct radix_sort_key_traits
+    {
+        static constexpr bool is_valid = false;
+    };
+
+    template <typename T>
+    struct radix_sort_key_traits<T,
+        typename std::enable_if<std::is_integral<T>::value &&
+            !std::is_same<T, bool>::value>::type>
+    {
+        static constexpr bool is_valid = true;
+
+        using type = typename std::make_unsigned<T>::type;
+
+        static type get(T value) noexcept
+        {
+            // flip the sign bit of signed values, this moves all negative
+            // values in front of the positive ones
+            return std::is_signed<T>::value ?
+                type(type(value) ^
+                    type(type(1) << (sizeof(T) * CHAR_BIT - 1))) :
+                type(value);
+        }
+    };
+
+    template <typename T>
+    struct radix_sort_key_traits<T,
+        typename std::enable_if<std::is_floating_point<T>::value &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>::type>
+    {
+        static constexpr bool is_valid = true;
+
+        using type = typename std::conditional<sizeof(T) ==
+                sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>::type;
+
+        static type get(T value) noexcept
+        {
+            // -0.0 and +0.0 compare equal, they have to be mapped onto the
+            // same key for stable sorting
+            if (value == T(0))
+                value = T(0);
+
+            type bits;
+            std::memcpy(&bits, &value, sizeof(T));
+
+            // negative values are ordered in reverse, positive values are
+            // moved behind all negative ones
+            type const sign_bit = type(1) << (sizeof(T) * CHAR_BIT - 1);
+            return (bits & sign_bit) ? type(~bits) : type(bits | sign_bit);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Comparison function objects the radix sort is able to emulate, the
+    // value is 1 for ascending and -1 for descending order.
+    template <typename Compare, typename Key>
+    struct radix_sort_direction : std::integral_constant<int, 0>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<detail::less, Key>
+      : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<std::less<Key>, Key>
+      : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<std::less<>, Key>
+      : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<detail::greater, Key>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<std::greater<Key>, Key>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<std::greater<>, Key>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter, typename Compare, typename Proj>
+    struct radix_sort_key_type
+    {
+        using type = typename std::decay<typename hpx::util::invoke_result<
+            Proj, typename std::iterator_traits<Iter>::reference>::type>::type;
+    };
+
+    // The elements of [first, last) can be sorted using the radix sort if the
+    // (projected) keys are arithmetic values and the comparison function
+    // object is one of the standard orderings.
+    template <typename Iter, typename Compare, typename Proj>
+    struct is_radix_sortable
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using key_type =
+            typename radix_sort_key_type<Iter, Compare, Proj>::type;
+
+        static constexpr bool value =
+            radix_sort_key_traits<key_type>::is_valid &&
+            radix_sort_direction<typename std::decay<Compare>::type,
+                key_type>::value != 0 &&
+            std::is_default_constructible<value_type>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Function object returning the unsigned integer key of an element.
+    template <typename Proj, typename Key, bool Descending>
+    struct radix_sort_key
+    {
+        using traits = radix_sort_key_traits<Key>;
+        using type = typename traits::type;
+
+        template <typename T>
+        type operator()(T&& t) const
+        {
+            type key =
+                traits::get(hpx::util::invoke(proj_, std::forward<T>(t)));
+            return Descending ? type(~key) : key;
+        }
+
+        Proj proj_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parallel least significant digit radix sort. Every pass distributes the
+    // elements by one digit of their key between the input sequence and a
+    // buffer of the same size. Each pass consists of two parallel steps
+    // operating on the same chunks: the histograms of the digits of all
+    // chunks are built, and the elements of all chunks are scattered to their
+    // final positions for this pass. The order of elements with equal keys is
+    // preserved, thus the algorithm can be used for stable sorting as well.
+    template <typename Iter, typename KeyOf>
+    struct radix_sort_helper
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using key_type = typename KeyOf::type;
+        using histogram_type = std::array<std::size_t, radix_sort_num_buckets>;
+
+        radix_sort_helper(Iter first, std::size_t count, std::size_t num_chunks,
+            KeyOf const& key_of)
+          : first_(first)
+          , count_(count)
+          , chunk_size_((count + num_chunks - 1) / num_chunks)
+          , num_chunks_((count + chunk_size_ - 1) / chunk_size_)
+          , buffer_(new value_type[count])
+          , histograms_(num_chunks_)
+          , key_of_(key_of)
+        {
+        }
+
+        static std::size_t get_digit(key_type key, std::size_t shift) noexcept
+        {
+            return std::size_t(key >> shift) & (radix_sort_num_buckets - 1);
+        }
+
+        template <typename Src>
+        void build_histogram(Src src, std::size_t chunk, std::size_t shift)
+        {
+            histogram_type& histogram = histograms_[chunk];
+            histogram.fill(0);
+
+            std::size_t const end = (std::min)(
+                (chunk + 1) * chunk_size_, count_);
+            for (std::size_t i = chunk * chunk_size_; i != end; ++i)
+            {
+                ++histogram[get_digit(key_of_(*(src + i)), shift)];
+            }
+        }
+
+        template <typename Src, typename Dest>
+        void scatter(Src src, Dest dest, std::size_t chunk, std::size_t shift)
+        {
+            histogram_type& offsets = histograms_[chunk];
+
+            std::size_t const end = (std::min)(
+                (chunk + 1) * chunk_size_, count_);
+            for (std::size_t i = chunk * chunk_size_; i != end; ++i)
+            {
+                Src it = src + i;
+                std::size_t pos = offsets[get_digit(key_of_(*it), shift)]++;
+                *(dest + pos) = std::move(*it);
+            }
+        }
+
+        // Turn the histograms of all chunks into the positions the elements
+        // of each chunk have to be moved to. Returns false if all elements
+        // have the same digit, in which case the pass can be skipped.
+        bool compute_offsets()
+        {
+            std::size_t offset = 0;
+            for (std::size_t bucket = 0; bucket != radix_sort_num_buckets;
+                 ++bucket)
+            {
+                std::size_t const start = offset;
+                for (histogram_type& histogram : histograms_)
+                {
+                    std::size_t const n = histogram[bucket];
+                    histogram[bucket] = offset;
+                    offset += n;
+                }
+
+                if (offset - start == count_)
+                    return false;
+            }
+            return true;
+        }
+
+        template <typename Exec, typename Src, typename Dest>
+        bool pass(Exec&& exec, Src src, Dest dest, std::size_t shift)
+        {
+            auto shape = hpx::util::make_iterator_range(
+                hpx::util::make_counting_iterator(std::size_t(0)),
+                hpx::util::make_counting_iterator(num_chunks_));
+
+            hpx::when_all(execution::bulk_async_execute(
+                              exec,
+                              [&, this](std::size_t chunk) {
+                                  this->build_histogram(src, chunk, shift);
+                              },
+                              shape))
+                .get();
+
+            if (!compute_offsets())
+                return false;
+
+            hpx::when_all(execution::bulk_async_execute(
+                              exec,
+                              [&, this](std::size_t chunk) {
+                                  this->scatter(src, dest, chunk, shift);
+                              },
+                              shape))
+                .get();
+
+            return true;
+        }
+
+        template <typename Exec>
+        void operator()(Exec&& exec)
+        {
+            value_type* buffer = buffer_.get();
+            bool in_buffer = false;
+
+            for (std::size_t shift = 0; shift < sizeof(key_type) * CHAR_BIT;
+                 shift += radix_sort_digit_bits)
+            {
+                if (in_buffer)
+                {
+                    if (pass(exec, buffer, first_, shift))
+                        in_buffer = false;
+                }
+                else if (pass(exec, first_, buffer, shift))
+                {
+                    in_buffer = true;
+                }
+            }
+
+            // move the sorted elements back into the input sequence
+            if (in_buffer)
+            {
+                auto shape = hpx::util::make_iterator_range(
+                    hpx::util::make_counting_iterator(std::size_t(0)),
+                    hpx::util::make_counting_iterator(num_chunks_));
+
+                hpx::when_all(
+                    execution::bulk_async_execute(
+                        exec,
+                        [&, this](std::size_t chunk) {
+                            std::size_t const begin = chunk * chunk_size_;
+                            std::size_t const end = (std::min)(
+                                begin + chunk_size_, count_);
+                            std::move(buffer + begin, buffer + end,
+                                first_ + begin);
+                        },
+                        shape))
+                    .get();
+            }
+        }
+
+        Iter first_;
+        std::size_t count_;
+        std::size_t chunk_size_;
+        std::size_t num_chunks_;
+        std::unique_ptr<value_type[]> buffer_;
+        std::vector<histogram_type> histograms_;
+        KeyOf key_of_;
+    };
+
+    template <typename ExPolicy, typename Iter, typename KeyOf>
+    Iter parallel_radix_sort(
+        ExPolicy policy, Iter first, Iter last, KeyOf const& key_of)
+    {
+        std::size_t const count = last - first;
+        HPX_ASSERT(count != 0);
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+
+        radix_sort_helper<Iter, KeyOf> helper(first, count, cores, key_of);
+        helper(policy.executor());
+
+        return last;
+    }
+
+    // Sort the elements of [first, last) by their (projected) arithmetic
+    // keys, the order of equal elements is preserved.
+    template <typename ExPolicy, typename Iter, typename Compare, typename Proj>
+    hpx::future<Iter> parallel_radix_sort_async(
+        ExPolicy&& policy, Iter first, Iter last, Compare&&, Proj&& proj)
+    {
+        using key_type =
+            typename radix_sort_key_type<Iter, Compare, Proj>::type;
+        using key_of_type = radix_sort_key<typename std::decay<Proj>::type,
+            key_type,
+            radix_sort_direction<typename std::decay<Compare>::type,
+                key_type>::value < 0>;
+
+        if (first == last)
+            return hpx::make_ready_future(last);
+
+        return execution::async_execute(policy.executor(),
+            &parallel_radix_sort<typename std::decay<ExPolicy>::type, Iter,
+                key_of_type>,
+            std::forward<ExPolicy>(policy), first, last,
+            key_of_type{std::forward<Proj>(proj)});
+    }
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
@@ -8,12 +8,15 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/type_support/unused.hpp>
 
 #include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
-#include <hpx/parallel/util/foreach_partitioner.hpp>
-#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/scan_partitioner.hpp>
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
@@ -21,7 +24,10 @@
 #include <memory>
 #endif
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -30,186 +36,202 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
     /// \cond NOINTERNAL
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename FwdIter>
-    struct set_operations_buffer
+    // Output iterator which discards the elements written to it, counting
+    // them instead. This is used to determine the size of the output of a
+    // set operation without storing it.
+    class counting_output_iterator
     {
+    public:
+        typedef std::output_iterator_tag iterator_category;
+        typedef void value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+        typedef void reference;
+
+        counting_output_iterator()
+          : count_(0)
+        {
+        }
+
         template <typename T>
-        class rewritable_ref
+        counting_output_iterator& operator=(T const&)
         {
-        public:
-            rewritable_ref()
-              : item_(0)
-            {
-            }
-            rewritable_ref(T const& item)
-              : item_(item)
-            {
-            }
+            return *this;
+        }
 
-            rewritable_ref& operator=(T const& item)
-            {
-                item_ = &item;
-                return *this;
-            }
+        counting_output_iterator& operator*()
+        {
+            return *this;
+        }
 
-            operator T const&() const
-            {
-                HPX_ASSERT(item_ != 0);
-                return *item_;
-            }
+        counting_output_iterator& operator++()
+        {
+            ++count_;
+            return *this;
+        }
 
-        private:
-            T const* item_;
-        };
+        counting_output_iterator operator++(int)
+        {
+            counting_output_iterator tmp(*this);
+            ++count_;
+            return tmp;
+        }
+
+        std::size_t count() const
+        {
+            return count_;
+        }
 
-        typedef typename std::iterator_traits<FwdIter>::value_type value_type;
-        typedef typename std::conditional<std::is_scalar<value_type>::value,
-            value_type, rewritable_ref<value_type>>::type type;
+    private:
+        std::size_t count_;
     };
 
     struct set_chunk_data
     {
         set_chunk_data()
         {
-            start = len = start_index = (std::size_t)(-1);
+            start1 = start2 = end1 = end2 = (std::size_t)(-1);
         }
-        std::size_t start;
-        std::size_t len;
-        std::size_t start_index;
+        std::size_t start1;
+        std::size_t start2;
+        std::size_t end1;
+        std::size_t end2;
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    // Split both sequences where the given diagonal crosses their merge
+    // path. The split is moved to the front of the run of equivalent
+    // elements it falls into, this way all equivalent elements of both
+    // sequences end up in the same chunk.
+    template <typename RanIter1, typename RanIter2, typename F>
+    std::pair<std::size_t, std::size_t> set_partition_point(RanIter1 first1,
+        std::size_t len1, RanIter2 first2, std::size_t len2,
+        std::size_t diagonal, F const& f)
+    {
+        if (diagonal == 0)
+            return std::make_pair(std::size_t(0), std::size_t(0));
+        if (diagonal >= len1 + len2)
+            return std::make_pair(len1, len2);
+
+        std::size_t i = merge_path_search(first1, len1, first2, len2,
+            diagonal, f, util::projection_identity(),
+            util::projection_identity());
+        std::size_t j = diagonal - i;
+
+        // all elements before the split compare less or equal than the
+        // element following it on the merge path
+        if (j == len2 || (i != len1 && !f(*(first2 + j), *(first1 + i))))
+        {
+            return std::make_pair(
+                std::size_t(
+                    std::lower_bound(first1, first1 + i, *(first1 + i), f) -
+                    first1),
+                std::size_t(
+                    std::lower_bound(first2, first2 + j, *(first1 + i), f) -
+                    first2));
+        }
+
+        return std::make_pair(
+            std::size_t(
+                std::lower_bound(first1, first1 + i, *(first2 + j), f) - first1),
+            std::size_t(
+                std::lower_bound(first2, first2 + j, *(first2 + j), f) - first2));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Perform the given set operation by splitting both input sequences into
+    // balanced chunks along their merge path. The first pass determines the
+    // number of elements each chunk will produce, after that each chunk
+    // writes its output directly to its final place in the destination.
     template <typename ExPolicy, typename RanIter1, typename RanIter2,
-        typename FwdIter, typename F, typename Combiner, typename SetOp>
+        typename FwdIter, typename F, typename SetOp>
     typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
     set_operation(ExPolicy policy, RanIter1 first1, RanIter1 last1,
-        RanIter2 first2, RanIter2 last2, FwdIter dest, F&& f,
-        Combiner&& combiner, SetOp&& setop)
+        RanIter2 first2, RanIter2 last2, FwdIter dest, F&& f, SetOp&& setop)
     {
-        typedef typename std::iterator_traits<RanIter1>::difference_type
-            difference_type1;
-        typedef typename std::iterator_traits<RanIter2>::difference_type
-            difference_type2;
-
-        // allocate intermediate buffers
-        difference_type1 len1 = std::distance(first1, last1);
-        difference_type2 len2 = std::distance(first2, last2);
-
-        typedef typename set_operations_buffer<FwdIter>::type buffer_type;
+        std::size_t len1 = std::distance(first1, last1);
+        std::size_t len2 = std::distance(first2, last2);
 
         std::size_t cores = execution::processing_units_count(
             policy.parameters(), policy.executor());
 
-        std::size_t step = (len1 + cores - 1) / cores;
+        std::size_t num_chunks = (std::min)(cores, len1 + len2);
+        std::size_t step = (len1 + len2 + num_chunks - 1) / num_chunks;
 
 #if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-        std::shared_ptr<buffer_type[]> buffer(
-            new buffer_type[combiner(len1, len2)]);
-        std::shared_ptr<set_chunk_data[]> chunks(new set_chunk_data[cores]);
+        std::shared_ptr<set_chunk_data[]> chunks(
+            new set_chunk_data[num_chunks]);
 #else
-        boost::shared_array<buffer_type> buffer(
-            new buffer_type[combiner(len1, len2)]);
-        boost::shared_array<set_chunk_data> chunks(new set_chunk_data[cores]);
+        boost::shared_array<set_chunk_data> chunks(
+            new set_chunk_data[num_chunks]);
 #endif
 
-        // first step, is applied to all partitions
-        auto f1 = [=](set_chunk_data* curr_chunk,
-                      std::size_t part_size) -> void {
-            HPX_ASSERT(part_size == 1);
-
-            // find start in sequence 1
-            std::size_t start1 = (curr_chunk - chunks.get()) * step;
-            std::size_t end1 = (std::min)(start1 + step, std::size_t(len1));
-
-            if (start1 >= end1)
-                return;
-
-            bool first_partition = (start1 == 0);
-            bool last_partition = (end1 == std::size_t(len1));
-
-            // all but the last chunk require special handling
-            if (!last_partition)
-            {
-                // this chunk will be handled by the next one if all
-                // elements of this partition are equal
-                if (!f(first1[start1], first1[end1]))
-                    return;
-
-                // move backwards to find earliest element which is equal to
-                // the last element of the current chunk
-                while (end1 != 0 && !f(first1[end1 - 1], first1[end1]))
-                    --end1;
-            }
-
-            // move backwards to find earliest element which is equal to
-            // the first element of the current chunk
-            while (start1 != 0 && !f(first1[start1 - 1], first1[start1]))
-                --start1;
-
-            // find start and end in sequence 2
-            std::size_t start2 = 0;
-            if (!first_partition)
+        // first step, determines the chunk boundaries and the number of
+        // elements each chunk will produce
+        auto f1 = [=](set_chunk_data* part_begin,
+                      std::size_t part_size) -> std::size_t {
+            std::size_t count = 0;
+            for (set_chunk_data* curr_chunk = part_begin;
+                 curr_chunk != part_begin + part_size; ++curr_chunk)
             {
-                start2 =
-                    std::lower_bound(first2, first2 + len2, first1[start1], f) -
-                    first2;
+                std::size_t diagonal = (curr_chunk - chunks.get()) * step;
+
+                std::pair<std::size_t, std::size_t> start = set_partition_point(
+                    first1, len1, first2, len2, diagonal, f);
+                std::pair<std::size_t, std::size_t> end = set_partition_point(
+                    first1, len1, first2, len2, diagonal + step, f);
+
+                curr_chunk->start1 = start.first;
+                curr_chunk->start2 = start.second;
+                curr_chunk->end1 = end.first;
+                curr_chunk->end2 = end.second;
+
+                count += setop(first1 + start.first, first1 + end.first,
+                    first2 + start.second, first2 + end.second,
+                    counting_output_iterator(), f)
+                             .count();
             }
-
-            std::size_t end2 = len2;
-            if (!last_partition)
-            {
-                end2 = std::lower_bound(
-                           first2 + start2, first2 + len2, first1[end1], f) -
-                    first2;
-            }
-
-            // perform requested set-operation into the proper place of the
-            // intermediate buffer
-            curr_chunk->start = combiner(start1, start2);
-            auto buffer_dest = buffer.get() + curr_chunk->start;
-            curr_chunk->len =
-                setop(first1 + start1, first1 + end1, first2 + start2,
-                    first2 + end2, buffer_dest, f) -
-                buffer_dest;
+            return count;
         };
 
-        // second step, is executed after all partitions are done running
-        auto f2 = [buffer, chunks, cores, dest](
-                      std::vector<future<void>> &&) -> FwdIter {
-            // accumulate real length
-            set_chunk_data* chunk = chunks.get();
-            chunk->start_index = 0;
-            for (size_t i = 1; i != cores; ++i)
+        // third step, performs the set operation for each chunk writing
+        // directly into the destination
+        auto f3 = [=](set_chunk_data* part_begin, std::size_t part_size,
+                      hpx::shared_future<std::size_t> curr,
+                      hpx::shared_future<std::size_t> next) -> void {
+            next.get();    // rethrow exceptions
+
+            FwdIter part_dest = dest;
+            std::advance(part_dest, curr.get());
+            for (set_chunk_data* curr_chunk = part_begin;
+                 curr_chunk != part_begin + part_size; ++curr_chunk)
             {
-                set_chunk_data* curr_chunk = chunk++;
-                chunk->start_index = curr_chunk->start_index + curr_chunk->len;
+                part_dest = setop(first1 + curr_chunk->start1,
+                    first1 + curr_chunk->end1, first2 + curr_chunk->start2,
+                    first2 + curr_chunk->end2, part_dest, f);
             }
+        };
 
-            // finally, copy data to destination
-            parallel::util::
-                foreach_partitioner<hpx::execution::parallel_policy>::call(
-                    hpx::execution::par, chunks.get(), cores,
-                    [buffer, dest](
-                        set_chunk_data* chunk, std::size_t, std::size_t) {
-                        if (chunk->start == (size_t)(-1) ||
-                            chunk->start_index == (size_t)(-1) ||
-                            chunk->len == (size_t)(-1))
-                            return;
-
-                        std::copy(buffer.get() + chunk->start,
-                            buffer.get() + chunk->start + chunk->len,
-                            dest + chunk->start_index);
-                    },
-                    [](set_chunk_data* last) -> set_chunk_data* {
-                        return last;
-                    });
+        auto f4 = [dest, chunks](
+                      std::vector<hpx::shared_future<std::size_t>>&& items,
+                      std::vector<hpx::future<void>>&&) mutable -> FwdIter {
+            HPX_UNUSED(chunks);
 
+            std::advance(dest, items.back().get());
             return dest;
         };
 
-        // fill the buffer piecewise
-        return parallel::util::partitioner<ExPolicy, FwdIter, void>::call(
-            policy, chunks.get(), cores, std::move(f1), std::move(f2));
+        return util::scan_partitioner<ExPolicy, FwdIter, std::size_t>::call(
+            policy, chunks.get(), num_chunks,
+            std::size_t(0),
+            // step 1 determines the size of the output of each chunk
+            std::move(f1),
+            // step 2 propagates the partition results from left to right
+            hpx::util::unwrapping(std::plus<std::size_t>()),
+            // step 3 writes the output of each chunk
+            std::move(f3),
+            // step 4 use this return value
+            std::move(f4));
     }
 
     /// \endcond
@@ -10,6 +10,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/util/tagged_tuple.hpp>
 
@@ -18,12 +19,14 @@
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/transfer.hpp>
 #include <hpx/parallel/tagspec.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
 #include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/transfer.hpp>
 
@@ -148,137 +151,66 @@ namespace hpx { namespace parallel { inline namespace v1 {
             typedef struct upper_bound_helper another_type;
         };
 
+        // Merge both sorted ranges by splitting them into balanced chunks
+        // along their merge path. Every chunk is merged sequentially, writing
+        // directly into its final place in the destination range.
         template <typename ExPolicy, typename RandIter1, typename RandIter2,
-            typename RandIter3, typename Comp, typename Proj1, typename Proj2,
-            typename BinarySearchHelper>
-        void parallel_merge_helper(ExPolicy policy, RandIter1 first1,
-            RandIter1 last1, RandIter2 first2, RandIter2 last2, RandIter3 dest,
-            Comp comp, Proj1 proj1, Proj2 proj2, bool range_reversal,
-            BinarySearchHelper)
+            typename RandIter3, typename Comp, typename Proj1, typename Proj2>
+        typename util::detail::algorithm_result<ExPolicy,
+            hpx::util::tuple<RandIter1, RandIter2, RandIter3>>::type
+        parallel_merge(ExPolicy&& policy, RandIter1 first1, RandIter1 last1,
+            RandIter2 first2, RandIter2 last2, RandIter3 dest, Comp&& comp,
+            Proj1&& proj1, Proj2&& proj2)
         {
-            const std::size_t threshold = 65536ul;
-            HPX_ASSERT(threshold >= 1ul);
-
-            std::size_t size1 = last1 - first1;
-            std::size_t size2 = last2 - first2;
-
-            // Perform sequential merge if data size is smaller than threshold.
-            if (size1 + size2 <= threshold)
-            {
-                if (range_reversal)
-                {
-                    sequential_merge(first2, first2 + size2, first1,
-                        first1 + size1, dest, comp, proj2, proj1);
-                }
-                else
-                {
-                    sequential_merge(first1, first1 + size1, first2,
-                        first2 + size2, dest, comp, proj1, proj2);
-                }
-                return;
-            }
-
-            // Let size1 is bigger than size2 always.
-            if (size1 < size2)
-            {
-                // For stability of algorithm, must switch binary search methods
-                //   when swapping size1 and size2.
-                parallel_merge_helper(policy, first2, last2, first1, last1,
-                    dest, comp, proj2, proj1, !range_reversal,
-                    typename BinarySearchHelper::another_type());
-                return;
-            }
-
-            HPX_ASSERT(size1 >= size2);
-            HPX_ASSERT(size1 >= 1ul);
-
-            RandIter1 mid1 = first1 + size1 / 2;
-            RandIter2 boundary2 = BinarySearchHelper::call(
-                first2, last2, hpx::util::invoke(proj1, *mid1), comp, proj2);
-            RandIter3 target = dest + (mid1 - first1) + (boundary2 - first2);
+            typedef hpx::util::tuple<RandIter1, RandIter2, RandIter3>
+                result_type;
 
-            *target = *mid1;
+            // chunks smaller than this are not worth being merged separately
+            std::size_t const threshold = 65536ul;
 
-            hpx::future<void> fut =
-                execution::async_execute(policy.executor(), [&]() -> void {
-                    // Process leftside ranges.
-                    parallel_merge_helper(policy, first1, mid1, first2,
-                        boundary2, dest, comp, proj1, proj2, range_reversal,
-                        BinarySearchHelper());
-                });
-
-            try
-            {
-                // Process rightside ranges.
-                parallel_merge_helper(policy, mid1 + 1, last1, boundary2, last2,
-                    target + 1, comp, proj1, proj2, range_reversal,
-                    BinarySearchHelper());
-            }
-            catch (...)
-            {
-                fut.wait();
+            std::size_t len1 = last1 - first1;
+            std::size_t len2 = last2 - first2;
+            std::size_t total = len1 + len2;
 
-                std::vector<hpx::future<void>> futures(2);
-                futures[0] = std::move(fut);
-                futures[1] = hpx::make_exceptional_future<void>(
-                    std::current_exception());
+            std::size_t cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
 
-                std::list<std::exception_ptr> errors;
-                util::detail::handle_local_exceptions<ExPolicy>::call(
-                    futures, errors);
+            std::size_t num_chunks =
+                (std::min)(cores, (total + threshold - 1) / threshold);
+            if (num_chunks == 0)
+                num_chunks = 1;
 
-                // Not reachable.
-                HPX_ASSERT(false);
-                return;
-            }
+            std::size_t step = (total + num_chunks - 1) / num_chunks;
 
-            fut.get();
-        }
+            auto f1 = [=](hpx::util::counting_iterator<std::size_t> part_begin,
+                          std::size_t part_size) -> void {
+                for (std::size_t chunk = *part_begin;
+                     chunk != *part_begin + part_size; ++chunk)
+                {
+                    std::size_t diagonal1 = (std::min)(chunk * step, total);
+                    std::size_t diagonal2 = (std::min)(diagonal1 + step, total);
+
+                    std::size_t split1 = merge_path_search(first1, len1,
+                        first2, len2, diagonal1, comp, proj1, proj2);
+                    std::size_t split2 = merge_path_search(first1, len1,
+                        first2, len2, diagonal2, comp, proj1, proj2);
+
+                    sequential_merge(first1 + split1, first1 + split2,
+                        first2 + (diagonal1 - split1),
+                        first2 + (diagonal2 - split2), dest + diagonal1, comp,
+                        proj1, proj2);
+                }
+            };
 
-        template <typename ExPolicy, typename RandIter1, typename RandIter2,
-            typename RandIter3, typename Comp, typename Proj1, typename Proj2>
-        hpx::future<hpx::util::tuple<RandIter1, RandIter2, RandIter3>>
-        parallel_merge(ExPolicy&& policy, RandIter1 first1, RandIter1 last1,
-            RandIter2 first2, RandIter2 last2, RandIter3 dest, Comp&& comp,
-            Proj1&& proj1, Proj2&& proj2)
-        {
-            typedef hpx::util::tuple<RandIter1, RandIter2, RandIter3>
-                result_type;
+            auto f2 = [last1, last2, dest, total](
+                          std::vector<hpx::future<void>>&&) -> result_type {
+                return hpx::util::make_tuple(last1, last2, dest + total);
+            };
 
-            typedef typename std::remove_reference<ExPolicy>::type ExPolicy_;
-            typedef typename std::remove_reference<Comp>::type Comp_;
-            typedef typename std::remove_reference<Proj1>::type Proj1_;
-            typedef typename std::remove_reference<Proj2>::type Proj2_;
-
-            hpx::future<result_type> f = execution::async_execute(
-                policy.executor(),
-                std::bind(
-                    [first1, last1, first2, last2, dest](ExPolicy_& policy,
-                        Comp_& comp, Proj1_& proj1,
-                        Proj2_& proj2) -> result_type {
-                        try
-                        {
-                            parallel_merge_helper(std::move(policy), first1,
-                                last1, first2, last2, dest, std::move(comp),
-                                std::move(proj1), std::move(proj2), false,
-                                lower_bound_helper());
-
-                            return hpx::util::make_tuple(last1, last2,
-                                dest + (last1 - first1) + (last2 - first2));
-                        }
-                        catch (...)
-                        {
-                            util::detail::handle_local_exceptions<
-                                ExPolicy>::call(std::current_exception());
-                        }
-
-                        // Not reachable.
-                        HPX_ASSERT(false);
-                    },
-                    std::forward<ExPolicy>(policy), std::forward<Comp>(comp),
-                    std::forward<Proj1>(proj1), std::forward<Proj2>(proj2)));
-
-            return f;
+            return util::partitioner<ExPolicy, result_type, void>::call(
+                std::forward<ExPolicy>(policy),
+                hpx::util::make_counting_iterator(std::size_t(0)), num_chunks,
+                std::move(f1), std::move(f2));
         }
 
         template <typename IterTuple>
@@ -317,11 +249,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 try
                 {
-                    return algorithm_result::get(parallel_merge(
-                        std::forward<ExPolicy>(policy), first1, last1, first2,
-                        last2, dest, std::forward<Comp>(comp),
-                        std::forward<Proj1>(proj1),
-                        std::forward<Proj2>(proj2)));
+                    return parallel_merge(std::forward<ExPolicy>(policy),
+                        first1, last1, first2, last2, dest,
+                        std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                        std::forward<Proj2>(proj2));
                 }
                 catch (...)
                 {
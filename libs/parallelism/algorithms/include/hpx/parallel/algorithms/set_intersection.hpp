@@ -10,7 +10,6 @@
 
 #include <hpx/config.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
-#include <hpx/type_support/decay.hpp>
 
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/copy.hpp>
@@ -29,6 +28,19 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // set_intersection
     namespace detail {
         /// \cond NOINTERNAL
+        // perform the set operation for one chunk
+        struct set_intersection_op
+        {
+            template <typename RanIter1, typename RanIter2, typename OutIter,
+                typename F>
+            OutIter operator()(RanIter1 first1, RanIter1 last1, RanIter2 first2,
+                RanIter2 last2, OutIter dest, F const& f) const
+            {
+                return std::set_intersection(
+                    first1, last1, first2, last2, dest, f);
+            }
+        };
+
         template <typename FwdIter>
         struct set_intersection
           : public detail::algorithm<set_intersection<FwdIter>, FwdIter>
@@ -54,11 +66,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 parallel(ExPolicy&& policy, RanIter1 first1, RanIter1 last1,
                     RanIter2 first2, RanIter2 last2, FwdIter dest, F&& f)
             {
-                typedef typename std::iterator_traits<RanIter1>::difference_type
-                    difference_type1;
-                typedef typename std::iterator_traits<RanIter2>::difference_type
-                    difference_type2;
-
                 if (first1 == last1 || first2 == last2)
                 {
                     typedef util::detail::algorithm_result<ExPolicy, FwdIter>
@@ -66,23 +73,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     return result::get(std::move(dest));
                 }
 
-                typedef
-                    typename set_operations_buffer<FwdIter>::type buffer_type;
-                typedef typename hpx::util::decay<F>::type func_type;
-
-                return set_operation(
-                    std::forward<ExPolicy>(policy), first1, last1, first2,
-                    last2, dest, std::forward<F>(f),
-                    // calculate approximate destination index
-                    [](difference_type1 idx1, difference_type2 idx2)
-                        -> difference_type1 { return (std::min)(idx1, idx2); },
-                    // perform required set operation for one chunk
-                    [](RanIter1 part_first1, RanIter1 part_last1,
-                        RanIter2 part_first2, RanIter2 part_last2,
-                        buffer_type* dest, func_type const& f) -> buffer_type* {
-                        return std::set_intersection(part_first1, part_last1,
-                            part_first2, part_last2, dest, f);
-                    });
+                return set_operation(std::forward<ExPolicy>(policy), first1,
+                    last1, first2, last2, dest, std::forward<F>(f),
+                    set_intersection_op());
             }
         };
         /// \endcond
@@ -18,6 +18,7 @@
 #include <hpx/type_support/decay.hpp>
 
 #include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/execution_information.hpp>
@@ -26,6 +27,7 @@
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -260,6 +262,36 @@ namespace hpx { namespace parallel { inline namespace v1 {
             {
             }
 
+            // arithmetic keys compared using the standard orderings are
+            // sorted using the radix sort
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::future<RandomIt> sort_async(ExPolicy&& policy,
+                RandomIt first, RandomIt last, Compare&& comp, Proj&& proj,
+                std::true_type)
+            {
+                if (std::size_t(last - first) < radix_sort_limit)
+                {
+                    return sort_async(std::forward<ExPolicy>(policy), first,
+                        last, std::forward<Compare>(comp),
+                        std::forward<Proj>(proj), std::false_type());
+                }
+
+                return parallel_radix_sort_async(
+                    std::forward<ExPolicy>(policy), first, last,
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::future<RandomIt> sort_async(ExPolicy&& policy,
+                RandomIt first, RandomIt last, Compare&& comp, Proj&& proj,
+                std::false_type)
+            {
+                return parallel_sort_async(std::forward<ExPolicy>(policy),
+                    first, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+            }
+
             template <typename ExPolicy, typename Compare, typename Proj>
             static RandomIt sequential(ExPolicy, RandomIt first, RandomIt last,
                 Compare&& comp, Proj&& proj)
@@ -283,11 +315,12 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 {
                     // call the sort routine and return the right type,
                     // depending on execution policy
-                    return algorithm_result::get(parallel_sort_async(
+                    return algorithm_result::get(sort_async(
                         std::forward<ExPolicy>(policy), first, last,
-                        util::compare_projected<Compare, Proj>(
-                            std::forward<Compare>(comp),
-                            std::forward<Proj>(proj))));
+                        std::forward<Compare>(comp), std::forward<Proj>(proj),
+                        std::integral_constant<bool,
+                            is_radix_sortable<RandomIt, Compare,
+                                Proj>::value>()));
                 }
                 catch (...)
                 {
@@ -297,6 +330,29 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy&& policy, RandomIt first, RandomIt last, Compare&& comp,
+            Proj&& proj, std::false_type)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return detail::sort<RandomIt>().call(std::forward<ExPolicy>(policy),
+                is_seq(), first, last, std::forward<Compare>(comp),
+                std::forward<Proj>(proj));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy&& policy, RandomIt first, RandomIt last, Compare&& comp,
+            Proj&& proj, std::true_type);
         /// \endcond
     }    // namespace detail
 
@@ -309,6 +365,18 @@ namespace hpx { namespace parallel { inline namespace v1 {
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// \note   If the (projected) values are arithmetic types and \a comp is
+    ///         std::less or std::greater, the parallel versions of the
+    ///         algorithm use a radix sort instead, which performs O(N)
+    ///         operations for each byte of the values.
+    ///
+    /// \note   If \a RandomIt is a segmented iterator (for instance of a
+    ///         \a hpx::partitioned_vector), the elements are sorted in place
+    ///         using a distributed sample sort: all segments are sorted
+    ///         locally, exchange their elements based on splitters selected
+    ///         from samples of all segments, and merge the received runs.
+    ///         The number of elements in each segment is not changed.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
@@ -387,10 +455,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
         static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
             "Requires a random access iterator.");
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef hpx::traits::is_segmented_iterator<RandomIt> is_segmented;
 
-        return detail::sort<RandomIt>().call(std::forward<ExPolicy>(policy),
-            is_seq(), first, last, std::forward<Compare>(comp),
-            std::forward<Proj>(proj));
+        return detail::sort_(std::forward<ExPolicy>(policy), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj),
+            is_segmented());
     }
 }}}    // namespace hpx::parallel::v1
@@ -24,6 +24,7 @@
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/parallel_stable_sort.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/detail/spin_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -77,6 +78,55 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 RandomIt>::type
             parallel(ExPolicy&& policy, RandomIt first, Sentinel last,
                 Compare&& compare, Proj&& proj)
+            {
+                return parallel_sort(std::forward<ExPolicy>(policy), first,
+                    last, std::forward<Compare>(compare),
+                    std::forward<Proj>(proj),
+                    std::integral_constant<bool,
+                        is_radix_sortable<RandomIt, Compare, Proj>::value>());
+            }
+
+            // arithmetic keys compared using the standard orderings are
+            // sorted using the (stable) radix sort
+            template <typename ExPolicy, typename Sentinel, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel_sort(ExPolicy&& policy, RandomIt first, Sentinel last,
+                Compare&& compare, Proj&& proj, std::true_type)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, RandomIt>;
+
+                std::size_t count = last - first;
+                if (count < radix_sort_limit)
+                {
+                    return parallel_sort(std::forward<ExPolicy>(policy), first,
+                        last, std::forward<Compare>(compare),
+                        std::forward<Proj>(proj), std::false_type());
+                }
+
+                try
+                {
+                    return algorithm_result::get(parallel_radix_sort_async(
+                        std::forward<ExPolicy>(policy), first, first + count,
+                        std::forward<Compare>(compare),
+                        std::forward<Proj>(proj)));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+
+            template <typename ExPolicy, typename Sentinel, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel_sort(ExPolicy&& policy, RandomIt first, Sentinel last,
+                Compare&& compare, Proj&& proj, std::false_type)
             {
                 using algorithm_result =
                     util::detail::algorithm_result<ExPolicy, RandomIt>;
@@ -135,6 +185,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// \note   If the (projected) values are arithmetic types and \a comp is
+    ///         std::less or std::greater, the parallel versions of the
+    ///         algorithm use a radix sort instead, which performs O(N)
+    ///         operations for each byte of the values.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
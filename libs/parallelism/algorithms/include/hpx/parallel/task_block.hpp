@@ -13,10 +13,14 @@
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
+#include <hpx/functional/deferred_call.hpp>
+#include <hpx/functional/unique_function.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/is_future.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
+#include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/type_support/decay.hpp>
 
 #include <hpx/execution/executors/execution.hpp>
@@ -26,6 +30,8 @@
 
 #include <memory>    // std::addressof
 
+#include <cstddef>
+#include <deque>
 #include <exception>
 #include <mutex>
 #include <type_traits>
@@ -53,9 +59,133 @@ namespace hpx { namespace parallel { inline namespace v2 {
                 errors.add(std::current_exception());
             }
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The tasks spawned by a task_block in fork-join mode are kept in a
+        // deque owned by the task_block instead of being represented by
+        // futures. For each of them a helper is posted which executes the
+        // oldest pending task (if any) once it is scheduled on some worker.
+        // The owner of the task_block executes the most recently spawned
+        // tasks inline when it waits and suspends only for the tasks which
+        // are already running elsewhere.
+        class fork_join_state
+        {
+        private:
+            typedef hpx::lcos::local::spinlock mutex_type;
+            typedef hpx::util::unique_function_nonser<void()> task_type;
+
+        public:
+            fork_join_state()
+              : pending_(0)
+              , inline_depth_(0)
+            {
+            }
+
+            template <typename F, typename... Ts>
+            void push(F&& f, Ts&&... ts)
+            {
+                task_type task = hpx::util::deferred_call(
+                    std::forward<F>(f), std::forward<Ts>(ts)...);
+
+                std::lock_guard<mutex_type> l(mtx_);
+                tasks_.push_back(std::move(task));
+                ++pending_;
+            }
+
+            // executed by the posted helpers
+            void steal()
+            {
+                task_type task;
+
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    if (tasks_.empty())
+                        return;
+
+                    task = std::move(tasks_.front());
+                    tasks_.pop_front();
+                }
+
+                execute(task);
+            }
+
+            // executed by the owner of the task_block, moves the exceptions
+            // thrown by the tasks to the given list if requested
+            void wait(parallel::exception_list* errors = nullptr)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                while (!tasks_.empty())
+                {
+                    task_type task = std::move(tasks_.back());
+                    tasks_.pop_back();
+
+                    hpx::util::unlock_guard<std::unique_lock<mutex_type>> ul(l);
+
+                    ++inline_depth_;
+                    execute(task);
+                    --inline_depth_;
+                }
+
+                cond_.wait(l, [this]() { return pending_ == 0; });
+
+                if (errors != nullptr)
+                {
+                    for (std::exception_ptr const& e : errors_)
+                        errors->add(e);
+                    errors_ = parallel::exception_list();
+                }
+            }
+
+            // the task_block is not active while one of its tasks is being
+            // executed inline
+            bool is_executing_inline() const
+            {
+                return inline_depth_ != 0;
+            }
+
+        private:
+            void execute(task_type& task)
+            {
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    handle_task_block_exceptions(errors_);
+                }
+
+                std::lock_guard<mutex_type> l(mtx_);
+                if (--pending_ == 0)
+                    cond_.notify_all();
+            }
+
+            mutex_type mtx_;
+            hpx::lcos::local::condition_variable_any cond_;
+            std::deque<task_type> tasks_;
+            std::size_t pending_;
+            std::size_t inline_depth_;    // accessed by the owner only
+            parallel::exception_list errors_;
+        };
         /// \endcond
     }    // namespace detail
 
+    /// The type of the tag selecting the fork-join mode of
+    /// \a define_task_block.
+    struct fork_join_tag
+    {
+        constexpr fork_join_tag() {}
+    };
+
+    /// Selects the fork-join mode of \a define_task_block. In this mode a
+    /// call to \a run does not create a future for the spawned task. The
+    /// tasks are queued in the \a task_block instead and are picked up by
+    /// idle workers, while \a wait (and the end of the task block) executes
+    /// the most recently spawned tasks inline before suspending for the ones
+    /// already running elsewhere.
+    HPX_INLINE_CONSTEXPR_VARIABLE fork_join_tag fork_join{};
+
     /// The class \a task_canceled_exception defines the type of objects thrown
     /// by task_block::run or task_block::wait if they detect
     /// that an exception is pending within the current parallel region.
@@ -124,12 +254,34 @@ namespace hpx { namespace parallel { inline namespace v2 {
         friend typename util::detail::algorithm_result<ExPolicy_>::type
         define_task_block(ExPolicy_&&, F&&);
 
+        template <typename ExPolicy_, typename F>
+        friend void define_task_block(fork_join_tag, ExPolicy_&&, F&&);
+
         explicit task_block(ExPolicy const& policy = ExPolicy())
           : id_(threads::get_self_id())
           , policy_(policy)
         {
         }
 
+        task_block(ExPolicy const& policy, fork_join_tag)
+          : state_(std::make_shared<detail::fork_join_state>())
+          , id_(threads::get_self_id())
+          , policy_(policy)
+        {
+        }
+
+        void check_active() const
+        {
+            // The proposal requires that the task_block should be
+            // 'active' to be usable.
+            if (id_ != threads::get_self_id() ||
+                (state_ && state_->is_executing_inline()))
+            {
+                HPX_THROW_EXCEPTION(task_block_not_active, "task_block::run",
+                    "the task_block is not active");
+            }
+        }
+
         void wait_for_completion(std::false_type)
         {
             when();
@@ -177,10 +329,19 @@ namespace hpx { namespace parallel { inline namespace v2 {
             std::vector<hpx::future<void>> tasks;
             parallel::exception_list errors;
 
+            if (state_)
+            {
+                // the exceptions thrown by the tasks are reported once the
+                // task block is complete
+                state_->wait(throw_on_error ? &errors : nullptr);
+            }
+
             {
                 std::lock_guard<mutex_type> l(mtx_);
                 std::swap(tasks_, tasks);
-                std::swap(errors_, errors);
+                for (std::exception_ptr const& e : errors_)
+                    errors.add(e);
+                errors_ = parallel::exception_list();
             }
 
             typedef util::detail::algorithm_result<ExPolicy> result;
@@ -243,12 +404,16 @@ namespace hpx { namespace parallel { inline namespace v2 {
         template <typename F, typename... Ts>
         void run(F&& f, Ts&&... ts)
         {
-            // The proposal requires that the task_block should be
-            // 'active' to be usable.
-            if (id_ != threads::get_self_id())
+            check_active();
+
+            if (state_)
             {
-                HPX_THROW_EXCEPTION(task_block_not_active, "task_block::run",
-                    "the task_block is not active");
+                state_->push(std::forward<F>(f), std::forward<Ts>(ts)...);
+
+                std::shared_ptr<detail::fork_join_state> state = state_;
+                execution::post(
+                    policy_.executor(), [state]() { state->steal(); });
+                return;
             }
 
             hpx::future<void> result =
@@ -295,13 +460,7 @@ namespace hpx { namespace parallel { inline namespace v2 {
         template <typename Executor, typename F, typename... Ts>
         void run(Executor& exec, F&& f, Ts&&... ts)
         {
-            // The proposal requires that the task_block should be
-            // 'active' to be usable.
-            if (id_ != threads::get_self_id())
-            {
-                HPX_THROW_EXCEPTION(task_block_not_active, "task_block::run",
-                    "the task_block is not active");
-            }
+            check_active();
 
             hpx::future<void> result = execution::async_execute(
                 exec, std::forward<F>(f), std::forward<Ts>(ts)...);
@@ -336,15 +495,7 @@ namespace hpx { namespace parallel { inline namespace v2 {
         ///
         void wait()
         {
-            // The proposal requires that the task_block should be
-            // 'active' to be usable.
-            if (id_ != threads::get_self_id())
-            {
-                HPX_THROW_EXCEPTION(task_block_not_active, "task_block::run",
-                    "the task_block is not active");
-                return;
-            }
-
+            check_active();
             wait_for_completion();
         }
 
@@ -370,6 +521,7 @@ namespace hpx { namespace parallel { inline namespace v2 {
 
     private:
         mutable mutex_type mtx_;
+        std::shared_ptr<detail::fork_join_state> state_;
         std::vector<hpx::future<void>> tasks_;
         parallel::exception_list errors_;
         threads::thread_id_type id_;
@@ -452,6 +604,80 @@ namespace hpx { namespace parallel { inline namespace v2 {
         define_task_block(hpx::execution::par, std::forward<F>(f));
     }
 
+    /// Constructs a \a task_block, tr, operating in fork-join mode and
+    /// invokes the expression \a f(tr) on the user-provided object, \a f.
+    ///
+    /// The tasks spawned by tr.run(f) are not represented by futures. They
+    /// are queued in the task block and are executed either by an idle
+    /// worker or inline by tr.wait() (or at the end of the task block),
+    /// whichever gets to them first. Tasks spawned using a given executor
+    /// (tr.run(exec, f)) are not affected.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the task block may be parallelized. This must
+    ///                     not be an asynchronous execution policy.
+    /// \tparam F   The type of the user defined function to invoke inside the
+    ///             define_task_block (deduced). \a F shall be MoveConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param f    The user defined function to invoke inside the task block.
+    ///             Given an lvalue \a tr of type \a task_block, the
+    ///             expression, (void)f(tr), shall be well-formed.
+    ///
+    /// Postcondition: All tasks spawned from \a f have finished execution.
+    ///
+    /// \throws An \a exception_list, as specified in Exception Handling.
+    ///
+    template <typename ExPolicy, typename F>
+    void define_task_block(fork_join_tag, ExPolicy&& policy, F&& f)
+    {
+        static_assert(parallel::execution::is_execution_policy<ExPolicy>::value,
+            "parallel::execution::is_execution_policy<ExPolicy>::value");
+        static_assert(
+            !parallel::execution::is_async_execution_policy<ExPolicy>::value,
+            "fork-join mode requires a synchronous execution policy");
+
+        typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+        task_block<policy_type> trh(std::forward<ExPolicy>(policy), fork_join);
+
+        // invoke the user supplied function
+        try
+        {
+            f(trh);
+        }
+        catch (...)
+        {
+            detail::handle_task_block_exceptions(trh.errors_);
+        }
+
+        // regardless of whether f(trh) has thrown an exception we need to
+        // obey the contract and wait for all tasks to join
+        trh.when(true);
+    }
+
+    /// Constructs a \a task_block, tr, operating in fork-join mode and
+    /// invokes the expression \a f(tr) on the user-provided object, \a f.
+    /// This version uses \a parallel_policy for task scheduling.
+    ///
+    /// \tparam F   The type of the user defined function to invoke inside the
+    ///             define_task_block (deduced). \a F shall be MoveConstructible.
+    ///
+    /// \param f    The user defined function to invoke inside the task block.
+    ///             Given an lvalue \a tr of type \a task_block, the
+    ///             expression, (void)f(tr), shall be well-formed.
+    ///
+    /// Postcondition: All tasks spawned from \a f have finished execution.
+    ///
+    /// \throws An \a exception_list, as specified in Exception Handling.
+    ///
+    template <typename F>
+    void define_task_block(fork_join_tag, F&& f)
+    {
+        define_task_block(fork_join, hpx::execution::par, std::forward<F>(f));
+    }
+
     /// Constructs a \a task_block, tr, and invokes the expression
     /// \a f(tr) on the user-provided object, \a f.
     ///
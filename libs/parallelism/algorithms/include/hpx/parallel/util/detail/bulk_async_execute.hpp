@@ -0,0 +1,57 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/traits/executor_traits.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace util { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Result, typename Executor, typename F, typename Shape>
+    std::vector<hpx::future<Result>> bulk_async_execute_partitions(
+        std::false_type, Executor&& exec, F&& f, Shape const& shape)
+    {
+        return execution::bulk_async_execute(
+            std::forward<Executor>(exec), std::forward<F>(f), shape);
+    }
+
+    // Executors supporting bulk_async_execute_void report the completion of
+    // all partitions through a single future, which saves allocating one
+    // shared state per partition. Exceptions thrown by the partitions are
+    // carried by that future as an exception_list.
+    template <typename Result, typename Executor, typename F, typename Shape>
+    std::vector<hpx::future<Result>> bulk_async_execute_partitions(
+        std::true_type, Executor&& exec, F&& f, Shape const& shape)
+    {
+        std::vector<hpx::future<Result>> workitems;
+        workitems.push_back(
+            exec.bulk_async_execute_void(std::forward<F>(f), shape));
+        return workitems;
+    }
+
+    // Launch one task per element of the given shape, return the futures
+    // representing the completion of the launched tasks.
+    template <typename Result, typename Executor, typename F, typename Shape>
+    std::vector<hpx::future<Result>> bulk_async_execute_partitions(
+        Executor&& exec, F&& f, Shape const& shape)
+    {
+        using use_bulk_void = std::integral_constant<bool,
+            std::is_void<Result>::value &&
+                execution::has_bulk_async_execute_void_member<
+                    Executor>::value>;
+
+        return bulk_async_execute_partitions<Result>(use_bulk_void{},
+            std::forward<Executor>(exec), std::forward<F>(f), shape);
+    }
+}}}}    // namespace hpx::parallel::util::detail
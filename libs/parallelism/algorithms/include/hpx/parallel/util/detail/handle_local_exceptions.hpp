@@ -64,6 +64,13 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
             {
                 throw ba;
             }
+            catch (exception_list const& el)
+            {
+                // partitions executed through bulk_async_execute_void report
+                // their exceptions as one exception_list
+                for (std::exception_ptr const& ex : el)
+                    call(ex, errors);
+            }
             catch (...)
             {
                 errors.push_back(e);
@@ -20,6 +20,7 @@
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/util/detail/bulk_async_execute.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
 #include <hpx/parallel/util/detail/partitioner_iteration.hpp>
@@ -57,7 +58,8 @@ namespace hpx { namespace parallel { namespace util {
                 inititems, f, first, count, 1);
 
             std::vector<hpx::future<Result>> workitems =
-                execution::bulk_async_execute(policy.executor(),
+                detail::bulk_async_execute_partitions<Result>(
+                    policy.executor(),
                     partitioner_iteration<Result, F>{std::forward<F>(f)},
                     std::move(shape));
 
@@ -89,7 +91,8 @@ namespace hpx { namespace parallel { namespace util {
                 inititems, f, first, count, stride);
 
             std::vector<hpx::future<Result>> workitems =
-                execution::bulk_async_execute(policy.executor(),
+                detail::bulk_async_execute_partitions<Result>(
+                    policy.executor(),
                     partitioner_iteration<Result, F>{std::forward<F>(f)},
                     std::move(shape));
 
@@ -141,7 +144,8 @@ namespace hpx { namespace parallel { namespace util {
             }
             HPX_ASSERT(chunk_size_it == chunk_sizes.end());
 
-            return execution::bulk_async_execute(policy.executor(),
+            return detail::bulk_async_execute_partitions<Result>(
+                policy.executor(),
                 partitioner_iteration<Result, F>{std::forward<F>(f)},
                 std::move(shape));
         }
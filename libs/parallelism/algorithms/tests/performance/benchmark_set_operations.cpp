@@ -0,0 +1,252 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_generate.hpp>
+#include <hpx/include/parallel_set_operations.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+///////////////////////////////////////////////////////////////////////////////
+
+struct random_fill
+{
+    random_fill(std::size_t random_range)
+      : gen(seed)
+      , dist(0, random_range - 1)
+    {
+    }
+
+    int operator()()
+    {
+        return dist(gen);
+    }
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<> dist;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// std::set_union and friends are overloaded, wrap them into function objects
+struct std_set_union
+{
+    template <typename... Ts>
+    void operator()(Ts&&... ts) const
+    {
+        std::set_union(std::forward<Ts>(ts)...);
+    }
+};
+
+struct std_set_intersection
+{
+    template <typename... Ts>
+    void operator()(Ts&&... ts) const
+    {
+        std::set_intersection(std::forward<Ts>(ts)...);
+    }
+};
+
+struct std_set_difference
+{
+    template <typename... Ts>
+    void operator()(Ts&&... ts) const
+    {
+        std::set_difference(std::forward<Ts>(ts)...);
+    }
+};
+
+struct std_set_symmetric_difference
+{
+    template <typename... Ts>
+    void operator()(Ts&&... ts) const
+    {
+        std::set_symmetric_difference(std::forward<Ts>(ts)...);
+    }
+};
+
+struct hpx_set_union
+{
+    template <typename... Ts>
+    void operator()(Ts&&... ts) const
+    {
+        hpx::parallel::set_union(std::forward<Ts>(ts)...);
+    }
+};
+
+struct hpx_set_intersection
+{
+    template <typename... Ts>
+    void operator()(Ts&&... ts) const
+    {
+        hpx::parallel::set_intersection(std::forward<Ts>(ts)...);
+    }
+};
+
+struct hpx_set_difference
+{
+    template <typename... Ts>
+    void operator()(Ts&&... ts) const
+    {
+        hpx::parallel::set_difference(std::forward<Ts>(ts)...);
+    }
+};
+
+struct hpx_set_symmetric_difference
+{
+    template <typename... Ts>
+    void operator()(Ts&&... ts) const
+    {
+        hpx::parallel::set_symmetric_difference(std::forward<Ts>(ts)...);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename SetOp, typename... Ts>
+double run_set_operation_benchmark(int test_count, SetOp op, Ts... ts)
+{
+    std::uint64_t time = hpx::util::high_resolution_clock::now();
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        op(ts...);
+    }
+
+    time = hpx::util::high_resolution_clock::now() - time;
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename StdSetOp, typename HpxSetOp>
+void run_benchmark(char const* name, std::vector<int> const& src1,
+    std::vector<int> const& src2, std::vector<int>& result, int test_count)
+{
+    auto first1 = std::begin(src1);
+    auto last1 = std::end(src1);
+    auto first2 = std::begin(src2);
+    auto last2 = std::end(src2);
+    auto dest = std::begin(result);
+
+    using namespace hpx::execution;
+
+    std::cout << "--- run_" << name << "_benchmark ---" << std::endl;
+    double time_std = run_set_operation_benchmark(
+        test_count, StdSetOp(), first1, last1, first2, last2, dest);
+    double time_seq = run_set_operation_benchmark(
+        test_count, HpxSetOp(), seq, first1, last1, first2, last2, dest);
+    double time_par = run_set_operation_benchmark(
+        test_count, HpxSetOp(), par, first1, last1, first2, last2, dest);
+
+    auto fmt = "{1} ({2}) : {3}(sec)";
+    hpx::util::format_to(std::cout, fmt, name, "std", time_std) << std::endl;
+    hpx::util::format_to(std::cout, fmt, name, "seq", time_seq) << std::endl;
+    hpx::util::format_to(std::cout, fmt, name, "par", time_par) << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    // pull values from cmd
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    double vector_ratio = vm["vector_ratio"].as<double>();
+    std::size_t random_range = vm["random_range"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    if (random_range < 1)
+        random_range = 1;
+
+    std::size_t vector_size1 = std::size_t(vector_size * vector_ratio);
+    std::size_t vector_size2 = vector_size - vector_size1;
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size1 : " << vector_size1 << std::endl;
+    std::cout << "vector_size2 : " << vector_size2 << std::endl;
+    std::cout << "random_range : " << random_range << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    std::cout << "* Preparing Benchmark..." << std::endl;
+
+    std::vector<int> src1(vector_size1);
+    std::vector<int> src2(vector_size2);
+    std::vector<int> result(vector_size1 + vector_size2);
+
+    // initialize data
+    using namespace hpx::execution;
+    hpx::parallel::generate(
+        par, std::begin(src1), std::end(src1), random_fill(random_range));
+    hpx::parallel::generate(
+        par, std::begin(src2), std::end(src2), random_fill(random_range));
+    hpx::parallel::sort(par, std::begin(src1), std::end(src1));
+    hpx::parallel::sort(par, std::begin(src2), std::end(src2));
+
+    std::cout << "* Running Benchmark..." << std::endl;
+    run_benchmark<std_set_union, hpx_set_union>(
+        "set_union", src1, src2, result, test_count);
+    run_benchmark<std_set_intersection, hpx_set_intersection>(
+        "set_intersection", src1, src2, result, test_count);
+    run_benchmark<std_set_difference, hpx_set_difference>(
+        "set_difference", src1, src2, result, test_count);
+    run_benchmark<std_set_symmetric_difference, hpx_set_symmetric_difference>(
+        "set_symmetric_difference", src1, src2, result, test_count);
+    std::cout << "----------------------------------------------" << std::endl;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("vector_size",
+        hpx::program_options::value<std::size_t>()->default_value(10000000),
+        "sum of sizes of two vectors (default: 10000000)")("vector_ratio",
+        hpx::program_options::value<double>()->default_value(0.5),
+        "ratio of two vector sizes (default: 0.5)")("random_range",
+        hpx::program_options::value<std::size_t>()->default_value(1000000),
+        "range of random numbers [0, x) (default: 1000000)")("test_count",
+        hpx::program_options::value<int>()->default_value(10),
+        "number of tests to be averaged (default: 10)")("seed,s",
+        hpx::program_options::value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,198 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the radix sort used by hpx::parallel::sort and
+// hpx::parallel::stable_sort for arithmetic keys with the comparison based
+// algorithms (selected by using a comparison function object the radix sort
+// does not recognize) and with std::sort.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+// a comparison function object which is not dispatched to the radix sort
+struct comparison_less
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, std::vector<T>>::type
+make_data(std::size_t size)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<T> dist(
+        (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    std::vector<T> data(size);
+    for (T& value : data)
+        value = dist(gen);
+    return data;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, std::vector<T>>::type
+make_data(std::size_t size)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<T> dist(T(-1e6), T(1e6));
+
+    std::vector<T> data(size);
+    for (T& value : data)
+        value = dist(gen);
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Sort>
+double run_sort_benchmark(int test_count, std::vector<T> const& org,
+    std::vector<T>& data, Sort&& sort)
+{
+    std::uint64_t time = std::uint64_t(0);
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        // Restore the data with the original values.
+        hpx::copy(hpx::execution::par, org.begin(), org.end(), data.begin());
+
+        std::uint64_t elapsed = hpx::util::high_resolution_clock::now();
+        sort(data);
+        time += hpx::util::high_resolution_clock::now() - elapsed;
+
+        HPX_TEST(std::is_sorted(data.begin(), data.end()));
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+template <typename T>
+void run_benchmark(
+    char const* name, std::size_t vector_size, int test_count)
+{
+    using namespace hpx::execution;
+
+    std::vector<T> const org = make_data<T>(vector_size);
+    std::vector<T> data(vector_size);
+
+    double time_std = run_sort_benchmark(test_count, org, data,
+        [](std::vector<T>& v) { std::sort(v.begin(), v.end()); });
+
+    double time_radix = run_sort_benchmark(
+        test_count, org, data, [](std::vector<T>& v) {
+            hpx::parallel::sort(par, v.begin(), v.end());
+        });
+
+    double time_comparison = run_sort_benchmark(
+        test_count, org, data, [](std::vector<T>& v) {
+            hpx::parallel::sort(par, v.begin(), v.end(), comparison_less());
+        });
+
+    double time_stable_radix = run_sort_benchmark(
+        test_count, org, data, [](std::vector<T>& v) {
+            hpx::parallel::stable_sort(par, v.begin(), v.end());
+        });
+
+    double time_stable_comparison = run_sort_benchmark(
+        test_count, org, data, [](std::vector<T>& v) {
+            hpx::parallel::stable_sort(
+                par, v.begin(), v.end(), comparison_less());
+        });
+
+    std::cout << "-------------- Benchmark Result (" << name
+              << ") --------------\n";
+    std::cout << "std::sort                       : " << time_std << "(sec)\n";
+    std::cout << "sort (radix)                    : " << time_radix
+              << "(sec)\n";
+    std::cout << "sort (comparison)               : " << time_comparison
+              << "(sec)\n";
+    std::cout << "stable_sort (radix)             : " << time_stable_radix
+              << "(sec)\n";
+    std::cout << "stable_sort (comparison)        : " << time_stable_comparison
+              << "(sec)\n";
+    std::cout << "-----------------------------------------------------"
+              << std::endl;
+
+    std::string const suffix = std::string("_") + name;
+    hpx::util::print_cdash_timing(
+        ("SortRadix" + suffix).c_str(), time_radix);
+    hpx::util::print_cdash_timing(
+        ("SortComparison" + suffix).c_str(), time_comparison);
+    hpx::util::print_cdash_timing(
+        ("StableSortRadix" + suffix).c_str(), time_stable_radix);
+    hpx::util::print_cdash_timing(
+        ("StableSortComparison" + suffix).c_str(), time_stable_comparison);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed        : " << seed << std::endl;
+    std::cout << "vector_size : " << vector_size << std::endl;
+    std::cout << "test_count  : " << test_count << std::endl;
+    std::cout << "os threads  : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    run_benchmark<std::uint32_t>("uint32", vector_size, test_count);
+    run_benchmark<std::int64_t>("int64", vector_size, test_count);
+    run_benchmark<float>("float", vector_size, test_count);
+    run_benchmark<double>("double", vector_size, test_count);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(10000000),
+         "size of vector (default: 10000000)")
+        ("test_count", value<int>()->default_value(5),
+         "number of tests to be averaged (default: 5)")
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    return hpx::init(desc_commandline, argc, argv, cfg);
+}
@@ -8,9 +8,14 @@
 #include <hpx/hpx_init.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 // use smaller array sizes for debug tests
@@ -143,6 +148,62 @@ void test_sort2()
     test_sort2_async(par(task), float(), std::greater<float>());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// arithmetic keys with the standard orderings are sorted using the radix sort
+template <typename ExPolicy, typename T, typename Compare>
+void test_sort3(ExPolicy&& policy, T, Compare comp)
+{
+    using element_type = std::pair<T, std::size_t>;
+
+    // shorter sequences are not handed to the radix sort
+    std::vector<element_type> c(
+        2 * hpx::parallel::v1::detail::radix_sort_limit + 1);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        // few distinct keys, including negative values and signed zeros
+        int key = std::rand() % 1000 - 500;
+        c[i] = element_type(
+            key == 0 && (i % 2) ? -T(0) : static_cast<T>(key) / T(4), i);
+    }
+
+    std::vector<element_type> expected(c);
+    std::sort(expected.begin(), expected.end(),
+        [&](element_type const& lhs, element_type const& rhs) {
+            return comp(lhs.first, rhs.first);
+        });
+
+    hpx::parallel::sort(std::forward<ExPolicy>(policy), c.begin(), c.end(),
+        comp, [](element_type const& e) -> T { return e.first; });
+
+    // the keys have to be in order and each element has to keep its payload
+    bool is_equal = true;
+    for (std::size_t i = 0; i != c.size() && is_equal; ++i)
+    {
+        is_equal = !comp(c[i].first, expected[i].first) &&
+            !comp(expected[i].first, c[i].first);
+    }
+    HPX_TEST(is_equal);
+
+    std::vector<bool> seen(c.size(), false);
+    for (element_type const& e : c)
+    {
+        HPX_TEST(!seen[e.second]);
+        seen[e.second] = true;
+    }
+}
+
+void test_sort3()
+{
+    using namespace hpx::execution;
+
+    test_sort3(par, int(), std::less<int>());
+    test_sort3(par, int(), std::greater<int>());
+    test_sort3(par, std::int64_t(), std::less<>());
+    test_sort3(par, double(), std::less<double>());
+    test_sort3(par_unseq, double(), std::greater<double>());
+    test_sort3(par_unseq, float(), std::less<float>());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -155,6 +216,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_sort1();
     test_sort2();
+    test_sort3();
     sort_benchmark();
 
     return hpx::finalize();
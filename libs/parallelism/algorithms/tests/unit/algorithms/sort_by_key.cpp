@@ -11,6 +11,11 @@
 #include <hpx/parallel/algorithms/generate.hpp>
 #include <hpx/parallel/algorithms/sort_by_key.hpp>
 //
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <numeric>
 #include <string>
@@ -221,6 +226,52 @@ void test_sort_by_key_async(
     HPX_TEST(is_equal);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// signed keys compared using the standard orderings are sorted using the radix
+// sort, the values have to follow their keys
+template <typename ExPolicy, typename Tkey, typename Compare>
+void test_sort_by_key_radix(ExPolicy&& policy, Tkey, Compare comp)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+    msg(typeid(ExPolicy).name(), typeid(Tkey).name(), typeid(Compare).name(),
+        radix);
+    std::cout << "\n";
+
+    // shorter sequences are not handed to the radix sort
+    std::size_t const size =
+        2 * hpx::parallel::v1::detail::radix_sort_limit + 1;
+
+    // few distinct keys, including negative values, the values are the
+    // original positions of the keys
+    std::vector<Tkey> keys(size), o_keys;
+    std::vector<std::size_t> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = static_cast<Tkey>(std::rand() % 1000 - 500);
+    }
+    std::iota(values.begin(), values.end(), 0);
+    o_keys = keys;
+
+    hpx::parallel::sort_by_key(std::forward<ExPolicy>(policy), keys.begin(),
+        keys.end(), values.begin(), comp);
+
+    std::vector<Tkey> expected(o_keys);
+    std::sort(expected.begin(), expected.end(), comp);
+    HPX_TEST(std::equal(keys.begin(), keys.end(), expected.begin()));
+
+    // each value has to be a distinct original position holding its key
+    std::vector<bool> seen(size, false);
+    bool is_equal = true;
+    for (std::size_t i = 0; i != size && is_equal; ++i)
+    {
+        is_equal = !seen[values[i]] && o_keys[values[i]] == keys[i];
+        seen[values[i]] = true;
+    }
+    HPX_TEST(is_equal);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void test_sort_by_key1()
 {
@@ -281,6 +332,11 @@ void test_sort_by_key1()
         test_sort_by_key_async(par(task), int(), double(),
             std::equal_to<double>(), [](int key) { return key; });
     } while (t2.elapsed() < seconds);
+
+    test_sort_by_key_radix(par, int(), std::less<int>());
+    test_sort_by_key_radix(par, std::int64_t(), std::greater<std::int64_t>());
+    test_sort_by_key_radix(par_unseq, double(), std::less<>());
+    test_sort_by_key_radix(par, float(), std::greater<float>());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
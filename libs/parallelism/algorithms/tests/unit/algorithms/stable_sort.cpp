@@ -8,9 +8,12 @@
 #include <hpx/hpx_init.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 // use smaller array sizes for debug tests
@@ -144,6 +147,56 @@ void test_stable_sort2()
     test_stable_sort2_async(par(task), float(), std::greater<float>());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// arithmetic keys with the standard orderings are sorted using the radix sort,
+// the result has to be identical to the one of std::stable_sort
+template <typename ExPolicy, typename T, typename Compare>
+void test_stable_sort3(ExPolicy&& policy, T, Compare comp)
+{
+    using element_type = std::pair<T, std::size_t>;
+
+    // shorter sequences are not handed to the radix sort
+    std::vector<element_type> c(
+        2 * hpx::parallel::v1::detail::radix_sort_limit + 1);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        // few distinct keys, including negative values and signed zeros
+        int key = std::rand() % 1000 - 500;
+        c[i] = element_type(
+            key == 0 && (i % 2) ? -T(0) : static_cast<T>(key) / T(4), i);
+    }
+
+    auto proj = [](element_type const& e) -> T { return e.first; };
+
+    std::vector<element_type> expected(c);
+    std::stable_sort(expected.begin(), expected.end(),
+        [&](element_type const& lhs, element_type const& rhs) {
+            return comp(lhs.first, rhs.first);
+        });
+
+    hpx::parallel::stable_sort(
+        std::forward<ExPolicy>(policy), c.begin(), c.end(), comp, proj);
+
+    bool is_equal = true;
+    for (std::size_t i = 0; i != c.size() && is_equal; ++i)
+    {
+        is_equal = c[i].second == expected[i].second;
+    }
+    HPX_TEST(is_equal);
+}
+
+void test_stable_sort3()
+{
+    using namespace hpx::execution;
+
+    test_stable_sort3(par, int(), std::less<int>());
+    test_stable_sort3(par, int(), std::greater<int>());
+    test_stable_sort3(par, double(), std::less<double>());
+    test_stable_sort3(par_unseq, double(), std::greater<double>());
+    test_stable_sort3(par, float(), std::less<>());
+    test_stable_sort3(par_unseq, float(), std::greater<float>());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -156,6 +209,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_stable_sort1();
     test_stable_sort2();
+    test_stable_sort3();
     sort_benchmark();
 
     return hpx::finalize();
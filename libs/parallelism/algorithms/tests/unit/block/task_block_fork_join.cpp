@@ -0,0 +1,173 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/parallel_task_block.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::execution::par;
+using hpx::parallel::define_task_block;
+using hpx::parallel::fork_join;
+using hpx::parallel::task_block;
+
+///////////////////////////////////////////////////////////////////////////////
+void define_task_block_test1()
+{
+    bool parent_flag = false;
+    bool task1_flag = false;
+    bool task2_flag = false;
+    bool task21_flag = false;
+    bool task3_flag = false;
+
+    define_task_block(fork_join, par, [&](task_block<>& trh) {
+        parent_flag = true;
+
+        trh.run([&]() { task1_flag = true; });
+
+        trh.run([&]() {
+            task2_flag = true;
+
+            define_task_block(fork_join, [&](task_block<>& trh) {
+                trh.run([&]() { task21_flag = true; });
+            });
+        });
+
+        int i = 0, j = 10, k = 20;
+        trh.run([=, &task3_flag]() {
+            HPX_TEST_EQ(i + j + k, 30);
+            task3_flag = true;
+        });
+    });
+
+    HPX_TEST(parent_flag);
+    HPX_TEST(task1_flag);
+    HPX_TEST(task2_flag);
+    HPX_TEST(task21_flag);
+    HPX_TEST(task3_flag);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void define_task_block_test2()
+{
+    std::atomic<std::size_t> count(0);
+
+    define_task_block(fork_join, [&](task_block<>& trh) {
+        for (std::size_t i = 0; i != 100; ++i)
+        {
+            trh.run([&]() { ++count; });
+        }
+
+        trh.wait();
+        HPX_TEST_EQ(count.load(), std::size_t(100));
+
+        trh.run([&]() { ++count; });
+    });
+
+    HPX_TEST_EQ(count.load(), std::size_t(101));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fibonacci(std::uint64_t n)
+{
+    if (n < 2)
+        return n;
+
+    std::uint64_t n1 = 0, n2 = 0;
+    define_task_block(fork_join, [&](task_block<>& trh) {
+        trh.run([&]() { n1 = fibonacci(n - 1); });
+        n2 = fibonacci(n - 2);
+    });
+    return n1 + n2;
+}
+
+void define_task_block_test3()
+{
+    HPX_TEST_EQ(fibonacci(20), std::uint64_t(6765));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void define_task_block_exceptions_test1()
+{
+    try
+    {
+        define_task_block(fork_join, par, [](task_block<>& trh) {
+            trh.run([]() { throw 1; });
+            trh.run([]() { throw 2; });
+            throw 100;
+        });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::parallel::exception_list const& e)
+    {
+        HPX_TEST_EQ(e.size(), 3u);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+}
+
+void define_task_block_exceptions_test2()
+{
+    try
+    {
+        define_task_block(fork_join, par, [&](task_block<>& trh) {
+            trh.run([&]() {
+                // Error: trh is not active, even if this task is executed
+                // inline by the owner of trh
+                trh.run([]() {
+                    HPX_TEST(false);    // should not be called
+                });
+
+                HPX_TEST(false);
+            });
+        });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(int(e.get_error()), int(hpx::task_block_not_active));
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    define_task_block_test1();
+    define_task_block_test2();
+    define_task_block_test3();
+
+    define_task_block_exceptions_test1();
+    define_task_block_exceptions_test2();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv, cfg), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
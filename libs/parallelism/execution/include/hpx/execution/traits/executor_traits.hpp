@@ -41,6 +41,7 @@ namespace hpx { namespace parallel { namespace execution {
         HPX_HAS_MEMBER_XXX_TRAIT_DEF(then_execute)
         HPX_HAS_MEMBER_XXX_TRAIT_DEF(bulk_sync_execute)
         HPX_HAS_MEMBER_XXX_TRAIT_DEF(bulk_async_execute)
+        HPX_HAS_MEMBER_XXX_TRAIT_DEF(bulk_async_execute_void)
         HPX_HAS_MEMBER_XXX_TRAIT_DEF(bulk_then_execute)
     }    // namespace detail
 
@@ -79,6 +80,12 @@ namespace hpx { namespace parallel { namespace execution {
     {
     };
 
+    template <typename T, typename Enable = void>
+    struct has_bulk_async_execute_void_member
+      : detail::has_bulk_async_execute_void<typename std::decay<T>::type>
+    {
+    };
+
     template <typename T, typename Enable = void>
     struct has_bulk_then_execute_member
       : detail::has_bulk_then_execute<typename std::decay<T>::type>
@@ -109,6 +116,10 @@ namespace hpx { namespace parallel { namespace execution {
     constexpr bool has_bulk_async_execute_member_v =
         has_bulk_async_execute_member<T>::value;
 
+    template <typename T>
+    constexpr bool has_bulk_async_execute_void_member_v =
+        has_bulk_async_execute_void_member<T>::value;
+
     template <typename T>
     constexpr bool has_bulk_then_execute_member_v =
         has_bulk_then_execute_member<T>::value;
@@ -286,6 +297,13 @@ namespace hpx { namespace traits {
     {
     };
 
+    template <typename T, typename Enable = void>
+    struct has_bulk_async_execute_void_member
+      : parallel::execution::has_bulk_async_execute_void_member<
+            typename std::decay<T>::type>
+    {
+    };
+
     template <typename T, typename Enable = void>
     struct has_bulk_then_execute_member
       : parallel::execution::has_bulk_then_execute_member<
@@ -10,9 +10,12 @@
 #include <hpx/modules/testing.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdlib>
 #include <iterator>
 #include <numeric>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -111,6 +114,68 @@ void test_bulk_async()
         .get();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void bulk_test_throw(int value, int passed_through)    //-V813
+{
+    HPX_TEST_EQ(passed_through, 42);
+    if (value % 2 == 0)
+    {
+        throw std::runtime_error("bulk_test_throw");
+    }
+}
+
+void test_bulk_async_void()
+{
+    typedef hpx::execution::parallel_executor executor;
+
+    hpx::thread::id tid = hpx::this_thread::get_id();
+
+    std::vector<int> v(107);
+    std::iota(std::begin(v), std::end(v), 0);
+
+    executor exec;
+    exec.bulk_async_execute_void(&bulk_test, v, tid, 42).get();
+
+    exec.bulk_async_execute_void(&bulk_test, std::vector<int>(), tid, 42)
+        .get();
+
+    bool caught_exception = false;
+    try
+    {
+        exec.bulk_async_execute_void(&bulk_test_throw, v, 42).get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.size(), std::size_t(54));
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+// the tasks are spawned hierarchically over several levels if the executor
+// is limited to a single task per level
+void test_bulk_async_void_hierarchical()
+{
+    typedef hpx::execution::parallel_executor executor;
+
+    std::vector<int> v(1000);
+    std::iota(std::begin(v), std::end(v), 0);
+
+    std::atomic<std::size_t> count(0);
+    executor exec(hpx::threads::thread_priority_default,
+        hpx::threads::thread_stacksize_default, {}, hpx::launch::async, 2, 1);
+    exec.bulk_async_execute_void(
+            [&count](int) { ++count; }, v)
+        .get();
+
+    HPX_TEST_EQ(count.load(), v.size());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void bulk_test_f(int value, hpx::shared_future<void> f, hpx::thread::id tid,
     int passed_through)    //-V813
@@ -162,6 +227,8 @@ void static_check_executor()
         "!has_bulk_sync_execute_member<executor>::value");
     static_assert(has_bulk_async_execute_member<executor>::value,
         "has_bulk_async_execute_member<executor>::value");
+    static_assert(has_bulk_async_execute_void_member<executor>::value,
+        "has_bulk_async_execute_void_member<executor>::value");
     static_assert(has_bulk_then_execute_member<executor>::value,
         "has_bulk_then_execute_member<executor>::value");
     static_assert(has_post_member<executor>::value,
@@ -179,6 +246,8 @@ int hpx_main(int argc, char* argv[])
 
     test_bulk_sync();
     test_bulk_async();
+    test_bulk_async_void();
+    test_bulk_async_void_hierarchical();
     test_bulk_then();
 
     return hpx::finalize();
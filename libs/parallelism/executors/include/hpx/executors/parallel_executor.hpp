@@ -13,6 +13,7 @@
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/errors/exception_list.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/execution/detail/async_launch_policy_dispatch.hpp>
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
@@ -24,7 +25,9 @@
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/functional/one_shot.hpp>
+#include <hpx/futures/detail/future_data.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/future_access.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
@@ -36,7 +39,9 @@
 #include <hpx/threading_base/thread_pool_base.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <exception>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -70,6 +75,78 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
 
     template <typename F, typename Shape, typename Future, typename... Ts>
     struct then_bulk_function_result;
+
+    ///////////////////////////////////////////////////////////////////////
+    // Shared state of the future returned from bulk_async_execute_void. It
+    // counts the outstanding invocations and becomes ready once the last of
+    // them has finished. Exceptions thrown by the invocations are collected
+    // and reported as a single hpx::exception_list.
+    struct bulk_void_state : hpx::lcos::detail::future_data<void>
+    {
+        // the initial reference is owned by the invocations
+        explicit bulk_void_state(std::size_t count)
+          : hpx::lcos::detail::future_data<void>(init_no_addref{})
+          , count_(count)
+          , has_errors_(false)
+        {
+        }
+
+        template <typename F, typename... Ts>
+        void execute(F&& f, Ts&&... ts) noexcept
+        {
+            try
+            {
+                hpx::util::invoke(std::forward<F>(f), std::forward<Ts>(ts)...);
+            }
+            catch (...)
+            {
+                errors_.add(std::current_exception());
+                has_errors_.store(true, std::memory_order_relaxed);
+            }
+            count_down();
+        }
+
+    private:
+        void count_down() noexcept
+        {
+            if (count_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                return;
+
+            // release the reference owned by the invocations
+            hpx::intrusive_ptr<bulk_void_state> this_(this, false);
+
+            try
+            {
+                if (has_errors_.load(std::memory_order_relaxed))
+                {
+                    set_exception(std::make_exception_ptr(std::move(errors_)));
+                }
+                else
+                {
+                    set_value(hpx::util::unused);
+                }
+            }
+            catch (...)
+            {
+                // the shared state can't be made ready twice
+                HPX_ASSERT(false);
+            }
+        }
+
+        std::atomic<std::size_t> count_;
+        std::atomic<bool> has_errors_;
+        hpx::exception_list errors_;
+    };
+
+    struct bulk_void_invoke
+    {
+        template <typename F, typename... Ts>
+        void operator()(bulk_void_state* state, F&& f, Ts&&... ts) const
+            noexcept
+        {
+            state->execute(std::forward<F>(f), std::forward<Ts>(ts)...);
+        }
+    };
 }}}}    // namespace hpx::parallel::execution::detail
 
 namespace hpx { namespace execution {
@@ -264,6 +341,48 @@ namespace hpx { namespace execution {
             return results;
         }
 
+        // Bulk execution of functions which do not return a value. All
+        // invocations share a single shared state, the returned future
+        // becomes ready once all of them have finished. Exceptions thrown by
+        // the invocations are reported as one hpx::exception_list.
+        template <typename F, typename S, typename... Ts>
+        hpx::future<void> bulk_async_execute_void(
+            F&& f, S const& shape, Ts&&... ts) const
+        {
+            std::size_t size = hpx::util::size(shape);
+            if (size == 0)
+            {
+                return hpx::make_ready_future();
+            }
+
+            std::size_t num_tasks = num_tasks_;
+            if (num_tasks == std::size_t(-1))
+            {
+                auto pool = threads::detail::get_self_or_default_pool();
+                num_tasks =
+                    (std::min)(std::size_t(128), pool->get_os_thread_count());
+            }
+
+            using state_type = parallel::execution::detail::bulk_void_state;
+            hpx::intrusive_ptr<state_type> state(new state_type(size));
+
+            lcos::local::latch l(size);
+            if (hpx::detail::has_async_policy(policy_))
+            {
+                spawn_hierarchical_void(state.get(), l, size, num_tasks, f,
+                    hpx::util::begin(shape), ts...);
+            }
+            else
+            {
+                spawn_sequential_void(
+                    state.get(), l, size, f, hpx::util::begin(shape), ts...);
+            }
+            l.wait();
+
+            return hpx::traits::future_access<hpx::future<void>>::create(
+                std::move(state));
+        }
+
         template <typename F, typename S, typename Future, typename... Ts>
         hpx::future<typename parallel::execution::detail::
                 bulk_then_execute_result<F, S, Future, Ts...>::type>
@@ -358,6 +477,65 @@ namespace hpx { namespace execution {
             // spawn remaining tasks sequentially
             spawn_sequential(results, l, base, size, func, it, ts...);
         }
+
+        template <typename F, typename Iter, typename... Ts>
+        void spawn_sequential_void(
+            parallel::execution::detail::bulk_void_state* state,
+            lcos::local::latch& l, std::size_t size, F&& func, Iter it,
+            Ts&&... ts) const
+        {
+            if (hpx::detail::has_async_policy(policy_))
+            {
+                // spawn tasks sequentially
+                hpx::util::thread_description desc(func);
+                for (std::size_t i = 0; i != size; ++i, ++it)
+                {
+                    parallel::execution::detail::post_policy_dispatch<
+                        Policy>::call(policy_, desc, priority_, stacksize_,
+                        schedulehint_,
+                        parallel::execution::detail::bulk_void_invoke{}, state,
+                        func, *it, ts...);
+                }
+            }
+            else
+            {
+                // run all invocations on the calling thread
+                for (std::size_t i = 0; i != size; ++i, ++it)
+                {
+                    state->execute(func, *it, ts...);
+                }
+            }
+
+            l.count_down(size);
+        }
+
+        template <typename F, typename Iter, typename... Ts>
+        void spawn_hierarchical_void(
+            parallel::execution::detail::bulk_void_state* state,
+            lcos::local::latch& l, std::size_t size, std::size_t num_tasks,
+            F&& func, Iter it, Ts&&... ts) const
+        {
+            if (size > num_tasks)
+            {
+                // spawn hierarchical tasks
+                std::size_t chunk_size = (size + num_spread_) / num_spread_ - 1;
+                chunk_size = (std::max)(chunk_size, num_tasks);
+
+                while (size > chunk_size)
+                {
+                    post([&, state, chunk_size, num_tasks, it] {
+                        spawn_hierarchical_void(
+                            state, l, chunk_size, num_tasks, func, it, ts...);
+                    });
+
+                    it = hpx::parallel::v1::detail::next(it, chunk_size);
+                    size -= chunk_size;
+                }
+            }
+
+            // spawn remaining tasks sequentially
+            spawn_sequential_void(state, l, size, func, it, ts...);
+        }
         /// \endcond
 
     private:
@@ -31,6 +31,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -200,12 +201,18 @@ namespace hpx { namespace lcos { namespace detail {
     {
         future_data_base()
           : state_(empty)
+          , on_completed_(nullptr)
+          , inline_continuation_used_(false)
+          , has_waiters_(false)
         {
         }
 
         future_data_base(init_no_addref no_addref)
           : future_data_refcnt_base(no_addref)
           , state_(empty)
+          , on_completed_(nullptr)
+          , inline_continuation_used_(false)
+          , has_waiters_(false)
         {
         }
 
@@ -288,6 +295,15 @@ namespace hpx { namespace lcos { namespace detail {
 
         virtual std::exception_ptr get_exception_ptr() const = 0;
 
+        // Wake up all threads waiting for this future and run all registered
+        // continuations, needs to be called after the state was changed to
+        // 'value' or 'exception'.
+        void signal_ready();
+
+        // Release all continuations which have not been run (if any) and
+        // allow for new continuations to be registered.
+        void reset_on_completed() noexcept;
+
         virtual std::string const& get_registered_name() const
         {
             HPX_THROW_EXCEPTION(invalid_status,
@@ -303,9 +319,41 @@ namespace hpx { namespace lcos { namespace detail {
         }
 
     protected:
+        // The continuations registered with this future are kept in an
+        // intrusive lock-free stack. Once the future has become ready, the
+        // head of the stack is replaced by the 'closed' marker, continuations
+        // registered after that point are invoked right away.
+        struct continuation_node
+        {
+            continuation_node() = default;
+
+            explicit continuation_node(completed_callback_type&& callback)
+              : callback_(std::move(callback))
+            {
+            }
+
+            completed_callback_type callback_;
+            continuation_node* next_ = nullptr;
+        };
+
+        static continuation_node* closed() noexcept
+        {
+            return reinterpret_cast<continuation_node*>(std::uintptr_t(1));
+        }
+
+        // The mutex and the condition variable are used only if a thread
+        // has to block in wait() or wait_until(), setting the value and
+        // attaching continuations is lock-free.
         mutable mutex_type mtx_;
         std::atomic<state> state_;    // current state
-        completed_callback_vector_type on_completed_;
+        std::atomic<continuation_node*> on_completed_;
+
+        // Most futures have exactly one continuation, the first one is stored
+        // in place to avoid an additional allocation.
+        continuation_node inline_continuation_;
+        std::atomic<bool> inline_continuation_used_;
+
+        std::atomic<bool> has_waiters_;
         local::detail::condition_variable cond_;    // threads waiting in read
     };
 
@@ -422,48 +470,25 @@ namespace hpx { namespace lcos { namespace detail {
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, std::forward<Ts>(ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'value' at this
             // point signals to all other threads that this future is ready.
+            // The ordering is sequentially consistent to synchronize with
+            // threads starting to wait (see wait()).
             state expected = empty;
             if (!state_.compare_exchange_strong(
-                    expected, value, std::memory_order_release))
+                    expected, value, std::memory_order_seq_cst))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_value",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(std::move(l), threads::thread_priority_boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
+            // wake up waiting threads and invoke the callback (continuation)
+            // functions
+            this->signal_ready();
         }
 
         void set_exception(std::exception_ptr data) override
@@ -479,48 +504,25 @@ namespace hpx { namespace lcos { namespace detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*) exception_ptr) std::exception_ptr(std::move(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'exception' at this
             // point signals to all other threads that this future is ready.
+            // The ordering is sequentially consistent to synchronize with
+            // threads starting to wait (see wait()).
             state expected = empty;
             if (!state_.compare_exchange_strong(
-                    expected, exception, std::memory_order_release))
+                    expected, exception, std::memory_order_seq_cst))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_exception",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(std::move(l), threads::thread_priority_boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
+            // wake up waiting threads and invoke the callback (continuation)
+            // functions
+            this->signal_ready();
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -633,7 +635,7 @@ namespace hpx { namespace lcos { namespace detail {
                 break;
             }
 
-            on_completed_.clear();
+            this->reset_on_completed();
         }
 
         std::exception_ptr get_exception_ptr() const override
@@ -644,11 +646,9 @@ namespace hpx { namespace lcos { namespace detail {
 
     protected:
         using base_type::mtx_;
-        using base_type::on_completed_;
         using base_type::state_;
 
     private:
-        using base_type::cond_;
         typename future_data_storage<Result>::type storage_;
     };
 
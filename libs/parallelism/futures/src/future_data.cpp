@@ -79,7 +79,10 @@ namespace hpx { namespace lcos { namespace detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    future_data_base<traits::detail::future_data_void>::~future_data_base() {}
+    future_data_base<traits::detail::future_data_void>::~future_data_base()
+    {
+        reset_on_completed();
+    }
 
     static util::unused_type unused_;
 
@@ -247,22 +250,133 @@ namespace hpx { namespace lcos { namespace detail {
         {
             // invoke the callback (continuation) function right away
             handle_on_completed(std::move(data_sink));
+            return;
+        }
+
+        continuation_node* node = nullptr;
+        if (!inline_continuation_used_.exchange(
+                true, std::memory_order_relaxed))
+        {
+            node = &inline_continuation_;
+            node->callback_ = std::move(data_sink);
         }
         else
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            if (is_ready())
+            node = new continuation_node(std::move(data_sink));
+        }
+
+        // publish the continuation, this is a single CAS unless other
+        // continuations are attached concurrently
+        continuation_node* head = on_completed_.load(std::memory_order_acquire);
+        do
+        {
+            if (head == closed())
             {
-                l.unlock();
+                // the future has become ready in the meantime, invoke the
+                // callback (continuation) function right away
+                completed_callback_type on_completed =
+                    std::move(node->callback_);
+                node->callback_.reset();
+                if (node != &inline_continuation_)
+                    delete node;
+
+                handle_on_completed(std::move(on_completed));
+                return;
+            }
+            node->next_ = head;
+        } while (!on_completed_.compare_exchange_weak(head, node,
+            std::memory_order_release, std::memory_order_acquire));
+    }
+
+    void future_data_base<traits::detail::future_data_void>::signal_ready()
+    {
+        // Wake up all threads waiting for the future to become ready. The
+        // lock has to be acquired only if a thread has started waiting.
+        if (has_waiters_.load(std::memory_order_seq_cst))
+        {
+            std::unique_lock<mutex_type> l(mtx_);
 
-                // invoke the callback (continuation) function
-                handle_on_completed(std::move(data_sink));
+            // Note: we use notify_one repeatedly instead of notify_all as we
+            //       know: a) that most of the time we have at most one thread
+            //       waiting on the future (most futures are not shared), and
+            //       b) our implementation of condition_variable::notify_one
+            //       relinquishes the lock before resuming the waiting thread
+            //       which avoids suspension of this thread when it tries to
+            //       re-lock the mutex while exiting from condition_variable::wait
+            while (
+                cond_.notify_one(std::move(l), threads::thread_priority_boost))
+            {
+                l = std::unique_lock<mutex_type>(mtx_);
             }
-            else
+
+            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+            //       it unlocked when returning.
+        }
+
+        // Close the list of continuations, all continuations registered from
+        // now on will be invoked directly by set_on_completed().
+        continuation_node* head =
+            on_completed_.exchange(closed(), std::memory_order_acq_rel);
+        if (head == nullptr)
+            return;
+
+        HPX_ASSERT(head != closed());
+        if (head->next_ == nullptr)
+        {
+            // invoke the only callback (continuation) function
+            completed_callback_type on_completed = std::move(head->callback_);
+            head->callback_.reset();
+            if (head != &inline_continuation_)
+                delete head;
+
+            handle_on_completed(std::move(on_completed));
+            return;
+        }
+
+        // the list holds the continuations in reverse order of registration
+        std::size_t count = 0;
+        for (continuation_node* p = head; p != nullptr; p = p->next_)
+            ++count;
+
+        completed_callback_vector_type on_completed(count);
+        while (head != nullptr)
+        {
+            continuation_node* next = head->next_;
+
+            on_completed[--count] = std::move(head->callback_);
+            head->callback_.reset();
+            if (head != &inline_continuation_)
+                delete head;
+
+            head = next;
+        }
+
+        // invoke the callback (continuation) functions
+        handle_on_completed(std::move(on_completed));
+    }
+
+    void future_data_base<
+        traits::detail::future_data_void>::reset_on_completed() noexcept
+    {
+        // no synchronization is required as semantics guarantee a single
+        // writer and no reader
+        continuation_node* head =
+            on_completed_.exchange(nullptr, std::memory_order_relaxed);
+        if (head != closed())
+        {
+            while (head != nullptr)
             {
-                on_completed_.push_back(std::move(data_sink));
+                continuation_node* next = head->next_;
+                if (head != &inline_continuation_)
+                    delete head;
+                head = next;
             }
         }
+
+        inline_continuation_.callback_.reset();
+        inline_continuation_.next_ = nullptr;
+        inline_continuation_used_.store(false, std::memory_order_relaxed);
+        has_waiters_.store(false, std::memory_order_relaxed);
     }
 
     future_data_base<traits::detail::future_data_void>::state
@@ -273,7 +387,11 @@ namespace hpx { namespace lcos { namespace detail {
         if (s == empty)
         {
             std::unique_lock<mutex_type> l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
+
+            // announce the waiting thread before checking the state again,
+            // signal_ready() checks the flag after changing the state
+            has_waiters_.store(true, std::memory_order_seq_cst);
+            s = state_.load(std::memory_order_seq_cst);
             if (s == empty)
             {
                 cond_.wait(l, "future_data_base::wait", ec);
@@ -295,7 +413,9 @@ namespace hpx { namespace lcos { namespace detail {
         if (state_.load(std::memory_order_acquire) == empty)
         {
             std::unique_lock<mutex_type> l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+
+            has_waiters_.store(true, std::memory_order_seq_cst);
+            if (state_.load(std::memory_order_seq_cst) == empty)
             {
                 threads::thread_state_ex_enum const reason = cond_.wait_until(
                     l, abs_time, "future_data_base::wait_until", ec);
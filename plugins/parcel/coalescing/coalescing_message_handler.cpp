@@ -14,6 +14,8 @@
 #include <hpx/plugin/traits/plugin_config_data.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/string_util/classification.hpp>
+#include <hpx/string_util/split.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/util/from_string.hpp>
@@ -25,6 +27,7 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -43,6 +46,9 @@ namespace hpx { namespace traits
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      allow_background_flush = 1
+    //      adaptive = 0
+    //      bypass =
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -51,7 +57,9 @@ namespace hpx { namespace traits
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "bypass = ";
         }
     };
 }}
@@ -87,6 +95,31 @@ namespace hpx { namespace plugins { namespace parcel
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        // latency critical actions are listed (comma separated) in the
+        // configuration entry 'bypass', their parcels are never coalesced
+        bool get_bypass(std::string const& action_name)
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.bypass", "");
+            if (value.empty())
+                return false;
+
+            std::vector<std::string> actions;
+            hpx::string_util::split(actions, value,
+                hpx::string_util::is_any_of(", "),
+                hpx::string_util::token_compress_mode::on);
+
+            return std::find(actions.begin(), actions.end(), action_name) !=
+                actions.end();
+        }
     }
 
     void coalescing_message_handler::update_num_messages()
@@ -94,12 +127,30 @@ namespace hpx { namespace plugins { namespace parcel
         std::lock_guard<mutex_type> l(mtx_);
         num_coalesced_parcels_ =
             detail::get_num_messages(num_coalesced_parcels_);
+        batch_size_ = adaptive_ ?
+            (std::min)(batch_size_, num_coalesced_parcels_) :
+            num_coalesced_parcels_;
     }
 
     void coalescing_message_handler::update_interval()
     {
         std::lock_guard<mutex_type> l(mtx_);
         interval_ = detail::get_interval(interval_);
+        flush_interval_ = std::int64_t(interval_) * 1000;
+    }
+
+    void coalescing_message_handler::update_adaptive()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        adaptive_ = detail::get_adaptive();
+        batch_size_ = num_coalesced_parcels_;
+        flush_interval_ = std::int64_t(interval_) * 1000;
+    }
+
+    void coalescing_message_handler::update_bypass()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        bypass_ = detail::get_bypass(action_name_);
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -116,6 +167,12 @@ namespace hpx { namespace plugins { namespace parcel
         stopped_(false),
         allow_background_flush_(detail::get_background_flush()),
         action_name_(action_name),
+        adaptive_(detail::get_adaptive()),
+        bypass_(detail::get_bypass(action_name_)),
+        batch_size_(num_coalesced_parcels_),
+        flush_interval_(std::int64_t(interval_) * 1000),
+        average_time_between_parcels_(0),
+        pending_parcels_(0),
         num_parcels_(0), reset_num_parcels_(0),
             reset_num_parcels_per_message_parcels_(0),
         num_messages_(0), reset_num_messages_(0),
@@ -136,7 +193,10 @@ namespace hpx { namespace plugins { namespace parcel
             util::bind_front(&coalescing_message_handler::
                 get_average_time_between_parcels, this),
             util::bind_front(&coalescing_message_handler::
-                get_time_between_parcels_histogram_creator, this));
+                get_time_between_parcels_histogram_creator, this),
+            util::bind_front(&coalescing_message_handler::get_batch_size, this),
+            util::bind_front(
+                &coalescing_message_handler::get_flush_interval, this));
 
         // register parameter update callbacks
         set_config_entry_callback(
@@ -145,6 +205,55 @@ namespace hpx { namespace plugins { namespace parcel
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             util::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.adaptive",
+            util::bind(&coalescing_message_handler::update_adaptive, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.bypass",
+            util::bind(&coalescing_message_handler::update_bypass, this));
+    }
+
+    // Derive the number of parcels to coalesce and the flush deadline from
+    // the observed time between parcels. The configured number of messages
+    // and interval are used as upper bounds. A batch is only as large as the
+    // number of parcels expected to arrive during the configured interval,
+    // which avoids delaying parcels of sparse traffic. If the parcelport has
+    // parcels waiting for a connection, sending earlier would not reduce the
+    // latency, so the batches are allowed to grow.
+    void coalescing_message_handler::update_adaptive_parameters(
+        std::int64_t time_since_last_parcel)
+    {
+        if (average_time_between_parcels_ == 0)
+        {
+            average_time_between_parcels_ = double(time_since_last_parcel);
+        }
+        else
+        {
+            // exponentially weighted moving average
+            average_time_between_parcels_ += (double(time_since_last_parcel) -
+                average_time_between_parcels_) / 8;
+        }
+
+        std::int64_t const max_interval = std::int64_t(interval_) * 1000;
+        double const expected_parcels = average_time_between_parcels_ > 0 ?
+            double(max_interval) / average_time_between_parcels_ :
+            double(num_coalesced_parcels_);
+
+        std::size_t batch_size = (std::min)(std::size_t(expected_parcels),
+            num_coalesced_parcels_);
+
+        if (pending_parcels_.load(std::memory_order_relaxed) != 0)
+        {
+            batch_size_ = (std::max)(
+                (std::min)(2 * batch_size, num_coalesced_parcels_),
+                std::size_t(1));
+            flush_interval_ = max_interval;
+            return;
+        }
+
+        batch_size_ = (std::max)(batch_size, std::size_t(1));
+        flush_interval_ = (std::min)(max_interval,
+            std::int64_t(double(batch_size_) * average_time_between_parcels_));
     }
 
     void coalescing_message_handler::put_parcel(
@@ -163,14 +272,19 @@ namespace hpx { namespace plugins { namespace parcel
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
-        std::chrono::microseconds interval(interval_);
+        if (adaptive_)
+            update_adaptive_parameters(time_since_last_parcel);
+
+        std::chrono::nanoseconds interval(flush_interval_);
 
-        // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
-        if (stopped_ ||
+        // just send parcel if the coalescing was stopped, the action is
+        // latency critical, or the buffer is empty and either the time since
+        // last parcel is larger than coalescing interval or no other parcel
+        // is expected to arrive in time.
+        if (stopped_ || bypass_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval
-           ))
+                (std::chrono::nanoseconds(time_since_last_parcel) > interval ||
+                    batch_size_ <= 1)))
         {
             ++num_messages_;
             l.unlock();
@@ -183,6 +297,9 @@ namespace hpx { namespace plugins { namespace parcel
         detail::message_buffer::message_buffer_append_state s =
             buffer_.append(dest, std::move(p), std::move(f));
 
+        if (buffer_.size() >= batch_size_)
+            s = detail::message_buffer::buffer_now_full;
+
         switch(s) {
         case detail::message_buffer::first_message:
             HPX_FALLTHROUGH;
@@ -272,9 +389,18 @@ namespace hpx { namespace plugins { namespace parcel
         std::swap(buff, buffer_);
 
         ++num_messages_;
+        bool const adaptive = adaptive_;
         l.unlock();
 
         HPX_ASSERT(nullptr != pp_);
+
+        // sample the number of parcels waiting for a connection
+        if (adaptive)
+        {
+            pending_parcels_.store(pp_->get_pending_parcels_count(false),
+                std::memory_order_relaxed);
+        }
+
         buff(pp_);                   // 'invoke' the buffer
 
         return true;
@@ -311,6 +437,18 @@ namespace hpx { namespace plugins { namespace parcel
         return value;
     }
 
+    std::int64_t coalescing_message_handler::get_batch_size(bool)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return std::int64_t(batch_size_);
+    }
+
+    std::int64_t coalescing_message_handler::get_flush_interval(bool)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return flush_interval_;
+    }
+
     std::int64_t coalescing_message_handler::get_parcels_count(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
@@ -0,0 +1,165 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_TCP)
+#include <hpx/plugins/parcelport/tcp/buffer_pool.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    buffer_pool::buffer_pool()
+      : max_retained_bytes_(0)
+      , retained_bytes_(0)
+      , hits_(0)
+      , misses_(0)
+    {
+    }
+
+    buffer_pool::~buffer_pool()
+    {
+        clear();
+    }
+
+    buffer_pool& buffer_pool::get_buffer_pool()
+    {
+        // the pool is intentionally never destroyed, buffers may still be
+        // released during static destruction
+        static buffer_pool* pool = new buffer_pool;
+        return *pool;
+    }
+
+    // Return the index of the smallest size class able to hold the given
+    // number of bytes, or num_size_classes if the size is too large.
+    std::size_t buffer_pool::get_size_class(std::size_t size) noexcept
+    {
+        std::size_t index = 0;
+        std::size_t class_size = std::size_t(1) << min_size_class_bits;
+        while (class_size < size && index != num_size_classes)
+        {
+            class_size <<= 1;
+            ++index;
+        }
+        return index;
+    }
+
+    void* buffer_pool::allocate(std::size_t size)
+    {
+        std::size_t const index = get_size_class(size);
+        if (index == num_size_classes)
+        {
+            ++misses_;
+            return ::operator new(size);
+        }
+
+        size_class& c = size_classes_[index].data_;
+        {
+            std::lock_guard<mutex_type> l(c.mtx_);
+            if (!c.blocks_.empty())
+            {
+                void* p = c.blocks_.back();
+                c.blocks_.pop_back();
+
+                retained_bytes_ -= std::size_t(1)
+                    << (index + min_size_class_bits);
+                ++hits_;
+                return p;
+            }
+        }
+
+        ++misses_;
+        return ::operator new(std::size_t(1) << (index + min_size_class_bits));
+    }
+
+    void buffer_pool::deallocate(void* p, std::size_t size) noexcept
+    {
+        if (p == nullptr)
+            return;
+
+        std::size_t const index = get_size_class(size);
+        if (index == num_size_classes)
+        {
+            ::operator delete(p);
+            return;
+        }
+
+        // keep the block only if this does not exceed the configured limit
+        std::size_t const class_size = std::size_t(1)
+            << (index + min_size_class_bits);
+        std::size_t retained = retained_bytes_.load(std::memory_order_relaxed);
+        do
+        {
+            if (retained + class_size >
+                max_retained_bytes_.load(std::memory_order_relaxed))
+            {
+                ::operator delete(p);
+                return;
+            }
+        } while (!retained_bytes_.compare_exchange_weak(
+            retained, retained + class_size, std::memory_order_relaxed));
+
+        size_class& c = size_classes_[index].data_;
+        try
+        {
+            std::lock_guard<mutex_type> l(c.mtx_);
+            c.blocks_.push_back(p);
+        }
+        catch (std::bad_alloc const&)
+        {
+            retained_bytes_ -= class_size;
+            ::operator delete(p);
+        }
+    }
+
+    void buffer_pool::set_max_retained_bytes(std::size_t max_retained_bytes)
+    {
+        max_retained_bytes_.store(max_retained_bytes);
+        if (retained_bytes_.load() > max_retained_bytes)
+            clear();
+    }
+
+    void buffer_pool::clear()
+    {
+        for (std::size_t i = 0; i != num_size_classes; ++i)
+        {
+            std::vector<void*> blocks;
+            {
+                size_class& c = size_classes_[i].data_;
+                std::lock_guard<mutex_type> l(c.mtx_);
+                std::swap(blocks, c.blocks_);
+            }
+
+            retained_bytes_ -= blocks.size() *
+                (std::size_t(1) << (i + min_size_class_bits));
+            for (void* p : blocks)
+                ::operator delete(p);
+        }
+    }
+
+    std::int64_t buffer_pool::get_hits(bool reset)
+    {
+        return reset ? hits_.exchange(0) : hits_.load();
+    }
+
+    std::int64_t buffer_pool::get_misses(bool reset)
+    {
+        return reset ? misses_.exchange(0) : misses_.load();
+    }
+
+    std::int64_t buffer_pool::get_retained_bytes(bool) const
+    {
+        return static_cast<std::int64_t>(retained_bytes_.load());
+    }
+}}}}
+
+#endif
@@ -16,6 +16,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/plugins/parcelport/tcp/buffer_pool.hpp>
 #include <hpx/plugins/parcelport/tcp/connection_handler.hpp>
 #include <hpx/plugins/parcelport/tcp/receiver.hpp>
 #include <hpx/plugins/parcelport/tcp/sender.hpp>
@@ -66,17 +67,28 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+      , inline_chunk_threshold_(hpx::util::get_entry_as<std::size_t>(ini,
+            "hpx.parcel.tcp.inline_chunk_threshold",
+            std::size_t(HPX_PARCEL_TCP_INLINE_CHUNK_THRESHOLD)))
     {
         if (here_.type() != std::string("tcp")) {
             HPX_THROW_EXCEPTION(network_error, "tcp::parcelport::parcelport",
                 "this parcelport was instantiated to represent an unexpected "
                 "locality type: " + std::string(here_.type()));
         }
+
+        buffer_pool::get_buffer_pool().set_max_retained_bytes(
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel.tcp.buffer_pool_size",
+                std::size_t(HPX_PARCEL_TCP_BUFFER_POOL_SIZE)));
     }
 
     connection_handler::~connection_handler()
     {
         HPX_ASSERT(acceptor_ == nullptr);
+
+        // release the memory held by the buffer pool
+        buffer_pool::get_buffer_pool().set_max_retained_bytes(0);
     }
 
     bool connection_handler::do_run()
@@ -154,7 +166,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
-        std::shared_ptr<sender> sender_connection(new sender(io_service, l, this));
+        std::shared_ptr<sender> sender_connection(new sender(
+            io_service, l, this, inline_chunk_threshold_));
 
         // Connect to the target locality, retry if needed
         boost::system::error_code error = boost::asio::error::try_again;
@@ -246,6 +259,31 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         return sender_connection;
     }
 
+    std::int64_t connection_handler::get_buffer_pool_statistics(
+        buffer_pool_statistics_type t, bool reset)
+    {
+        buffer_pool& pool = buffer_pool::get_buffer_pool();
+        switch (t)
+        {
+        case buffer_pool_hits:
+            return pool.get_hits(reset);
+
+        case buffer_pool_misses:
+            return pool.get_misses(reset);
+
+        case buffer_pool_retained_bytes:
+            return pool.get_retained_bytes(reset);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(bad_parameter,
+            "tcp::connection_handler::get_buffer_pool_statistics",
+            "invalid buffer pool statistics type");
+        return 0;
+    }
+
     parcelset::locality connection_handler::agas_locality(
         util::runtime_configuration const & ini) const
     {
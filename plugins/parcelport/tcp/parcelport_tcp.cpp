@@ -8,6 +8,8 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/preprocessor/expand.hpp>
+#include <hpx/preprocessor/stringize.hpp>
 
 #include <hpx/plugins/parcelport/tcp/connection_handler.hpp>
 #include <hpx/plugins/parcelport/tcp/sender.hpp>
@@ -22,6 +24,8 @@ namespace hpx { namespace traits
     //      [hpx.parcel.tcp]
     //      ...
     //      priority = 1
+    //      buffer_pool_size = 67108864
+    //      inline_chunk_threshold = 1024
     //
     template <>
     struct plugin_config_data<hpx::parcelset::policies::tcp::connection_handler>
@@ -36,7 +40,13 @@ namespace hpx { namespace traits
         }
         static char const* call()
         {
-            return "";
+            return "buffer_pool_size = ${HPX_PARCEL_TCP_BUFFER_POOL_SIZE:"
+                HPX_PP_STRINGIZE(HPX_PP_EXPAND(
+                    HPX_PARCEL_TCP_BUFFER_POOL_SIZE)) "}\n"
+                "inline_chunk_threshold = "
+                    "${HPX_PARCEL_TCP_INLINE_CHUNK_THRESHOLD:"
+                HPX_PP_STRINGIZE(HPX_PP_EXPAND(
+                    HPX_PARCEL_TCP_INLINE_CHUNK_THRESHOLD)) "}";
         }
     };
 }}
@@ -21,6 +21,7 @@
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/async_distributed.hpp>
+#include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/execution.hpp>
 #include <hpx/modules/format.hpp>
@@ -136,11 +137,123 @@ namespace hpx { namespace agas
         }
     }; // }}}
 
+    struct addressing_service::gva_cache_shard
+    {    // {{{ gva_cache_shard implementation
+        mutable mutex_type mtx_;
+        gva_cache_type cache_;
+
+        // pad to cache line size to avoid false sharing between the locks of
+        // neighboring shards
+        char cacheline_pad_[threads::get_cache_line_size()];
+    }; // }}}
+
+    namespace detail
+    {
+        // Consecutive GIDs are grouped into blocks of this size, all GIDs of
+        // a block are stored in the same cache shard.
+        constexpr std::size_t gva_cache_shard_block_bits = 4;
+
+        inline std::size_t get_gva_cache_shard_block(
+            naming::gid_type const& gid)
+        {
+            std::uint64_t const msb =
+                naming::detail::strip_internal_bits_from_gid(gid.get_msb());
+            std::uint64_t const h = (gid.get_lsb() >>
+                gva_cache_shard_block_bits) ^ (msb * 0x9e3779b97f4a7c15ull);
+            return static_cast<std::size_t>(h ^ (h >> 32));
+        }
+
+        inline std::size_t get_gva_cache_shard_count(
+            util::runtime_configuration const& ini)
+        {
+            std::size_t shards = ini.get_agas_local_cache_shards();
+            if (shards == 0)
+            {
+                // use one shard per worker thread by default
+                shards = ini.get_os_thread_count();
+            }
+
+            // round up to the next power of two
+            std::size_t result = 1;
+            while (result < shards && result < 1024)
+                result <<= 1;
+            return result;
+        }
+
+        // Return the shard responsible for the given GID.
+        inline addressing_service::gva_cache_shard& get_gva_cache_shard(
+            addressing_service& as, naming::gid_type const& gid)
+        {
+            return as.gva_cache_shards_[get_gva_cache_shard_block(gid) &
+                (as.gva_cache_shard_count_ - 1)];
+        }
+
+        // Invoke f for each shard which is responsible for at least one of the
+        // GIDs covered by the given key. Ranges spanning more than one block
+        // of GIDs are stored in all of the corresponding shards.
+        template <typename F>
+        bool for_each_gva_cache_shard(addressing_service& as,
+            addressing_service::gva_cache_key const& key, F&& f)
+        {
+            std::size_t const count = as.gva_cache_shard_count_;
+
+            naming::gid_type const first = key.get_gid();
+            std::uint64_t const blocks =
+                ((first.get_lsb() + key.get_count()) >>
+                    gva_cache_shard_block_bits) -
+                (first.get_lsb() >> gva_cache_shard_block_bits) + 1;
+
+            bool result = true;
+            if (blocks >= count)
+            {
+                for (std::size_t i = 0; i != count; ++i)
+                    result = f(as.gva_cache_shards_[i]) && result;
+                return result;
+            }
+
+            std::vector<bool> visited(count, false);
+            naming::gid_type block_gid = first;
+            for (std::uint64_t i = 0; i != blocks; ++i)
+            {
+                std::size_t const idx =
+                    get_gva_cache_shard_block(block_gid) & (count - 1);
+                if (!visited[idx])
+                {
+                    visited[idx] = true;
+                    result = f(as.gva_cache_shards_[idx]) && result;
+                }
+                block_gid = naming::gid_type(block_gid.get_msb(),
+                    block_gid.get_lsb() +
+                        (std::uint64_t(1) << gva_cache_shard_block_bits));
+            }
+            return result;
+        }
+
+        // Accumulate the given statistics value over all shards
+        template <typename F>
+        std::uint64_t accumulate_gva_cache_shards(
+            addressing_service& as, F&& f)
+        {
+            std::uint64_t result = 0;
+            for (std::size_t i = 0; i != as.gva_cache_shard_count_; ++i)
+            {
+                addressing_service::gva_cache_shard& shard =
+                    as.gva_cache_shards_[i];
+
+                std::lock_guard<addressing_service::mutex_type> lock(
+                    shard.mtx_);
+                result += f(shard.cache_);
+            }
+            return result;
+        }
+    }
+
 addressing_service::addressing_service(
     util::runtime_configuration const& ini_
   , runtime_mode runtime_type_
     )
-  : gva_cache_(new gva_cache_type)
+  : gva_cache_shard_count_(detail::get_gva_cache_shard_count(ini_))
+  , gva_cache_shards_(new gva_cache_shard[gva_cache_shard_count_])
   , console_cache_(naming::invalid_locality_id)
   , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
   , refcnt_requests_count_(0)
@@ -156,7 +269,15 @@ addressing_service::addressing_service(
   , locality_()
 {
     if (caching_)
-        gva_cache_->reserve(ini_.get_agas_local_cache_size());
+        adjust_local_cache_size(ini_.get_agas_local_cache_size());
+}
+
+addressing_service::~addressing_service()
+{
+#if defined(HPX_HAVE_NETWORKING)
+    // TODO: Free the future pools?
+    destroy_big_boot_barrier();
+#endif
 }
 
 #if defined(HPX_HAVE_NETWORKING)
@@ -384,8 +505,23 @@ void addressing_service::adjust_local_cache_size(std::size_t cache_size)
     // create the hierarchy based on the topology
     if (caching_)
     {
-        std::size_t previous = gva_cache_->size();
-            gva_cache_->reserve(cache_size);
+        // the overall cache size is evenly distributed across all shards
+        std::size_t shard_size = cache_size;
+        if (cache_size != std::size_t(~0x0ul))
+        {
+            shard_size = (cache_size + gva_cache_shard_count_ - 1) /
+                gva_cache_shard_count_;
+        }
+
+        std::size_t previous = 0;
+        for (std::size_t i = 0; i != gva_cache_shard_count_; ++i)
+        {
+            gva_cache_shard& shard = gva_cache_shards_[i];
+
+            std::lock_guard<mutex_type> lock(shard.mtx_);
+            previous += shard.cache_.size();
+            shard.cache_.reserve(shard_size);
+        }
 
         LAGAS_(info) << hpx::util::format(
             "addressing_service::adjust_local_cache_size, previous size: {1}, "
@@ -1953,33 +2089,44 @@ void addressing_service::update_cache_entry(
 
         const gva_cache_key key(gid, count);
 
-        {
-            std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-            if (!gva_cache_->update_if(key, g, check_for_collisions))
+        bool data_corruption = false;
+        detail::for_each_gva_cache_shard(*this, key,
+            [&](gva_cache_shard& shard) -> bool
             {
+                std::unique_lock<mutex_type> lock(shard.mtx_);
+                if (shard.cache_.update_if(key, g, check_for_collisions))
+                    return true;
+
                 if (LAGAS_ENABLED(warning))
                 {
                     // Figure out who we collided with.
                     addressing_service::gva_cache_key idbase;
                     addressing_service::gva_cache_type::entry_type e;
 
-                    if (!gva_cache_->get_entry(key, idbase, e))
+                    if (!shard.cache_.get_entry(key, idbase, e))
                     {
                         // This is impossible under sane conditions.
-                        lock.unlock();
-                        HPX_THROWS_IF(ec, invalid_data
-                          , "addressing_service::update_cache_entry"
-                          , "data corruption or lock error occurred in cache");
-                        return;
+                        data_corruption = true;
+                        return false;
                     }
 
+                    lock.unlock();
+
                     LAGAS_(warning) << hpx::util::format(
                         "addressing_service::update_cache_entry, "
                         "aborting update due to key collision in cache, "
                         "new_gid({1}), new_count({2}), old_gid({3}), old_count({4})",
                         gid, count, idbase.get_gid(), idbase.get_count());
                 }
-            }
+                return false;
+            });
+
+        if (data_corruption)
+        {
+            HPX_THROWS_IF(ec, invalid_data
+              , "addressing_service::update_cache_entry"
+              , "data corruption or lock error occurred in cache");
+            return;
         }
 
         if (&ec != &throws)
@@ -2005,15 +2152,18 @@ bool addressing_service::get_cache_entry(
     gva_cache_key k(gid);
     gva_cache_key idbase_key;
 
-    std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-    if(gva_cache_->get_entry(k, idbase_key, gva))
+    gva_cache_shard& shard = detail::get_gva_cache_shard(*this, k.get_gid());
+
+    std::unique_lock<mutex_type> lock(shard.mtx_);
+    if(shard.cache_.get_entry(k, idbase_key, gva))
     {
+        lock.unlock();
+
         const std::uint64_t id_msb =
             naming::detail::strip_internal_bits_from_gid(gid.get_msb());
 
         if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
         {
-            lock.unlock();
             HPX_THROWS_IF(ec, internal_server_error
               , "addressing_service::get_cache_entry"
               , "bad entry in cache, MSBs of GID base and GID do not match");
@@ -2042,9 +2192,13 @@ void addressing_service::clear_cache(
     try {
         LAGAS_(warning) << "addressing_service::clear_cache, clearing cache";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+        for (std::size_t i = 0; i != gva_cache_shard_count_; ++i)
+        {
+            gva_cache_shard& shard = gva_cache_shards_[i];
 
-        gva_cache_->clear();
+            std::lock_guard<mutex_type> lock(shard.mtx_);
+            shard.cache_.clear();
+        }
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -2089,13 +2243,18 @@ void addressing_service::remove_cache_entry(
     try {
         LAGAS_(warning) << "addressing_service::remove_cache_entry";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+        // the entry might be a range stored in more than one shard
+        for (std::size_t i = 0; i != gva_cache_shard_count_; ++i)
+        {
+            gva_cache_shard& shard = gva_cache_shards_[i];
 
-        gva_cache_->erase(
-            [&gid](std::pair<gva_cache_key, gva> const& p)
-            {
-                return gid == p.first.get_gid();
-            });
+            std::lock_guard<mutex_type> lock(shard.mtx_);
+            shard.cache_.erase(
+                [&gid](std::pair<gva_cache_key, gva> const& p)
+                {
+                    return gid == p.first.get_gid();
+                });
+        }
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -2240,81 +2399,105 @@ namespace detail
 // Helper functions to access the current cache statistics
 std::uint64_t addressing_service::get_cache_entries(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->size();
+    return detail::accumulate_gva_cache_shards(*this,
+        [](gva_cache_type const& cache) { return cache.size(); });
 }
 
 std::uint64_t addressing_service::get_cache_hits(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().hits(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().hits(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_misses(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().misses(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().misses(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_evictions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().evictions(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().evictions(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().insertions(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().insertions(reset);
+        });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_count(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().get_get_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_count(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().get_insert_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_count(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().get_update_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_count(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().get_erase_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_time(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().get_get_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_time(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().get_insert_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_time(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().get_update_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_time(reset);
+    return detail::accumulate_gva_cache_shards(*this,
+        [=](gva_cache_type& cache) {
+            return cache.get_statistics().get_erase_entry_time(reset);
+        });
 }
 
 /// Install performance counter types exposing properties from the local cache.
@@ -30,12 +30,15 @@
 #include <hpx/runtime/naming/resolver_client.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/timing/scoped_timer.hpp>
+#include <hpx/util/from_string.hpp>
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -140,6 +143,14 @@ void primary_namespace::register_global_counter_types(
                    "AGAS services";
             type = performance_counters::counter_monotonically_increasing;
         }
+        else if (detail::primary_namespace_services[i].target_ ==
+            detail::counter_target_contention)
+        {
+            help = "returns the number of contended lock acquisitions of the "
+                   "primary AGAS tables, the counter parameter selects a "
+                   "single table partition (default: all partitions)";
+            type = performance_counters::counter_monotonically_increasing;
+        }
         else
         {
             help = "returns the overall execution time of all primary AGAS "
@@ -235,6 +246,122 @@ serialization::binary_filter* primary_namespace::get_serialization_filter(
 }
 #endif
 
+namespace {
+
+    // Find the binding whose range contains the given id.
+    template <typename Table>
+    auto find_binding(Table& gvas, naming::gid_type const& id)
+        -> decltype(gvas.begin())
+    {
+        auto it = gvas.upper_bound(id);
+        if (it == gvas.begin())
+            return gvas.end();
+
+        --it;
+        if (it->first == id || (it->first + it->second.first.count) > id)
+            return it;
+
+        return gvas.end();
+    }
+
+    // Return the end of the run of ids starting at the given one which
+    // belong to the same partition, bounded by upper.
+    naming::gid_type end_of_run(
+        naming::gid_type const& id, naming::gid_type const& upper)
+    {
+        std::uint64_t const block_size =
+            std::uint64_t(1) << primary_namespace::partition_block_bits;
+
+        naming::gid_type const next =
+            id + (block_size - (id.get_lsb() & (block_size - 1)));
+        return next < upper ? next : upper;
+    }
+
+    // release the (optionally held) lock of the spanning table followed by
+    // the partition lock
+    template <typename Mutex>
+    void unlock_all(std::unique_lock<Mutex>& l, std::unique_lock<Mutex>& sl)
+    {
+        if (sl.owns_lock())
+            sl.unlock();
+        l.unlock();
+    }
+}
+
+std::size_t primary_namespace::get_partition_index(
+    naming::gid_type const& gid)
+{
+    naming::gid_type id = gid;
+    naming::detail::strip_internal_bits_from_gid(id);
+
+    // consecutive blocks of ids are distributed round robin
+    std::uint64_t const block =
+        (id.get_lsb() >> partition_block_bits) + id.get_msb();
+    return static_cast<std::size_t>(block % num_partitions);
+}
+
+std::unique_lock<primary_namespace::mutex_type>
+primary_namespace::lock_partition(partition& p)
+{
+    std::unique_lock<mutex_type> l(p.mutex_, std::try_to_lock);
+    if (!l.owns_lock())
+    {
+        ++p.contention_;
+        l.lock();
+    }
+    return l;
+}
+
+bool primary_namespace::is_spanning(
+    naming::gid_type const& id, std::uint64_t count)
+{
+    if (count <= 1)
+        return false;
+
+    naming::gid_type const last = id + (count - 1);
+    return id.get_msb() != last.get_msb() ||
+        (id.get_lsb() >> partition_block_bits) !=
+            (last.get_lsb() >> partition_block_bits);
+}
+
+bool primary_namespace::resolve_spanning_gid(naming::gid_type const& id,
+    naming::gid_type& base, gva_table_data_type& data)
+{
+    // fast path: most applications never create bindings crossing a
+    // partition block, don't touch the shared lock in this case (the count
+    // is modified while holding the lock)
+    if (num_spanning_gvas_.load(std::memory_order_acquire) == 0)
+        return false;
+
+    std::lock_guard<mutex_type> l(spanning_mutex_);
+
+    gva_table_type::const_iterator it = find_binding(spanning_gvas_, id);
+    if (it == spanning_gvas_.end())
+        return false;
+
+    base = it->first;
+    data = it->second;
+    return true;
+}
+
+std::int64_t primary_namespace::get_contention_count(
+    std::size_t partition, bool reset)
+{
+    if (partition != num_partitions)
+    {
+        HPX_ASSERT(partition < num_partitions);
+        return util::get_and_reset_value(
+            partitions_[partition].contention_, reset);
+    }
+
+    std::int64_t result = 0;
+    for (auto& p : partitions_)
+    {
+        result += util::get_and_reset_value(p.contention_, reset);
+    }
+    return result;
+}
+
 // start migration of the given object
 std::pair<naming::id_type, naming::address>
 primary_namespace::begin_migration(naming::gid_type id)
@@ -246,10 +373,11 @@ primary_namespace::begin_migration(naming::gid_type id)
     counter_data_.increment_begin_migration_count();
     using hpx::util::get;
 
-    std::unique_lock<mutex_type> l(mutex_);
+    partition& p = get_partition(id);
+    std::unique_lock<mutex_type> l = lock_partition(p);
 
-    wait_for_migration_locked(l, id, hpx::throws);
-    resolved_type r = resolve_gid_locked(l, id, hpx::throws);
+    wait_for_migration_locked(p, l, id, hpx::throws);
+    resolved_type r = resolve_gid_locked(p, l, id, hpx::throws);
     if (get<0>(r) == naming::invalid_gid)
     {
         l.unlock();
@@ -261,14 +389,14 @@ primary_namespace::begin_migration(naming::gid_type id)
         return std::make_pair(naming::invalid_id, naming::address());
     }
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it == migrating_objects_.end())
+    migration_table_type::iterator it = p.migrating_objects_.find(id);
+    if (it == p.migrating_objects_.end())
     {
-        std::pair<migration_table_type::iterator, bool> p =
-            migrating_objects_.emplace(std::piecewise_construct,
+        std::pair<migration_table_type::iterator, bool> result =
+            p.migrating_objects_.emplace(std::piecewise_construct,
                 std::forward_as_tuple(id), std::forward_as_tuple());
-        HPX_ASSERT(p.second);
-        it = p.first;
+        HPX_ASSERT(result.second);
+        it = result.first;
     }
     else
     {
@@ -293,12 +421,13 @@ bool primary_namespace::end_migration(naming::gid_type const& id)
     );
     counter_data_.increment_end_migration_count();
 
-    std::unique_lock<mutex_type> l(mutex_);
+    partition& p = get_partition(id);
+    std::unique_lock<mutex_type> l = lock_partition(p);
 
     using hpx::util::get;
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it != migrating_objects_.end())
+    migration_table_type::iterator it = p.migrating_objects_.find(id);
+    if (it != p.migrating_objects_.end())
     {
         // flag this id as not being migrated anymore
         get<0>(it->second) = false;
@@ -308,7 +437,7 @@ bool primary_namespace::end_migration(naming::gid_type const& id)
         }
         else
         {
-            migrating_objects_.erase(it);
+            p.migrating_objects_.erase(it);
         }
     }
 
@@ -316,15 +445,15 @@ bool primary_namespace::end_migration(naming::gid_type const& id)
 }
 
 // wait if given object is currently being migrated
-void primary_namespace::wait_for_migration_locked(
+void primary_namespace::wait_for_migration_locked(partition& p,
     std::unique_lock<mutex_type>& l, naming::gid_type const& id, error_code& ec)
 {
     HPX_ASSERT_OWNS_LOCK(l);
 
     using hpx::util::get;
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it != migrating_objects_.end())
+    migration_table_type::iterator it = p.migrating_objects_.find(id);
+    if (it != p.migrating_objects_.end())
     {
         if (get<0>(it->second))
         {
@@ -333,13 +462,13 @@ void primary_namespace::wait_for_migration_locked(
             get<2>(it->second).wait(l, ec);
 
             if (--get<1>(it->second) == 0)
-                migrating_objects_.erase(it);
+                p.migrating_objects_.erase(it);
         }
         else
         {
             if (get<1>(it->second) == 0)
             {
-                migrating_objects_.erase(it);
+                p.migrating_objects_.erase(it);
             }
         }
     }
@@ -361,13 +490,24 @@ bool primary_namespace::bind_gid(
     naming::gid_type gid = id;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    partition& p = get_partition(id);
+    std::unique_lock<mutex_type> l = lock_partition(p);
+
+    // The table holding the bindings which cross partition blocks has to be
+    // consulted only if it is not empty or if the new binding belongs there.
+    std::unique_lock<mutex_type> sl(spanning_mutex_, std::defer_lock);
+    if (num_spanning_gvas_ != 0 || is_spanning(id, g.count))
+        sl.lock();
 
-    gva_table_type::iterator it = gvas_.lower_bound(id)
-                           , begin = gvas_.begin()
-                           , end = gvas_.end();
+    gva_table_type* table = &p.gvas_;
+    gva_table_type::iterator it = find_binding(p.gvas_, id);
+    if (it == p.gvas_.end() && sl.owns_lock())
+    {
+        table = &spanning_gvas_;
+        it = find_binding(spanning_gvas_, id);
+    }
 
-    if (it != end)
+    if (it != table->end())
     {
         // If we got an exact match, this is a request to update an existing
         // binding (e.g. move semantics).
@@ -377,7 +517,7 @@ bool primary_namespace::bind_gid(
             if (naming::refers_to_local_lva(gid) &&
                 !naming::refers_to_virtual_memory(gid))
             {
-                l.unlock();
+                unlock_all(l, sl);
 
                 HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
                     "cannot rebind gids for non-migratable objects");
@@ -393,7 +533,7 @@ bool primary_namespace::bind_gid(
             if (HPX_UNLIKELY(gaddr.count != g.count))
             {
                 // REVIEW: Is this the right error code to use?
-                l.unlock();
+                unlock_all(l, sl);
 
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
@@ -402,7 +542,7 @@ bool primary_namespace::bind_gid(
 
             if (HPX_UNLIKELY(components::component_invalid == g.type))
             {
-                l.unlock();
+                unlock_all(l, sl);
 
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
@@ -414,7 +554,7 @@ bool primary_namespace::bind_gid(
 
             if (HPX_UNLIKELY(!locality))
             {
-                l.unlock();
+                unlock_all(l, sl);
 
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
@@ -431,7 +571,7 @@ bool primary_namespace::bind_gid(
             gaddr.offset = g.offset;
             loc = locality;
 
-            l.unlock();
+            unlock_all(l, sl);
 
             LAGAS_(info) << hpx::util::format(
                 "primary_namespace::bind_gid, gid({1}), gva({2}), "
@@ -441,45 +581,21 @@ bool primary_namespace::bind_gid(
             return false;
         }
 
-        // We're about to decrement the iterator it - first, we
-        // check that it's safe to do this.
-        else if (it != begin)
-        {
-            --it;
-
-            // Check that a previous range doesn't cover the new id.
-            if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
-            {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
-
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , "the new GID is contained in an existing range");
-            }
-        }
-    }
-
-    else if (HPX_LIKELY(!gvas_.empty()))
-    {
-        --it;
-
-        // Check that a previous range doesn't cover the new id.
-        if ((it->first + it->second.first.count) > id)
-        {
-            // REVIEW: Is this the right error code to use?
-            l.unlock();
+        // A previous range covers the new id.
+        // REVIEW: Is this the right error code to use?
+        unlock_all(l, sl);
 
-            HPX_THROW_EXCEPTION(bad_parameter
-              , "primary_namespace::bind_gid"
-              , "the new GID is contained in an existing range");
-        }
+        HPX_THROW_EXCEPTION(bad_parameter
+          , "primary_namespace::bind_gid"
+          , "the new GID is contained in an existing range");
     }
 
     // non-migratable gids don't need to be bound
     if (naming::refers_to_local_lva(gid) &&
         !naming::refers_to_virtual_memory(gid))
     {
+        unlock_all(l, sl);
+
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
             gid, g, locality);
@@ -491,7 +607,7 @@ bool primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
     {
-        l.unlock();
+        unlock_all(l, sl);
 
         HPX_THROW_EXCEPTION(internal_server_error
           , "primary_namespace::bind_gid"
@@ -500,7 +616,7 @@ bool primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(components::component_invalid == g.type))
     {
-        l.unlock();
+        unlock_all(l, sl);
 
         HPX_THROW_EXCEPTION(bad_parameter
           , "primary_namespace::bind_gid"
@@ -511,10 +627,11 @@ bool primary_namespace::bind_gid(
     }
 
     // Insert a GID -> GVA entry into the GVA table.
-    if (HPX_UNLIKELY(!util::insert_checked(gvas_.insert(
+    table = is_spanning(id, g.count) ? &spanning_gvas_ : &p.gvas_;
+    if (HPX_UNLIKELY(!util::insert_checked(table->insert(
             std::make_pair(id, std::make_pair(g, locality))))))
     {
-        l.unlock();
+        unlock_all(l, sl);
 
         HPX_THROW_EXCEPTION(lock_error
           , "primary_namespace::bind_gid"
@@ -524,7 +641,10 @@ bool primary_namespace::bind_gid(
                 id, g, locality));
     }
 
-    l.unlock();
+    if (table == &spanning_gvas_)
+        ++num_spanning_gvas_;
+
+    unlock_all(l, sl);
 
     LAGAS_(info) << hpx::util::format(
         "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
@@ -546,16 +666,17 @@ primary_namespace::resolved_type primary_namespace::resolve_gid(
     resolved_type r;
 
     {
-        std::unique_lock<mutex_type> l(mutex_);
+        partition& p = get_partition(id);
+        std::unique_lock<mutex_type> l = lock_partition(p);
 
         // wait for any migration to be completed
         if (naming::detail::is_migratable(id))
         {
-            wait_for_migration_locked(l, id, hpx::throws);
+            wait_for_migration_locked(p, l, id, hpx::throws);
         }
 
         // now, resolve the id
-        r = resolve_gid_locked(l, id, hpx::throws);
+        r = resolve_gid_locked(p, l, id, hpx::throws);
     }
 
     if (get<0>(r) == naming::invalid_gid)
@@ -592,16 +713,25 @@ naming::address primary_namespace::unbind_gid(
 
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    partition& p = get_partition(id);
+    std::unique_lock<mutex_type> l = lock_partition(p);
 
-    gva_table_type::iterator it = gvas_.find(id)
-                           , end = gvas_.end();
+    gva_table_type* table = &p.gvas_;
+    gva_table_type::iterator it = p.gvas_.find(id);
 
-    if (it != end)
+    std::unique_lock<mutex_type> sl(spanning_mutex_, std::defer_lock);
+    if (it == p.gvas_.end() && num_spanning_gvas_ != 0)
+    {
+        sl.lock();
+        table = &spanning_gvas_;
+        it = spanning_gvas_.find(id);
+    }
+
+    if (it != table->end())
     {
         if (HPX_UNLIKELY(it->second.first.count != count))
         {
-            l.unlock();
+            unlock_all(l, sl);
 
             HPX_THROW_EXCEPTION(bad_parameter
               , "primary_namespace::unbind_gid"
@@ -610,9 +740,11 @@ naming::address primary_namespace::unbind_gid(
 
         gva_table_data_type data = it->second;
 
-        gvas_.erase(it);
+        table->erase(it);
+        if (table == &spanning_gvas_)
+            --num_spanning_gvas_;
 
-        l.unlock();
+        unlock_all(l, sl);
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), gva({3}), "
             "locality_id({4})",
@@ -622,6 +754,8 @@ naming::address primary_namespace::unbind_gid(
         return naming::address(g.prefix, g.type, g.lva());
     }
 
+    unlock_all(l, sl);
+
     // non-migratable gids are not bound
     if (naming::refers_to_local_lva(id) &&
         !naming::refers_to_virtual_memory(id))
@@ -639,8 +773,6 @@ naming::address primary_namespace::unbind_gid(
         return naming::address(g.prefix, g.type, g.lva());
     }
 
-    l.unlock();
-
     LAGAS_(info) << hpx::util::format(
         "primary_namespace::unbind_gid, gid({1}), count({2}), "
         "response(no_success)",
@@ -697,35 +829,87 @@ std::vector<std::int64_t> primary_namespace::decrement_credit(
     std::vector<int64_t> res_credits;
     res_credits.reserve(requests.size());
 
-    for(auto& req: requests)
+    // Group the requests by partition, this allows to apply all requests
+    // targeting the same partition while acquiring its lock only once.
+    std::array<std::vector<std::size_t>, num_partitions> batches;
+
+    for (std::size_t i = 0; i != requests.size(); ++i)
     {
-        std::int64_t credits = hpx::util::get<0>(req);
-        naming::gid_type lower = hpx::util::get<1>(req);
-        naming::gid_type upper = hpx::util::get<1>(req);
+        std::int64_t credits = hpx::util::get<0>(requests[i]);
+        if (credits >= 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter
+              , "primary_namespace::decrement_credit"
+              , hpx::util::format("invalid credit count of {1}", credits));
+        }
 
-        naming::detail::strip_internal_bits_from_gid(lower);
-        naming::detail::strip_internal_bits_from_gid(upper);
+        batches[get_partition_index(hpx::util::get<1>(requests[i]))]
+            .push_back(i);
+        res_credits.push_back(credits);
+    }
+
+    // A failing request must not prevent the components collected for the
+    // other requests from being freed (their reference count entries are
+    // gone already). Every request is applied and every free list is
+    // processed, the first error is reported afterwards.
+    std::exception_ptr first_error;
+
+    std::vector<free_entry_list_type> free_lists;
+    for (std::size_t i = 0; i != num_partitions; ++i)
+    {
+        std::vector<std::size_t> const& batch = batches[i];
+        if (batch.empty())
+            continue;
 
-        if (lower == upper)
-            ++upper;
+        free_lists.clear();
+        free_lists.resize(batch.size());
 
         // Decrement.
-        if (credits < 0)
         {
-            free_entry_list_type free_list;
-            decrement_sweep(free_list, lower, upper, -credits, hpx::throws);
+            partition& p = partitions_[i];
+            std::unique_lock<mutex_type> l = lock_partition(p);
 
-            free_components_sync(free_list, lower, upper, hpx::throws);
-        }
-        else
+            for (std::size_t j = 0; j != batch.size(); ++j)
+            {
+                auto const& req = requests[batch[j]];
+
+                naming::gid_type lower = hpx::util::get<1>(req);
+                naming::detail::strip_internal_bits_from_gid(lower);
+
+                // a failed sweep releases the lock
+                if (!l.owns_lock())
+                    l.lock();
+
+                error_code ec;
+                decrement_sweep_locked(p, l, free_lists[j], lower, lower + 1,
+                    -hpx::util::get<0>(req), ec);
+                if (ec && !first_error)
+                    first_error = hpx::detail::access_exception(ec);
+            }
+        } // Unlock the mutex.
+
+        for (std::size_t j = 0; j != batch.size(); ++j)
         {
-            HPX_THROW_EXCEPTION(bad_parameter
-              , "primary_namespace::decrement_credit"
-              , hpx::util::format("invalid credit count of {1}", credits));
+            naming::gid_type lower = hpx::util::get<1>(requests[batch[j]]);
+            naming::detail::strip_internal_bits_from_gid(lower);
+
+            // the deleters of the components may throw as well
+            try
+            {
+                free_components_sync(
+                    free_lists[j], lower, lower + 1, hpx::throws);
+            }
+            catch (...)
+            {
+                if (!first_error)
+                    first_error = std::current_exception();
+            }
         }
-        res_credits.push_back(credits);
     }
 
+    if (first_error)
+        std::rethrow_exception(first_error);
+
     return res_credits;
 }
 
@@ -795,7 +979,8 @@ std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
+        refcnt_table_type& refcnts
+      , refcnt_table_type::iterator lower_it
       , refcnt_table_type::iterator upper_it
       , naming::gid_type const& lower
       , naming::gid_type const& upper
@@ -805,7 +990,7 @@ std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
     { // dump_refcnt_matches implementation
         HPX_ASSERT(l.owns_lock());
 
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
+        if (lower_it == refcnts.end() && upper_it == refcnts.end())
             // We got nothing, bail - our caller is probably about to throw.
             return;
 
@@ -837,30 +1022,6 @@ void primary_namespace::increment(
   , error_code& ec
     )
 { // {{{ increment implementation
-    std::unique_lock<mutex_type> l(mutex_);
-
-#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    if (LAGAS_ENABLED(debug))
-    {
-        typedef refcnt_table_type::iterator iterator;
-
-        // Find the mappings that we're about to touch.
-        refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-        refcnt_table_type::iterator upper_it;
-        if (lower != upper)
-        {
-            upper_it = refcnts_.find(upper);
-        }
-        else
-        {
-            upper_it = lower_it;
-            ++upper_it;
-        }
-
-        dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-            "primary_namespace::increment");
-    }
-#endif
 
     // TODO: Whine loudly if a reference count overflows. We reserve ~0 for
     // internal bookkeeping in the decrement algorithm, so the maximum global
@@ -872,39 +1033,63 @@ void primary_namespace::increment(
     // allocate/bind them, so if a GID is not in the refcnt table, we know that
     // it's global reference count is the initial global reference count.
 
-    for (naming::gid_type raw = lower; raw != upper; ++raw)
+    // The range is processed in runs of ids belonging to the same partition,
+    // locking each partition once per run.
+    naming::gid_type raw = lower;
+    while (raw != upper)
     {
-        refcnt_table_type::iterator it = refcnts_.find(raw);
-        if (it == refcnts_.end())
+        naming::gid_type const last = end_of_run(raw, upper);
+
+        partition& p = get_partition(raw);
+        std::unique_lock<mutex_type> l = lock_partition(p);
+
+#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
+        if (LAGAS_ENABLED(debug))
         {
-            std::int64_t count =
-                std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
+            // Find the mappings that we're about to touch.
+            refcnt_table_type::iterator lower_it = p.refcnts_.find(raw);
+            refcnt_table_type::iterator upper_it = p.refcnts_.find(last);
 
-            std::pair<refcnt_table_type::iterator, bool> p =
-                refcnts_.insert(refcnt_table_type::value_type(raw, count));
-            if (!p.second)
+            dump_refcnt_matches(p.refcnts_, lower_it, upper_it, raw, last, l,
+                "primary_namespace::increment");
+        }
+#endif
+
+        for (/**/; raw != last; ++raw)
+        {
+            refcnt_table_type::iterator it = p.refcnts_.find(raw);
+            if (it == p.refcnts_.end())
             {
-                l.unlock();
+                std::int64_t count =
+                    std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
 
-                HPX_THROWS_IF(ec, invalid_data
-                    , "primary_namespace::increment"
-                    , hpx::util::format(
-                        "couldn't create entry in reference count table, "
-                        "raw({1}), ref-count({2})",
-                        raw, count));
-                return;
+                std::pair<refcnt_table_type::iterator, bool> result =
+                    p.refcnts_.insert(
+                        refcnt_table_type::value_type(raw, count));
+                if (!result.second)
+                {
+                    l.unlock();
+
+                    HPX_THROWS_IF(ec, invalid_data
+                        , "primary_namespace::increment"
+                        , hpx::util::format(
+                            "couldn't create entry in reference count table, "
+                            "raw({1}), ref-count({2})",
+                            raw, count));
+                    return;
+                }
+
+                it = result.first;
+            }
+            else
+            {
+                it->second += credits;
             }
 
-            it = p.first;
-        }
-        else
-        {
-            it->second += credits;
+            LAGAS_(info) << hpx::util::format(
+                "primary_namespace::increment, raw({1}), refcnt({2})",
+                lower, it->second);
         }
-
-        LAGAS_(info) << hpx::util::format(
-            "primary_namespace::increment, raw({1}), refcnt({2})",
-            lower, it->second);
     }
 
     if (&ec != &throws)
@@ -913,7 +1098,8 @@ void primary_namespace::increment(
 
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::resolve_free_list(
-    std::unique_lock<mutex_type>& l
+    partition& p
+  , std::unique_lock<mutex_type>& l
   , std::list<refcnt_table_type::iterator> const& free_list
   , free_entry_list_type& free_entry_list
   , naming::gid_type const& lower
@@ -937,11 +1123,11 @@ void primary_namespace::resolve_free_list(
         if (naming::detail::is_migratable(gid))
         {
             // wait for any migration to be completed
-            wait_for_migration_locked(l, gid, ec);
+            wait_for_migration_locked(p, l, gid, ec);
         }
 
         // Resolve the query GID.
-        resolved_type r = resolve_gid_locked(l, gid, ec);
+        resolved_type r = resolve_gid_locked(p, l, gid, ec);
         if (ec) return;
 
         naming::gid_type& raw = get<0>(r);
@@ -1000,133 +1186,118 @@ void primary_namespace::resolve_free_list(
         free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
 
         // remove this entry from the refcnt table
-        refcnts_.erase(it);
+        p.refcnts_.erase(it);
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void primary_namespace::decrement_sweep(
-    free_entry_list_type& free_entry_list
+void primary_namespace::decrement_sweep_locked(
+    partition& p
+  , std::unique_lock<mutex_type>& l
+  , free_entry_list_type& free_entry_list
   , naming::gid_type const& lower
   , naming::gid_type const& upper
   , std::int64_t credits
   , error_code& ec
     )
-{ // {{{ decrement_sweep implementation
+{ // {{{ decrement_sweep_locked implementation
+    HPX_ASSERT_OWNS_LOCK(l);
+
     LAGAS_(info) << hpx::util::format(
         "primary_namespace::decrement_sweep, lower({1}), upper({2}), "
         "credits({3})",
         lower, upper, credits);
 
-    free_entry_list.clear();
-
-    {
-        std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
-        {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we just added or modified.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
+    if (LAGAS_ENABLED(debug))
+    {
+        // Find the mappings that we just added or modified.
+        refcnt_table_type::iterator lower_it = p.refcnts_.find(lower);
+        refcnt_table_type::iterator upper_it = p.refcnts_.find(upper);
 
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::decrement_sweep");
-        }
+        dump_refcnt_matches(p.refcnts_, lower_it, upper_it, lower, upper, l,
+            "primary_namespace::decrement_sweep");
+    }
 #endif
 
-        ///////////////////////////////////////////////////////////////////////
-        // Apply the decrement across the entire key space (e.g. [lower, upper]).
+    ///////////////////////////////////////////////////////////////////////////
+    // Apply the decrement across the entire key space (e.g. [lower, upper]).
+
+    // The third parameter we pass here is the default data to use in case
+    // the key is not mapped. We don't insert GIDs into the refcnt table
+    // when we allocate/bind them, so if a GID is not in the refcnt table,
+    // we know that it's global reference count is the initial global
+    // reference count.
 
-        // The third parameter we pass here is the default data to use in case
-        // the key is not mapped. We don't insert GIDs into the refcnt table
-        // when we allocate/bind them, so if a GID is not in the refcnt table,
-        // we know that it's global reference count is the initial global
-        // reference count.
+    std::list<refcnt_table_type::iterator> free_list;
+    for (naming::gid_type raw = lower; raw != upper; ++raw)
+    {
+        HPX_ASSERT(&get_partition(raw) == &p);
 
-        std::list<refcnt_table_type::iterator> free_list;
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
+        refcnt_table_type::iterator it = p.refcnts_.find(raw);
+        if (it == p.refcnts_.end())
         {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
             {
-                if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , hpx::util::format(
-                            "negative entry in reference count table, raw({1}), "
-                            "refcount({2})",
-                            raw,
-                            std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits));
-                    return;
-                }
-
-                std::int64_t count =
-                    std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
-
-                std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
-                if (!p.second)
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , hpx::util::format(
-                            "couldn't create entry in reference count table, "
-                            "raw({1}), ref-count({2})",
-                            raw, count));
-                    return;
-                }
+                l.unlock();
 
-                it = p.first;
-            }
-            else
-            {
-                it->second -= credits;
+                HPX_THROWS_IF(ec, invalid_data
+                  , "primary_namespace::decrement_sweep"
+                  , hpx::util::format(
+                        "negative entry in reference count table, raw({1}), "
+                        "refcount({2})",
+                        raw,
+                        std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits));
+                return;
             }
 
-            // Sanity check.
-            if (it->second < 0)
+            std::int64_t count =
+                std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
+
+            std::pair<refcnt_table_type::iterator, bool> result =
+                p.refcnts_.insert(refcnt_table_type::value_type(raw, count));
+            if (!result.second)
             {
                 l.unlock();
 
                 HPX_THROWS_IF(ec, invalid_data
                   , "primary_namespace::decrement_sweep"
                   , hpx::util::format(
-                        "negative entry in reference count table, raw({1}), "
-                        "refcount({2})",
-                        raw, it->second));
+                        "couldn't create entry in reference count table, "
+                        "raw({1}), ref-count({2})",
+                        raw, count));
                 return;
             }
 
-            // this objects needs to be deleted
-            if (it->second == 0)
-                free_list.push_back(it);
+            it = result.first;
+        }
+        else
+        {
+            it->second -= credits;
         }
 
-        // Resolve the objects which have to be deleted.
-        resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+        // Sanity check.
+        if (it->second < 0)
+        {
+            l.unlock();
 
-    } // Unlock the mutex.
+            HPX_THROWS_IF(ec, invalid_data
+              , "primary_namespace::decrement_sweep"
+              , hpx::util::format(
+                    "negative entry in reference count table, raw({1}), "
+                    "refcount({2})",
+                    raw, it->second));
+            return;
+        }
 
-    if (&ec != &throws)
-        ec = make_success_code();
-}
+        // this objects needs to be deleted
+        if (it->second == 0)
+            free_list.push_back(it);
+    }
+
+    // Resolve the objects which have to be deleted.
+    resolve_free_list(p, l, free_list, free_entry_list, lower, upper, ec);
+} // }}}
 
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::free_components_sync(
@@ -1190,7 +1361,8 @@ void primary_namespace::free_components_sync(
 } // }}}
 
 primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
-    std::unique_lock<mutex_type>& l
+    partition& p
+  , std::unique_lock<mutex_type>& l
   , naming::gid_type const& gid
   , error_code& ec
     )
@@ -1212,81 +1384,41 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
     naming::gid_type id = gid;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    gva_table_type::const_iterator it = gvas_.lower_bound(id)
-                                 , begin = gvas_.begin()
-                                 , end = gvas_.end();
+    // look for a binding in the partition first, then for a binding which
+    // crosses partition blocks
+    naming::gid_type base;
+    gva_table_data_type data;
 
-    if (it != end)
+    gva_table_type::const_iterator it = find_binding(p.gvas_, id);
+    if (it != p.gvas_.end())
     {
-        // Check for exact match
-        if (it->first == id)
-        {
-            if (&ec != &throws)
-                ec = make_success_code();
-
-            gva_table_data_type const& data = it->second;
-            return resolved_type(it->first, data.first, data.second);
-        }
-
-        // We need to decrement the iterator, first we check that it's safe
-        // to do this.
-        else if (it != begin)
-        {
-            --it;
-
-            // Found the GID in a range
-            gva_table_data_type const& data = it->second;
-            if ((it->first + data.first.count) > id)
-            {
-                if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, internal_server_error
-                      , "primary_namespace::resolve_gid_locked"
-                      , "MSBs of lower and upper range bound do not match");
-                    return resolved_type(naming::invalid_gid, gva(),
-                        naming::invalid_gid);
-                }
-
-                if (&ec != &throws)
-                    ec = make_success_code();
-
-                return resolved_type(it->first, data.first, data.second);
-            }
-        }
+        base = it->first;
+        data = it->second;
     }
-
-    else if (HPX_LIKELY(!gvas_.empty()))
+    else if (!resolve_spanning_gid(id, base, data))
     {
-        --it;
-
-        // Found the GID in a range
-        gva_table_data_type const& data = it->second;
-        if ((it->first + data.first.count) > id)
-        {
-            if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-            {
-                l.unlock();
+        if (&ec != &throws)
+            ec = make_success_code();
 
-                HPX_THROWS_IF(ec, internal_server_error
-                  , "primary_namespace::resolve_gid_locked"
-                  , "MSBs of lower and upper range bound do not match");
-                return resolved_type(naming::invalid_gid, gva(),
-                    naming::invalid_gid);
-            }
+        return resolved_type(naming::invalid_gid, gva(), naming::invalid_gid);
+    }
 
-            if (&ec != &throws)
-                ec = make_success_code();
+    // Found the GID in a range
+    if (HPX_UNLIKELY(id.get_msb() != base.get_msb()))
+    {
+        l.unlock();
 
-            return resolved_type(it->first, data.first, data.second);
-        }
+        HPX_THROWS_IF(ec, internal_server_error
+          , "primary_namespace::resolve_gid_locked"
+          , "MSBs of lower and upper range bound do not match");
+        return resolved_type(naming::invalid_gid, gva(),
+            naming::invalid_gid);
     }
 
     if (&ec != &throws)
         ec = make_success_code();
 
-    return resolved_type(naming::invalid_gid, gva(), naming::invalid_gid);
+    return resolved_type(base, data.first, data.second);
 } // }}}
 
 naming::gid_type primary_namespace::statistics_counter(std::string const& name)
@@ -1330,7 +1462,25 @@ naming::gid_type primary_namespace::statistics_counter(std::string const& name)
     typedef primary_namespace::counter_data cd;
 
     util::function_nonser<std::int64_t(bool)> get_data_func;
-    if (target == detail::counter_target_count)
+    if (target == detail::counter_target_contention)
+    {
+        std::size_t partition = num_partitions;
+        if (!p.parameters_.empty())
+        {
+            partition = util::from_string<std::size_t>(
+                p.parameters_, std::size_t(num_partitions));
+            if (partition >= num_partitions)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter
+                  , "primary_namespace::statistics"
+                  , hpx::util::format("invalid partition index: {1}",
+                        p.parameters_));
+            }
+        }
+        get_data_func = util::bind_front(
+            &primary_namespace::get_contention_count, this, partition);
+    }
+    else if (target == detail::counter_target_count)
     {
         switch (code) {
         case primary_ns_route:
@@ -60,17 +60,18 @@ namespace hpx { namespace agas { namespace server
         // resolve destination addresses, we should be able to resolve all of
         // them, otherwise it's an error
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            partition& part = get_partition(gid);
+            std::unique_lock<mutex_type> l = lock_partition(part);
 
             error_code& ec = throws;
 
             // wait for any migration to be completed
             if (naming::detail::is_migratable(gid))
             {
-                wait_for_migration_locked(l, gid, ec);
+                wait_for_migration_locked(part, l, gid, ec);
             }
 
-            cache_address = resolve_gid_locked(l, gid, ec);
+            cache_address = resolve_gid_locked(part, l, gid, ec);
 
             if (ec || hpx::util::get<0>(cache_address) == naming::invalid_gid)
             {
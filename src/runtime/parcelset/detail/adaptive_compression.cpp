@@ -0,0 +1,154 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/runtime/parcelset/detail/adaptive_compression.hpp>
+#include <hpx/runtime_fwd.hpp>
+#include <hpx/serialization/binary_filter.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    namespace
+    {
+        // exponential moving average, the first sample initializes it
+        double moving_average(double average, double value, std::size_t count)
+        {
+            if (count == 0)
+                return value;
+            return 0.75 * average + 0.25 * value;
+        }
+    }
+
+    adaptive_compression::adaptive_compression(std::string const& filter_type,
+            std::size_t min_size, std::size_t sample_interval)
+      : filter_type_(filter_type)
+      , min_size_(min_size)
+      , sample_interval_(sample_interval)
+      , num_compressed_messages_(0)
+      , bytes_saved_(0)
+      , compression_time_(0)
+    {
+    }
+
+    bool adaptive_compression::should_compress(
+        destination_data& data, double link_throughput) const
+    {
+        // measure the compression ratio before anything else
+        if (data.compressed_samples_ == 0)
+            return true;
+
+        // compress if the time saved by sending fewer bytes outweighs the
+        // additional time needed for encoding (both per raw byte)
+        bool compress = false;
+        if (link_throughput > 0.0)
+        {
+            double const saved_time = (1.0 - data.ratio_) / link_throughput;
+            double const extra_time =
+                data.compressed_cost_ - data.uncompressed_cost_;
+            compress = saved_time > extra_time;
+        }
+
+        // periodically take the other path to keep the measurements current
+        if (sample_interval_ != 0 &&
+            ++data.eligible_messages_ % sample_interval_ == 0)
+        {
+            return !compress;
+        }
+        return compress;
+    }
+
+    serialization::binary_filter* adaptive_compression::create_filter(
+        std::uint32_t locality_id, std::size_t size, double link_throughput)
+    {
+        if (!is_eligible(size))
+            return nullptr;
+
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (!should_compress(destinations_[locality_id], link_throughput))
+                return nullptr;
+        }
+
+        error_code ec(lightweight);
+        serialization::binary_filter* filter =
+            hpx::create_binary_filter(filter_type_.c_str(), true, nullptr, ec);
+        if (ec)
+        {
+            LPT_(warning) << "adaptive_compression: could not create binary "
+                             "filter of type: " << filter_type_;
+            return nullptr;
+        }
+        return filter;
+    }
+
+    void adaptive_compression::add_sample(std::uint32_t locality_id,
+        bool compressed, std::size_t raw_bytes, std::size_t bytes,
+        std::int64_t time)
+    {
+        if (!enabled() || raw_bytes == 0)
+            return;
+
+        if (compressed)
+        {
+            ++num_compressed_messages_;
+            bytes_saved_ += static_cast<std::int64_t>(raw_bytes) -
+                static_cast<std::int64_t>(bytes);
+            compression_time_ += time;
+        }
+
+        double const cost =
+            static_cast<double>(time) / static_cast<double>(raw_bytes);
+
+        std::lock_guard<mutex_type> l(mtx_);
+        destination_data& data = destinations_[locality_id];
+        if (compressed)
+        {
+            double const ratio =
+                static_cast<double>(bytes) / static_cast<double>(raw_bytes);
+            data.ratio_ =
+                moving_average(data.ratio_, ratio, data.compressed_samples_);
+            data.compressed_cost_ = moving_average(
+                data.compressed_cost_, cost, data.compressed_samples_);
+            ++data.compressed_samples_;
+        }
+        else
+        {
+            data.uncompressed_cost_ = moving_average(
+                data.uncompressed_cost_, cost, data.uncompressed_samples_);
+            ++data.uncompressed_samples_;
+        }
+    }
+
+    // number of messages compressed
+    std::int64_t adaptive_compression::num_compressed_messages(bool reset)
+    {
+        return util::get_and_reset_value(num_compressed_messages_, reset);
+    }
+
+    // number of bytes saved by compressing messages
+    std::int64_t adaptive_compression::total_bytes_saved(bool reset)
+    {
+        return util::get_and_reset_value(bytes_saved_, reset);
+    }
+
+    // the total time spent encoding compressed messages (nanoseconds)
+    std::int64_t adaptive_compression::total_compression_time(bool reset)
+    {
+        return util::get_and_reset_value(compression_time_, reset);
+    }
+}}}
+
+#endif
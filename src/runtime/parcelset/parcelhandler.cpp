@@ -910,6 +910,27 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_receiving_time(reset) : 0;
     }
 
+    // the distribution of the times of the individual sends and receives
+    // (nanoseconds)
+    void parcelhandler::get_sending_time_histogram(std::string const& pp_type,
+        util::log_histogram& result, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        if (pp)
+            pp->get_sending_time_histogram(result, reset);
+    }
+
+    void parcelhandler::get_receiving_time_histogram(
+        std::string const& pp_type, util::log_histogram& result,
+        bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        if (pp)
+            pp->get_receiving_time_histogram(result, reset);
+    }
+
     // the total time it took for all sender-side serialization operations
     // (nanoseconds)
     std::int64_t parcelhandler::get_sending_serialization_time(
@@ -981,6 +1002,34 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_buffer_allocate_time_received(reset) : 0;
     }
 
+    // number of messages compressed by the adaptive compression
+    std::int64_t parcelhandler::get_compressed_message_count(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compressed_message_count(reset) : 0;
+    }
+
+    // number of bytes saved by the adaptive compression
+    std::int64_t parcelhandler::get_compression_bytes_saved(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compression_bytes_saved(reset) : 0;
+    }
+
+    // the total time spent encoding messages chosen for compression
+    // (nanoseconds)
+    std::int64_t parcelhandler::get_compression_time(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compression_time(reset) : 0;
+    }
+
     // connection stack statistics
     std::int64_t parcelhandler::get_connection_cache_statistics(
         std::string const& pp_type,
@@ -991,6 +1040,16 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // message buffer pool statistics
+    std::int64_t parcelhandler::get_buffer_pool_statistics(
+        std::string const& pp_type,
+        parcelport::buffer_pool_statistics_type stat_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_buffer_pool_statistics(stat_type, reset) : 0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
     // number of parcels sent
@@ -1058,6 +1117,7 @@ namespace hpx { namespace parcelset
         {
             register_counter_types(pp.second->type());
             register_connection_cache_counter_types(pp.second->type());
+            register_buffer_pool_counter_types(pp.second->type());
         }
 
         using util::placeholders::_1;
@@ -1151,6 +1211,13 @@ namespace hpx { namespace parcelset
             util::bind_front(&parcelhandler::get_receiving_time, this,
                 pp_type));
 
+        util::function_nonser<void(util::log_histogram&, bool)>
+            sending_time_histogram(util::bind_front(
+                &parcelhandler::get_sending_time_histogram, this, pp_type));
+        util::function_nonser<void(util::log_histogram&, bool)>
+            receiving_time_histogram(util::bind_front(
+                &parcelhandler::get_receiving_time_histogram, this, pp_type));
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         util::function_nonser<std::int64_t(std::string const&, bool)>
             sending_serialization_time(util::bind_front(
@@ -1203,6 +1270,16 @@ namespace hpx { namespace parcelset
             util::bind_front(&parcelhandler::get_buffer_allocate_time_received, this,
                 pp_type));
 
+        util::function_nonser<std::int64_t(bool)> compressed_messages(
+            util::bind_front(&parcelhandler::get_compressed_message_count,
+                this, pp_type));
+        util::function_nonser<std::int64_t(bool)> compression_bytes_saved(
+            util::bind_front(&parcelhandler::get_compression_bytes_saved,
+                this, pp_type));
+        util::function_nonser<std::int64_t(bool)> compression_time(
+            util::bind_front(&parcelhandler::get_compression_time, this,
+                pp_type));
+
         performance_counters::generic_counter_type_data const counter_types[] =
         {
             { hpx::util::format("/parcels/count/{}/sent", pp_type),
@@ -1292,6 +1369,34 @@ namespace hpx { namespace parcelset
               &performance_counters::locality_counter_discoverer,
               "ns"
             },
+            { hpx::util::format("/data/time/{}/sent-percentile", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the given percentile (counter parameter, default: "
+                  "99) of the time between the start of an asynchronous write "
+                  "and the invocation of its write callback using the {} "
+                  "connection type for the referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::
+                      locality_raw_percentile_counter_creator,
+                  _1, std::move(sending_time_histogram), _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
+            { hpx::util::format("/data/time/{}/received-percentile", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the given percentile (counter parameter, default: "
+                  "99) of the time between the start of an asynchronous read "
+                  "and the invocation of its read callback using the {} "
+                  "connection type for the referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::
+                      locality_raw_percentile_counter_creator,
+                  _1, std::move(receiving_time_histogram), _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
             { hpx::util::format("/serialize/time/{}/sent", pp_type),
               performance_counters::counter_elapsed_time,
               hpx::util::format(
@@ -1423,6 +1528,43 @@ namespace hpx { namespace parcelset
               &performance_counters::locality_counter_discoverer,
               "ns"
             },
+            { hpx::util::format(
+                "/compression/count/{}/messages", pp_type),
+              performance_counters::counter_monotonically_increasing,
+              hpx::util::format(
+                  "returns the number of messages the adaptive compression "
+                  "decided to compress using the {} connection type", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(compressed_messages), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                "/compression/count/{}/saved", pp_type),
+              performance_counters::counter_monotonically_increasing,
+              hpx::util::format(
+                  "returns the number of bytes saved by the adaptive "
+                  "compression using the {} connection type", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(compression_bytes_saved), _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes"
+            },
+            { hpx::util::format(
+                "/compression/time/{}/encoding", pp_type),
+              performance_counters::counter_elapsed_time,
+              hpx::util::format(
+                  "returns the total time needed to serialize the messages "
+                  "the adaptive compression decided to compress using the "
+                  "{} connection type", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(compression_time), _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
         };
         performance_counters::install_counter_types(
             counter_types, sizeof(counter_types)/sizeof(counter_types[0]));
@@ -1531,6 +1673,76 @@ namespace hpx { namespace parcelset
 #endif
     }
 
+    // register connection specific performance counters related to the pool
+    // of message buffers
+    void parcelhandler::register_buffer_pool_counter_types(
+        std::string const& pp_type)
+    {
+#if defined(HPX_HAVE_NETWORKING)
+        if (!is_networking_enabled_)
+            return;
+
+        using hpx::util::placeholders::_1;
+        using hpx::util::placeholders::_2;
+
+        util::function_nonser<std::int64_t(bool)> pool_hits(
+            util::bind_front(&parcelhandler::get_buffer_pool_statistics,
+                this, pp_type, parcelport::buffer_pool_hits));
+        util::function_nonser<std::int64_t(bool)> pool_misses(
+            util::bind_front(&parcelhandler::get_buffer_pool_statistics,
+                this, pp_type, parcelport::buffer_pool_misses));
+        util::function_nonser<std::int64_t(bool)> pool_retained_bytes(
+            util::bind_front(&parcelhandler::get_buffer_pool_statistics,
+                this, pp_type, parcelport::buffer_pool_retained_bytes));
+
+        performance_counters::generic_counter_type_data const
+            buffer_pool_types[] =
+        {
+            { hpx::util::format(
+                  "/parcelport/count/{}/buffer-pool-hits", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of message buffer allocations served "
+                  "from the buffer pool for the {} connection type on the "
+                  "referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(pool_hits), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/buffer-pool-misses", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of message buffer allocations not "
+                  "served from the buffer pool for the {} connection type on "
+                  "the referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(pool_misses), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/buffer-pool-retained", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the amount of memory currently held by the buffer "
+                  "pool for the {} connection type on the referenced "
+                  "locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(pool_retained_bytes), _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes"
+            }
+        };
+        performance_counters::install_counter_types(buffer_pool_types,
+            sizeof(buffer_pool_types)/sizeof(buffer_pool_types[0]));
+#endif
+    }
+
     std::vector<plugins::parcelport_factory_base *> &
     parcelhandler::get_parcelport_factories()
     {
@@ -1615,6 +1827,11 @@ namespace hpx { namespace parcelset
             "$[hpx.parcel.array_optimization]}");
         ini_defs.push_back(
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}");
+        ini_defs.push_back("compression = ${HPX_PARCEL_COMPRESSION:}");
+        ini_defs.push_back(
+            "compression_min_size = ${HPX_PARCEL_COMPRESSION_MIN_SIZE:4096}");
+        ini_defs.push_back("compression_sample_interval = "
+                           "${HPX_PARCEL_COMPRESSION_SAMPLE_INTERVAL:32}");
 #if defined(HPX_HAVE_PARCEL_COALESCING)
         ini_defs.push_back(
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}");
@@ -44,7 +44,12 @@ namespace hpx { namespace parcelset
         async_serialization_(false),
         priority_(hpx::util::get_entry_as<int>(ini,
             "hpx.parcel." + type + ".priority", 0)),
-        type_(type)
+        type_(type),
+        adaptive_compression_(ini.get_entry("hpx.parcel.compression", ""),
+            hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.compression_min_size", 4096),
+            hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.compression_sample_interval", 32))
     {
         std::string key("hpx.parcel.");
         key += type;
@@ -138,6 +143,20 @@ namespace hpx { namespace parcelset
         return parcels_received_.total_time(reset);
     }
 
+    // the distribution of the times of the individual sends and receives
+    // (nanoseconds)
+    void parcelport::get_sending_time_histogram(
+        util::log_histogram& result, bool reset)
+    {
+        parcels_sent_.time_histogram(result, reset);
+    }
+
+    void parcelport::get_receiving_time_histogram(
+        util::log_histogram& result, bool reset)
+    {
+        parcels_received_.time_histogram(result, reset);
+    }
+
     // the total time it took for all sender-side serialization operations
     // (nanoseconds)
     std::int64_t parcelport::get_sending_serialization_time(bool reset)
@@ -186,6 +205,35 @@ namespace hpx { namespace parcelset
         return parcels_received_.total_buffer_allocate_time(reset);
     }
 
+    // number of messages compressed by the adaptive compression
+    std::int64_t parcelport::get_compressed_message_count(bool reset)
+    {
+        return adaptive_compression_.num_compressed_messages(reset);
+    }
+
+    // number of bytes saved by the adaptive compression
+    std::int64_t parcelport::get_compression_bytes_saved(bool reset)
+    {
+        return adaptive_compression_.total_bytes_saved(reset);
+    }
+
+    // the total time spent encoding messages chosen for compression
+    // (nanoseconds)
+    std::int64_t parcelport::get_compression_time(bool reset)
+    {
+        return adaptive_compression_.total_compression_time(reset);
+    }
+
+    // the throughput observed for all sends so far (bytes per nanosecond)
+    double parcelport::get_link_throughput()
+    {
+        std::int64_t const time = parcels_sent_.total_time(false);
+        if (time <= 0)
+            return 0.0;
+        return static_cast<double>(parcels_sent_.total_bytes(false)) /
+            static_cast<double>(time);
+    }
+
     std::int64_t parcelport::get_pending_parcels_count(bool /*reset*/)
     {
         std::lock_guard<lcos::local::spinlock> l(mtx_);
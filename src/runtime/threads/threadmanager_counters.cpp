@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
@@ -20,6 +21,11 @@
 #include <hpx/modules/threadmanager.hpp>
 #include <hpx/runtime/threads/threadmanager_counters.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
+#include <hpx/statistics/log_histogram.hpp>
+
+#if !defined(HPX_WINDOWS)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
 
 #include <cstddef>
 #include <cstdint>
@@ -42,6 +48,21 @@ namespace hpx { namespace threads {
 
             return gid;
         }
+
+        naming::gid_type queue_wait_time_percentile_counter_creator(
+            threadmanager* tm, threadmanager_histogram_func total_func,
+            threadpool_histogram_func pool_func,
+            performance_counters::counter_info const& info, error_code& ec)
+        {
+            naming::gid_type gid =
+                locality_pool_thread_percentile_counter_creator(
+                    tm, total_func, pool_func, info, ec);
+
+            if (!ec)
+                policies::set_maintain_queue_wait_times_enabled(true);
+
+            return gid;
+        }
 #endif
 
         naming::gid_type locality_pool_thread_counter_creator(threadmanager* tm,
@@ -108,6 +129,75 @@ namespace hpx { namespace threads {
             return naming::invalid_gid;
         }
 
+        // locality/pool/worker-thread counter creation function for counters
+        // reporting a percentile of a distribution, the percentile is passed
+        // as the counter parameter, e.g.
+        // /threads{locality#0/total}/time/phase-percentile@99.9
+        naming::gid_type locality_pool_thread_percentile_counter_creator(
+            threadmanager* tm, threadmanager_histogram_func total_func,
+            threadpool_histogram_func pool_func,
+            performance_counters::counter_info const& info, error_code& ec)
+        {
+            // verify the validity of the counter instance name
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "locality_pool_thread_percentile_counter_creator",
+                    "invalid counter instance parent name: " +
+                        paths.parentinstancename_);
+                return naming::invalid_gid;
+            }
+
+            using performance_counters::detail::create_raw_percentile_counter;
+
+            thread_pool_base& pool = tm->default_pool();
+            if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+            {
+                // overall counter
+                util::function_nonser<void(util::log_histogram&, bool)> f =
+                    util::bind_front(total_func, tm);
+                return create_raw_percentile_counter(info, std::move(f), ec);
+            }
+            else if (paths.instancename_ == "pool")
+            {
+                if (paths.instanceindex_ >= 0 &&
+                    std::size_t(paths.instanceindex_) <
+                        hpx::resource::get_num_thread_pools())
+                {
+                    // specific for given pool counter
+                    thread_pool_base& pool_instance =
+                        hpx::resource::get_thread_pool(paths.instanceindex_);
+
+                    util::function_nonser<void(util::log_histogram&, bool)> f =
+                        util::bind_front(pool_func, &pool_instance,
+                            static_cast<std::size_t>(paths.subinstanceindex_));
+                    return create_raw_percentile_counter(
+                        info, std::move(f), ec);
+                }
+            }
+            else if (paths.instancename_ == "worker-thread" &&
+                paths.instanceindex_ >= 0 &&
+                std::size_t(paths.instanceindex_) < pool.get_os_thread_count())
+            {
+                // specific counter from default
+                util::function_nonser<void(util::log_histogram&, bool)> f =
+                    util::bind_front(pool_func, &pool,
+                        static_cast<std::size_t>(paths.instanceindex_));
+                return create_raw_percentile_counter(info, std::move(f), ec);
+            }
+
+            HPX_THROWS_IF(ec, bad_parameter,
+                "locality_pool_thread_percentile_counter_creator",
+                "invalid counter instance name: " + paths.instancename_);
+            return naming::invalid_gid;
+        }
+
         // scheduler utilization counter creation function
         naming::gid_type scheduler_utilization_counter_creator(
             threadmanager* tm, performance_counters::counter_info const& info,
@@ -457,6 +547,31 @@ namespace hpx { namespace threads {
                     &thread_pool_base::get_average_task_wait_time),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 "ns"},
+            // percentiles of the thread and task wait time for queue(s)
+            {"/threads/wait-time/pending-percentile",
+                performance_counters::counter_raw,
+                "returns the given percentile (counter parameter, default: "
+                "99) of the wait time of pending threads for the referenced "
+                "queue",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::queue_wait_time_percentile_counter_creator, &tm,
+                    &threadmanager::get_thread_wait_time_histogram,
+                    &thread_pool_base::get_thread_wait_time_histogram),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
+            {"/threads/wait-time/staged-percentile",
+                performance_counters::counter_raw,
+                "returns the given percentile (counter parameter, default: "
+                "99) of the wait time of staged threads (task descriptions) "
+                "for the referenced queue",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::queue_wait_time_percentile_counter_creator, &tm,
+                    &threadmanager::get_task_wait_time_histogram,
+                    &thread_pool_base::get_task_wait_time_histogram),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
 #endif
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
             // idle rate
@@ -532,6 +647,17 @@ namespace hpx { namespace threads {
                     &thread_pool_base::get_thread_phase_duration),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 "ns"},
+            {"/threads/time/phase-percentile",
+                performance_counters::counter_raw,
+                "returns the given percentile (counter parameter, default: "
+                "99) of the time spent executing one HPX-thread phase",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_pool_thread_percentile_counter_creator,
+                    &tm, &threadmanager::get_thread_phase_duration_histogram,
+                    &thread_pool_base::get_thread_phase_duration_histogram),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
             {"/threads/time/average-overhead",
                 performance_counters::counter_average_timer,
                 "returns average overhead time executing one HPX-thread",
@@ -727,6 +853,32 @@ namespace hpx { namespace threads {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &detail::locality_allocator_counter_discoverer, ""},
 #endif
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+            {   "/threads/memory/stacks/reserved",
+                performance_counters::counter_raw,
+                "returns the amount of address space reserved for HPX-thread "
+                "stacks by the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&performance_counters::locality_raw_counter_creator,
+                    util::placeholders::_1,
+                    util::function_nonser<std::int64_t(bool)>(
+                        &coroutines::detail::posix::get_stack_pool_reserved_memory),
+                    util::placeholders::_2),
+                &performance_counters::locality_counter_discoverer, "bytes"},
+            {   "/threads/memory/stacks/resident",
+                performance_counters::counter_raw,
+                "returns the amount of physical memory currently used by the "
+                "HPX-thread stacks managed by the stack pool for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&performance_counters::locality_raw_counter_creator,
+                    util::placeholders::_1,
+                    util::function_nonser<std::int64_t(bool)>(
+                        &coroutines::detail::posix::get_stack_pool_resident_memory),
+                    util::placeholders::_2),
+                &performance_counters::locality_counter_discoverer, "bytes"},
+#endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {   "/threads/count/pending-misses",
                 performance_counters::counter_monotonically_increasing,
@@ -824,7 +976,92 @@ namespace hpx { namespace threads {
                     &thread_pool_base::get_busy_loop_count),
                 &performance_counters::
                     locality_pool_thread_no_total_counter_discoverer,
-                ""}
+                ""},
+            // idle backoff
+            {   "/threads/count/idle-parked",
+                performance_counters::counter_monotonically_increasing,
+                "returns the overall number of times worker threads were "
+                "parked because no work was available for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_idle_park_count,
+                    &thread_pool_base::get_idle_park_count),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {   "/threads/count/idle-unparked",
+                performance_counters::counter_monotonically_increasing,
+                "returns the overall number of times parked worker threads "
+                "were woken up because new work was available for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_idle_unpark_count,
+                    &thread_pool_base::get_idle_unpark_count),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {   "/threads/time/idle-wake-latency",
+                performance_counters::counter_average_timer,
+                "returns the average time between waking up a parked worker "
+                "thread and the worker thread resuming its scheduling loop "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_idle_wake_latency,
+                    &thread_pool_base::get_idle_wake_latency),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
+            // timers
+            {   "/threads/count/timers-armed",
+                performance_counters::counter_monotonically_increasing,
+                "returns the overall number of timers armed by suspended "
+                "threads or timed executors for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_timers_armed_count,
+                    &thread_pool_base::get_timers_armed_count),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {   "/threads/count/timers-fired",
+                performance_counters::counter_monotonically_increasing,
+                "returns the overall number of expired timers fired by the "
+                "worker threads for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_timers_fired_count,
+                    &thread_pool_base::get_timers_fired_count),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {   "/threads/count/timers-cancelled",
+                performance_counters::counter_monotonically_increasing,
+                "returns the overall number of timers cancelled before "
+                "they expired for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_timers_cancelled_count,
+                    &thread_pool_base::get_timers_cancelled_count),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {   "/threads/time/timer-lateness",
+                performance_counters::counter_average_timer,
+                "returns the average time between the deadline of a timer "
+                "and the timer being fired for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_timer_lateness,
+                    &thread_pool_base::get_timer_lateness),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
+            {   "/threads/time/timer-overhead",
+                performance_counters::counter_average_timer,
+                "returns the average time spent advancing the timer wheels "
+                "per fired timer for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_timer_overhead,
+                    &thread_pool_base::get_timer_overhead),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"}
         };
         performance_counters::install_counter_types(
             counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
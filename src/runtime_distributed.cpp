@@ -7,6 +7,7 @@
 
 #include <hpx/config.hpp>
 
+#include <hpx/allocator_support/numa_slab_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/applier/applier.hpp>
@@ -1344,6 +1345,58 @@ namespace hpx {
         performance_counters::install_counter_types(arithmetic_counter_types,
             sizeof(arithmetic_counter_types) /
                 sizeof(arithmetic_counter_types[0]));
+
+#if defined(HPX_HAVE_NUMA_ALLOCATOR)
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
+        performance_counters::generic_counter_type_data const
+            allocator_counter_types[] = {
+                {"/runtime/allocator/count/allocations",
+                    performance_counters::counter_monotonically_increasing,
+                    "returns the number of allocations served by the NUMA "
+                    "slab allocator on the referenced locality",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator,
+                        _1, &util::numa_slab::get_allocation_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/runtime/allocator/count/remote-allocations",
+                    performance_counters::counter_monotonically_increasing,
+                    "returns the number of allocations served by the NUMA "
+                    "slab allocator with memory residing on a NUMA domain "
+                    "different from the one of the allocating thread",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator,
+                        _1, &util::numa_slab::get_remote_allocation_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/runtime/allocator/count/remote-deallocations",
+                    performance_counters::counter_monotonically_increasing,
+                    "returns the number of blocks freed by a thread running "
+                    "on a NUMA domain different from the one owning the "
+                    "block",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator,
+                        _1, &util::numa_slab::get_remote_deallocation_count,
+                        _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/runtime/allocator/remote-allocation-ratio",
+                    performance_counters::counter_raw,
+                    "returns the ratio of remote allocations to all "
+                    "allocations served by the NUMA slab allocator",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator,
+                        _1, &util::numa_slab::get_remote_allocation_ratio, _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "0.01%"},
+            };
+        performance_counters::install_counter_types(allocator_counter_types,
+            sizeof(allocator_counter_types) /
+                sizeof(allocator_counter_types[0]));
+#endif
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,318 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/server/base_performance_counter.hpp>
+#include <hpx/performance_counters/shared_memory_segment.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/util/export_counters.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(HPX_WINDOWS)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace hpx { namespace util {
+    export_counters::export_counters(std::vector<std::string> const& names,
+        std::int64_t interval, std::string const& segment_name)
+      : names_(names)
+      , segment_name_(segment_name)
+      , segment_(nullptr)
+      , segment_size_(0)
+      , timer_(util::bind_front(&export_counters::evaluate, this_()),
+            util::bind_front(&export_counters::terminate, this_()),
+            interval * 1000, "export_counters", true)
+    {
+        // add counter prefix, if necessary
+        for (std::string& name : names_)
+        {
+            performance_counters::ensure_counter_prefix(name);
+        }
+    }
+
+    export_counters::~export_counters()
+    {
+        remove_segment();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool export_counters::find_counter(
+        performance_counters::counter_info const& info, error_code& ec)
+    {
+        // only counters living on this locality can be accessed directly
+        performance_counters::counter_path_elements p;
+        performance_counters::get_counter_path_elements(info.fullname_, p, ec);
+        if (ec)
+            return false;
+
+        if (p.parentinstancename_ != "locality" || p.parentinstanceindex_ < 0)
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "export_counters::find_counter",
+                hpx::util::format("performance counter '{1}' does not belong "
+                                  "to a particular locality, only counters "
+                                  "of a locality can be exported",
+                    info.fullname_));
+            return false;
+        }
+
+        std::uint32_t const locality_id = hpx::get_locality_id();
+        if (p.parentinstanceindex_ != std::int64_t(locality_id))
+        {
+            // the counter is exported by the locality it belongs to
+            LRT_(warning) << "export_counters::find_counter: performance "
+                             "counter '"
+                          << info.fullname_
+                          << "' is not exported by locality#" << locality_id;
+
+            if (&ec != &throws)
+                ec = make_success_code();
+            return true;
+        }
+
+        naming::id_type id =
+            performance_counters::get_counter(info.fullname_, ec);
+        if (HPX_UNLIKELY(!id))
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "export_counters::find_counter",
+                hpx::util::format("unknown performance counter: '{1}' ({2})",
+                    info.fullname_, ec.get_message()));
+            return false;
+        }
+
+        // resolve the counter instance once, all subsequent queries are
+        // plain function calls
+        std::shared_ptr<performance_counters::server::base_performance_counter>
+            counter = hpx::get_ptr<
+                performance_counters::server::base_performance_counter>(
+                launch::sync, id, ec);
+        if (ec)
+            return false;
+
+        infos_.push_back(info);
+        counters_.push_back(std::move(counter));
+        return true;
+    }
+
+    void export_counters::find_counters()
+    {
+        performance_counters::discover_counter_func func(
+            util::bind_front(&export_counters::find_counter, this));
+
+        for (std::string name : names_)
+        {
+            // do INI expansion on counter name
+            util::expand(name);
+
+            // find matching counter types
+            performance_counters::discover_counter_type(
+                name, func, performance_counters::discover_counters_full);
+        }
+
+        HPX_ASSERT(infos_.size() == counters_.size());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void export_counters::start()
+    {
+        std::uint32_t const locality_id = hpx::get_locality_id();
+        if (segment_name_.empty())
+        {
+#if !defined(HPX_WINDOWS)
+            segment_name_ = "/hpx_counters." + std::to_string(::getpid()) +
+                "." + std::to_string(locality_id);
+#endif
+        }
+        else if (locality_id != 0)
+        {
+            segment_name_ += "." + std::to_string(locality_id);
+        }
+
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            find_counters();
+            for (auto& counter : counters_)
+            {
+                counter->start_nonvirt();
+            }
+
+            create_segment();
+        }
+
+        // this will invoke the evaluate function for the first time
+        timer_.start();
+    }
+
+    void export_counters::stop()
+    {
+        timer_.stop();
+
+        std::lock_guard<mutex_type> l(mtx_);
+        remove_segment();
+
+        // release the counter instances while the runtime is still up
+        counters_.clear();
+    }
+
+    bool export_counters::evaluate()
+    {
+        using namespace performance_counters::shared_memory;
+
+        std::lock_guard<mutex_type> l(mtx_);
+        if (segment_ == nullptr)
+            return false;
+
+        // query all values before opening the update window to keep the time
+        // readers have to retry as short as possible
+        std::vector<performance_counters::counter_value> values;
+        values.reserve(counters_.size());
+        for (auto& counter : counters_)
+        {
+            try
+            {
+                values.push_back(counter->get_counter_value_nonvirt(false));
+            }
+            catch (hpx::exception const&)
+            {
+                performance_counters::counter_value value;
+                value.status_ = performance_counters::status_invalid_data;
+                values.push_back(value);
+            }
+        }
+
+        std::int64_t const timestamp =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch())
+                .count();
+
+        begin_update(segment_);
+
+        segment_entry* entries = segment_entries(segment_);
+        for (std::size_t i = 0; i != values.size(); ++i)
+        {
+            performance_counters::counter_value const& v = values[i];
+            segment_entry& e = entries[i];
+
+            e.value.store(v.value_, std::memory_order_relaxed);
+            e.scaling.store(v.scaling_, std::memory_order_relaxed);
+            e.scale_inverse.store(
+                v.scale_inverse_ ? 1 : 0, std::memory_order_relaxed);
+            e.time.store(
+                static_cast<std::int64_t>(v.time_), std::memory_order_relaxed);
+            e.count.store(v.count_, std::memory_order_relaxed);
+            e.status.store(v.status_, std::memory_order_relaxed);
+        }
+
+        end_update(segment_, timestamp);
+
+        return true;
+    }
+
+    void export_counters::terminate()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        remove_segment();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void export_counters::create_segment()
+    {
+#if defined(HPX_WINDOWS)
+        HPX_THROW_EXCEPTION(not_implemented, "export_counters::create_segment",
+            "exporting performance counters to shared memory is not "
+            "supported on this platform");
+#else
+        using namespace performance_counters::shared_memory;
+
+        std::size_t const size = segment_size(infos_.size());
+
+        int fd = ::shm_open(
+            segment_name_.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+        if (fd == -1)
+        {
+            HPX_THROW_EXCEPTION(kernel_error, "export_counters::create_segment",
+                hpx::util::format("could not create shared memory segment "
+                                  "'{1}': {2}",
+                    segment_name_, std::strerror(errno)));
+            return;
+        }
+
+        void* p = MAP_FAILED;
+        if (::ftruncate(fd, static_cast<off_t>(size)) != -1)
+        {
+            p = ::mmap(
+                nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        int const err = errno;
+        ::close(fd);
+
+        if (p == MAP_FAILED)
+        {
+            ::shm_unlink(segment_name_.c_str());
+            HPX_THROW_EXCEPTION(kernel_error, "export_counters::create_segment",
+                hpx::util::format("could not map shared memory segment "
+                                  "'{1}': {2}",
+                    segment_name_, std::strerror(err)));
+            return;
+        }
+
+        segment_ = static_cast<segment_header*>(p);
+        segment_size_ = size;
+
+        // the segment is zero-initialized, the names are written only once
+        segment_entry* entries = segment_entries(segment_);
+        for (std::size_t i = 0; i != infos_.size(); ++i)
+        {
+            std::strncpy(entries[i].name, infos_[i].fullname_.c_str(),
+                max_name_length);
+            std::strncpy(entries[i].unit,
+                infos_[i].unit_of_measure_.c_str(), max_unit_length);
+        }
+
+        segment_->version.store(segment_version, std::memory_order_relaxed);
+        segment_->num_counters.store(
+            infos_.size(), std::memory_order_relaxed);
+
+        // publish the segment to readers
+        segment_->magic.store(segment_magic, std::memory_order_release);
+#endif
+    }
+
+    void export_counters::remove_segment()
+    {
+#if !defined(HPX_WINDOWS)
+        if (segment_ != nullptr)
+        {
+            ::munmap(segment_, segment_size_);
+            ::shm_unlink(segment_name_.c_str());
+
+            segment_ = nullptr;
+            segment_size_ = 0;
+        }
+#endif
+    }
+}}    // namespace hpx::util
@@ -16,17 +16,22 @@
 #include <hpx/cache/local_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/runtime/agas/addressing_service.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/statistics/histogram.hpp>
 #include <hpx/modules/testing.hpp>
 
 #include <hpx/modules/program_options.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 #include <boost/accumulators/accumulators.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -228,6 +233,105 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Measure the lookup throughput from the given number of concurrently running
+// HPX threads, 'lookup' is invoked for each of the looked up GIDs
+template <typename F>
+double test_concurrent_get(F const& lookup, hpx::naming::gid_type first_key,
+    std::size_t num_entries, std::size_t num_threads,
+    std::size_t num_lookups)
+{
+    std::vector<hpx::future<void>> threads;
+    threads.reserve(num_threads);
+
+    hpx::util::high_resolution_timer t;
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.push_back(hpx::async([&, i]() {
+            // every thread cycles through all keys starting at its own offset
+            std::size_t const offset = i * (num_entries / num_threads);
+
+            for (std::size_t j = 0; j != num_lookups; ++j)
+            {
+                hpx::naming::gid_type key = first_key;
+                key += std::uint64_t((offset + j) % num_entries + 1);
+
+                lookup(key);
+            }
+        }));
+    }
+    hpx::wait_all(threads);
+
+    return double(num_threads * num_lookups) / t.elapsed();
+}
+
+// Compare the (copy of the) original cache protected by a single lock with
+// the cache used by the AGAS client of this locality. The number of shards
+// of the latter is controlled by hpx.agas.local_cache_shards.
+void test_scaling(gva_cache_type& cache, hpx::naming::gid_type first_key,
+    std::size_t num_entries, std::size_t num_lookups)
+{
+    hpx::agas::addressing_service& agas_client =
+        hpx::naming::get_agas_client();
+
+    // populate the AGAS cache with the same keys as the local copy
+    hpx::naming::gid_type key = first_key;
+    hpx::naming::gid_type locality = hpx::get_locality();
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::agas::gva value(locality, hpx::components::component_invalid, 1,
+            std::uint64_t(0), 0);
+        agas_client.update_cache_entry(++key, value);
+    }
+
+    hpx::lcos::local::spinlock mtx;
+    auto locked_lookup = [&](hpx::naming::gid_type const& gid) {
+        gva_cache_key k(gid, 1);
+        gva_cache_key idbase;
+        gva_cache_type::entry_type e;
+
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx);
+        cache.get_entry(k, idbase, e);
+    };
+
+    auto agas_lookup = [&](hpx::naming::gid_type const& gid) {
+        hpx::agas::gva g;
+        hpx::naming::gid_type idbase;
+        agas_client.get_cache_entry(gid, g, idbase);
+    };
+
+    std::string const shards =
+        hpx::get_config_entry("hpx.agas.local_cache_shards", "0");
+
+    std::size_t const max_threads = hpx::get_os_thread_count();
+    for (std::size_t num_threads = 1; num_threads <= max_threads;
+         num_threads *= 2)
+    {
+        double single = test_concurrent_get(
+            locked_lookup, first_key, num_entries, num_threads, num_lookups);
+        double sharded = test_concurrent_get(
+            agas_lookup, first_key, num_entries, num_threads, num_lookups);
+
+        std::cout << "threads: " << std::setw(4) << num_threads
+                  << ", lookups/s (single lock): " << std::setw(12)
+                  << std::fixed << std::setprecision(0) << single
+                  << ", lookups/s (AGAS cache, local_cache_shards="
+                  << shards << "): " << std::setw(12) << sharded
+                  << std::endl;
+
+        if (num_threads != max_threads && 2 * num_threads > max_threads)
+            num_threads = max_threads / 2;
+    }
+
+    // remove the artificial entries again
+    key = first_key;
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        agas_client.remove_cache_entry(++key);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -242,6 +346,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     gva_cache_type cache;
     cache.reserve(cache_size);
 
+    std::size_t num_lookups = vm["lookups"].as<std::size_t>();
+
     hpx::naming::gid_type first_key = hpx::detail::get_next_id();
 
     hpx::util::high_resolution_timer t1;
@@ -249,6 +355,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_insert(cache, num_entries);
     test_get(cache, first_key);
     test_update(cache, first_key);
+    test_scaling(cache, first_key, num_entries, num_lookups);
 
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
@@ -268,6 +375,9 @@ int main(int argc, char* argv[])
          HPX_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")
         ("num_entries,n", value<std::size_t>(),
          "number of items to insert into cache (default: 1000)")
+        ("lookups", value<std::size_t>()->default_value(100000),
+         "number of lookups performed by each thread when measuring the "
+         "lookup throughput (default: 100000)")
         ;
 
     // Initialize and run HPX
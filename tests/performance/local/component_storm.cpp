@@ -0,0 +1,152 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of AGAS while many threads
+// concurrently create and destroy components. Creating a component allocates
+// and (for migratable components) binds a global id, releasing the last
+// reference to it decrements its credits, unbinds the id, and destroys the
+// component. Afterwards the number of contended lock acquisitions of the
+// primary namespace tables is reported.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct plain_server : hpx::components::component_base<plain_server>
+{
+};
+
+typedef hpx::components::component<plain_server> plain_server_type;
+HPX_REGISTER_COMPONENT(plain_server_type, plain_server);
+
+struct migratable_server
+  : hpx::components::migration_support<
+        hpx::components::component_base<migratable_server>>
+{
+};
+
+typedef hpx::components::component<migratable_server> migratable_server_type;
+HPX_REGISTER_COMPONENT(migratable_server_type, migratable_server);
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const contention_counter_name =
+    "/agas{locality#0/total}/primary/contention";
+
+template <typename Component>
+void create_and_destroy(std::size_t iterations, std::size_t batch_size)
+{
+    hpx::id_type const here = hpx::find_here();
+
+    std::vector<hpx::future<hpx::id_type>> components;
+    components.reserve(batch_size);
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        for (std::size_t j = 0; j != batch_size; ++j)
+        {
+            components.push_back(hpx::new_<Component>(here));
+        }
+        hpx::wait_all(components);
+
+        // releasing the last reference destroys the components
+        components.clear();
+    }
+}
+
+template <typename Component>
+void run_benchmark(char const* name, std::size_t tasks,
+    std::size_t iterations, std::size_t batch_size, int test_count)
+{
+    hpx::performance_counters::performance_counter contention(
+        contention_counter_name);
+
+    // reset the counter
+    contention.get_value<std::int64_t>(hpx::launch::sync, true);
+
+    std::uint64_t t = hpx::util::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::vector<hpx::future<void>> storm;
+        storm.reserve(tasks);
+
+        for (std::size_t j = 0; j != tasks; ++j)
+        {
+            storm.push_back(hpx::async(&create_and_destroy<Component>,
+                iterations, batch_size));
+        }
+        hpx::wait_all(storm);
+    }
+
+    t = hpx::util::high_resolution_clock::now() - t;
+
+    std::int64_t const contended =
+        contention.get_value<std::int64_t>(hpx::launch::sync, true);
+
+    double const components =
+        double(tasks * iterations * batch_size) * test_count;
+
+    hpx::util::format_to(std::cout,
+        "component storm ({1}): {2} components/s, {3} contended lock "
+        "acquisitions\n",
+        name, components / (t / 1e9), contended);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t tasks = vm["tasks"].as<std::size_t>();
+    std::size_t iterations = vm["iterations"].as<std::size_t>();
+    std::size_t batch_size = vm["batch-size"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    if (tasks == 0)
+        tasks = hpx::get_os_thread_count();
+
+    run_benchmark<plain_server>(
+        "plain", tasks, iterations, batch_size, test_count);
+    run_benchmark<migratable_server>(
+        "migratable", tasks, iterations, batch_size, test_count);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks", value<std::size_t>()->default_value(0),
+         "number of concurrent tasks creating components "
+         "(default: number of cores)")
+        ("iterations", value<std::size_t>()->default_value(100),
+         "number of batches created and destroyed by each task "
+         "(default: 100)")
+        ("batch-size", value<std::size_t>()->default_value(100),
+         "number of components alive at the same time per task "
+         "(default: 100)")
+        ("test_count", value<int>()->default_value(10),
+         "number of tests to be averaged (default: 10)");
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    return hpx::init(desc_commandline, argc, argv, cfg);
+}
@@ -8,10 +8,14 @@
 
 #include <hpx/hpx_init.hpp>
 #include <hpx/hpx.hpp>
+#if !defined(HPX_WINDOWS)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
 #include <hpx/modules/format.hpp>
 #include <hpx/string_util/split.hpp>
 #include <hpx/string_util/classification.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <ctime>
@@ -37,6 +41,10 @@ std::uint64_t iterations = 100000;
 std::uint64_t seed       = 0;
 bool header = true;
 
+// overall time spent creating and destroying contexts (and their stacks)
+std::atomic<std::uint64_t> creation_time(0);
+std::atomic<std::uint64_t> destruction_time(0);
+
 ///////////////////////////////////////////////////////////////////////////////
 std::string format_build_date()
 {
@@ -164,12 +172,16 @@ double perform_2n_iterations()
 
     kernel k;
 
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
     for (std::uint64_t i = 0; i < contexts; ++i)
     {
         coroutine_type* c = new coroutine_type(k, hpx::threads::invalid_thread_id);
         coroutines.push_back(c);
     }
 
+    creation_time += hpx::util::high_resolution_clock::now() - start;
+
     for (std::uint64_t i = 0; i < iterations; ++i)
         indices.push_back(dist(prng));
 
@@ -189,11 +201,15 @@ double perform_2n_iterations()
 
     double elapsed = t.elapsed();
 
+    start = hpx::util::high_resolution_clock::now();
+
     for (std::uint64_t i = 0; i < contexts; ++i)
     {
         delete coroutines[i];
     }
 
+    destruction_time += hpx::util::high_resolution_clock::now() - start;
+
     coroutines.clear();
 
     return elapsed;
@@ -230,6 +246,21 @@ int hpx_main(
 
         print_results(total_elapsed);
 
+        // creating and destroying the contexts allocates and releases their
+        // stacks, which is affected by the stack pool (hpx.stacks.use_pool)
+        hpx::util::format_to(cout,
+            "# context creation [s]: {:.14g}, context destruction [s]: {:.14g}\n",
+            creation_time * 1e-9, destruction_time * 1e-9);
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+        hpx::util::format_to(cout,
+            "# stack pool memory reserved [bytes]: {}, resident [bytes]: {}\n",
+            hpx::threads::coroutines::detail::posix::
+                get_stack_pool_reserved_memory(),
+            hpx::threads::coroutines::detail::posix::
+                get_stack_pool_resident_memory());
+#endif
+
         ///////////////////////////////////////////////////////////////////////
 /*
         std::vector<std::string> counter_shortnames;
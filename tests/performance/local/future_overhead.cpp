@@ -14,6 +14,7 @@
 #include <hpx/async_combinators/wait_each.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/executors/limiting_executor.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/hpx_init.hpp>
 #include <hpx/include/apply.hpp>
 #include <hpx/include/async.hpp>
@@ -360,6 +361,45 @@ void measure_function_futures_for_loop(std::uint64_t count, bool csv,
         executor_name ? executor_name : exec_name(exec), count, duration, csv);
 }
 
+// Time a chain of continuations attached to a future which becomes ready only
+// after the chain has been built
+void measure_function_futures_then_chain(std::uint64_t count, bool csv)
+{
+    hpx::lcos::local::promise<double> p;
+    future<double> f = p.get_future();
+
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        f = f.then(hpx::launch::sync,
+            [](future<double>&& r) { return r.get() + null_function(); });
+    }
+    p.set_value(0.0);
+    global_scratch += f.get();
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("then", "chain", "sync", count, duration, csv);
+}
+
+// Time continuations attached to futures which are ready already
+void measure_function_futures_then_ready(std::uint64_t count, bool csv)
+{
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        future<double> f = hpx::make_ready_future(0.0).then(hpx::launch::sync,
+            [](future<double>&& r) { return r.get() + null_function(); });
+        global_scratch += f.get();
+    }
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("then", "ready", "sync", count, duration, csv);
+}
+
 void measure_function_futures_register_work(std::uint64_t count, bool csv)
 {
     hpx::lcos::local::latch l(count);
@@ -582,6 +622,8 @@ int hpx_main(variables_map& vm)
                 measure_function_futures_for_loop(count, csv, tpe);
                 measure_function_futures_for_loop(
                     count, csv, tpe_nostack, "thread_pool_executor_nostack");
+                measure_function_futures_then_chain(count, csv);
+                measure_function_futures_then_ready(count, csv);
                 measure_function_futures_register_work(count, csv);
                 measure_function_futures_create_thread(count, csv);
                 measure_function_futures_apply_hierarchical_placement(
@@ -14,11 +14,12 @@
 // to 999999), which are summed on the previous level and sent back upstream,
 // until reaching the root actor. (The answer should be 499999500000).
 
-// This code implements two versions of the skynet micro benchmark: a 'normal'
-// and a futurized one.
+// This code implements three versions of the skynet micro benchmark: a
+// 'normal' one, a futurized one, and one using a task block in fork-join mode.
 
 #include <hpx/hpx_main.hpp>
 #include <hpx/hpx.hpp>
+#include <hpx/include/parallel_task_block.hpp>
 #include <hpx/iostream.hpp>
 
 #include <cstdint>
@@ -80,6 +81,36 @@ skynet_f(std::int64_t num, std::int64_t size, std::int64_t div)
     return hpx::make_ready_future(num);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t skynet_tb(std::int64_t num, std::int64_t size, std::int64_t div)
+{
+    if (size != 1)
+    {
+        size /= div;
+
+        std::vector<std::int64_t> results(div);
+
+        hpx::parallel::define_task_block(hpx::parallel::fork_join,
+            [&](hpx::parallel::task_block<>& tb)
+            {
+                for (std::int64_t i = 0; i != div; ++i)
+                {
+                    std::int64_t sub_num = num + i * size;
+                    tb.run([&results, i, sub_num, size, div]()
+                    {
+                        results[i] = skynet_tb(sub_num, size, div);
+                    });
+                }
+            });
+
+        std::int64_t sum = 0;
+        for (std::int64_t r : results)
+            sum += r;
+        return sum;
+    }
+    return num;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main()
 {
@@ -108,6 +139,20 @@ int main()
             << "Result 2: " << result.get() << " in "
             << (t / 1e6) << " ms.\n";
     }
+
+    {
+        std::uint64_t t = hpx::util::high_resolution_clock::now();
+
+        hpx::future<std::int64_t> result =
+            hpx::async(skynet_tb, 0, 1000000, 10);
+        result.wait();
+
+        t = hpx::util::high_resolution_clock::now() - t;
+
+        hpx::cout
+            << "Result 3: " << result.get() << " in "
+            << (t / 1e6) << " ms.\n";
+    }
     return 0;
 }
 
@@ -9,6 +9,9 @@
 
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_start.hpp>
+#if !defined(HPX_WINDOWS)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/modules/timing.hpp>
@@ -81,5 +84,19 @@ int main(int argc, char ** argv)
     }
     hpx::util::print_cdash_timing("StartTime", start_time);
     hpx::util::print_cdash_timing("StopTime",  stop_time);
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+    // thread stacks are kept by the stack pool (hpx.stacks.use_pool) across
+    // runtime restarts
+    std::cout
+        << "stack pool memory reserved [bytes]: "
+        << hpx::threads::coroutines::detail::posix::
+               get_stack_pool_reserved_memory()
+        << ", resident [bytes]: "
+        << hpx::threads::coroutines::detail::posix::
+               get_stack_pool_resident_memory()
+        << std::endl;
+#endif
 }
 
@@ -0,0 +1,128 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares different ways of expressing recursive fork-join
+// parallelism by calculating Fibonacci numbers: using futures, using a task
+// block, and using a task block in fork-join mode. Below the given threshold
+// the calculation is performed serially.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_task_block.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t threshold = 2;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fibonacci_serial(std::uint64_t n)
+{
+    if (n < 2)
+        return n;
+    return fibonacci_serial(n - 1) + fibonacci_serial(n - 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fibonacci_future(std::uint64_t n)
+{
+    if (n < threshold)
+        return fibonacci_serial(n);
+
+    hpx::future<std::uint64_t> n1 = hpx::async(&fibonacci_future, n - 1);
+    std::uint64_t n2 = fibonacci_future(n - 2);
+    return n1.get() + n2;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fibonacci_task_block(std::uint64_t n)
+{
+    if (n < threshold)
+        return fibonacci_serial(n);
+
+    std::uint64_t n1 = 0, n2 = 0;
+    hpx::parallel::define_task_block(
+        [&](hpx::parallel::task_block<>& tb) {
+            tb.run([&]() { n1 = fibonacci_task_block(n - 1); });
+            n2 = fibonacci_task_block(n - 2);
+        });
+    return n1 + n2;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fibonacci_fork_join(std::uint64_t n)
+{
+    if (n < threshold)
+        return fibonacci_serial(n);
+
+    std::uint64_t n1 = 0, n2 = 0;
+    hpx::parallel::define_task_block(hpx::parallel::fork_join,
+        [&](hpx::parallel::task_block<>& tb) {
+            tb.run([&]() { n1 = fibonacci_fork_join(n - 1); });
+            n2 = fibonacci_fork_join(n - 2);
+        });
+    return n1 + n2;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+void run_benchmark(char const* name, F f, std::uint64_t n, int test_count)
+{
+    std::uint64_t result = 0;
+    std::uint64_t t = hpx::util::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        result = f(n);
+    }
+
+    t = hpx::util::high_resolution_clock::now() - t;
+
+    hpx::util::format_to(std::cout, "fibonacci({1}) ({2}): {3} in {4} ms\n",
+        n, name, result, (t / 1e6) / test_count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t n = vm["n-value"].as<std::uint64_t>();
+    int test_count = vm["test_count"].as<int>();
+    threshold = vm["threshold"].as<std::uint64_t>();
+
+    run_benchmark("serial", &fibonacci_serial, n, test_count);
+    run_benchmark("futures", &fibonacci_future, n, test_count);
+    run_benchmark("task_block", &fibonacci_task_block, n, test_count);
+    run_benchmark("fork_join", &fibonacci_fork_join, n, test_count);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("n-value", value<std::uint64_t>()->default_value(30),
+         "n value for the Fibonacci function (default: 30)")
+        ("threshold", value<std::uint64_t>()->default_value(2),
+         "threshold for switching to serial code (default: 2)")
+        ("test_count", value<int>()->default_value(10),
+         "number of tests to be averaged (default: 10)");
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    return hpx::init(desc_commandline, argc, argv, cfg);
+}
@@ -0,0 +1,122 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the rate at which short-lived HPX threads can be
+// spawned and retired. Each of the spawning threads creates the given number
+// of empty tasks, all of which have to reuse (or allocate) a thread object of
+// the requested stack size. Running it with a small number of tasks shows the
+// cost of allocating new thread objects, running it with a large number of
+// tasks shows the steady state cost of recycling them.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/latch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void spawn_tasks(hpx::parallel::execution::parallel_executor exec,
+    std::size_t num_tasks, hpx::lcos::local::latch& l)
+{
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::apply(exec, [&l]() { l.count_down(1); });
+    }
+}
+
+double measure_spawn_rate(hpx::threads::thread_stacksize stacksize,
+    std::size_t num_spawners, std::size_t num_tasks)
+{
+    hpx::parallel::execution::parallel_executor exec(
+        hpx::threads::thread_priority_default, stacksize);
+
+    hpx::lcos::local::latch l(
+        static_cast<std::ptrdiff_t>(num_spawners * num_tasks + 1));
+
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    std::vector<hpx::future<void>> spawners;
+    spawners.reserve(num_spawners);
+    for (std::size_t i = 0; i != num_spawners; ++i)
+    {
+        spawners.push_back(
+            hpx::async(&spawn_tasks, exec, num_tasks, std::ref(l)));
+    }
+
+    l.count_down_and_wait();
+
+    std::uint64_t end = hpx::util::high_resolution_clock::now();
+
+    hpx::wait_all(spawners);
+
+    return static_cast<double>(num_spawners * num_tasks) /
+        (static_cast<double>(end - start) / 1e9);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t num_tasks = vm["tasks"].as<std::size_t>();
+    std::size_t num_spawners = vm["spawners"].as<std::size_t>();
+    std::size_t num_iterations = vm["iterations"].as<std::size_t>();
+    if (num_spawners == 0)
+        num_spawners = hpx::get_os_thread_count();
+
+    hpx::threads::thread_stacksize sizes[] = {
+        hpx::threads::thread_stacksize_small,
+        hpx::threads::thread_stacksize_medium,
+        hpx::threads::thread_stacksize_large,
+        hpx::threads::thread_stacksize_nostack};
+
+    for (hpx::threads::thread_stacksize stacksize : sizes)
+    {
+        // the first run warms up the thread object heaps of all queues
+        measure_spawn_rate(stacksize, num_spawners, num_tasks);
+
+        double rate = 0;
+        for (std::size_t i = 0; i != num_iterations; ++i)
+        {
+            rate += measure_spawn_rate(stacksize, num_spawners, num_tasks);
+        }
+        rate /= static_cast<double>(num_iterations);
+
+        std::string name = hpx::threads::get_stack_size_enum_name(stacksize);
+        std::cout << "stacksize: " << name << ", spawners: " << num_spawners
+                  << ", tasks/s: " << rate << std::endl;
+        hpx::util::print_cdash_timing(
+            ("ThreadSpawnRate_" + name).c_str(), 1.0 / rate);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks", value<std::size_t>()->default_value(100000),
+         "number of tasks to spawn per spawning thread (default: 100000)")
+        ("spawners", value<std::size_t>()->default_value(0),
+         "number of threads spawning tasks concurrently (default: number "
+         "of OS threads)")
+        ("iterations", value<std::size_t>()->default_value(5),
+         "number of times to repeat the measurement (default: 5)")
+        ;
+    // clang-format on
+
+    return hpx::init(desc_commandline, argc, argv);
+}
@@ -8,9 +8,12 @@
 #include <hpx/hpx.hpp>
 #include <hpx/iostream.hpp>
 #include <hpx/include/async.hpp>
+#include <hpx/include/performance_counters.hpp>
 #include <hpx/include/serialization.hpp>
+#include <hpx/modules/timing.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <complex>
 #include <string>
 #include <vector>
@@ -29,6 +32,25 @@ namespace pingpong
 HPX_PLAIN_ACTION(pingpong::server::get_element, pingpong_get_element_action);
 //HPX_ACTION_USES_MESSAGE_COALESCING(pingpong_get_element_action);
 
+// print the statistics of the message buffer pool of the TCP parcelport
+void print_buffer_pool_statistics()
+{
+    if (hpx::get_config_entry("hpx.parcel.tcp.enable", "0") != "1")
+        return;
+
+    char const* const names[] = {"buffer-pool-hits", "buffer-pool-misses",
+        "buffer-pool-retained"};
+
+    for (char const* name : names)
+    {
+        hpx::performance_counters::performance_counter counter(
+            std::string("/parcelport{locality#0/total}/count/tcp/") + name);
+        hpx::cout << name << ": "
+                  << counter.get_value<std::int64_t>(hpx::launch::sync) << "\n";
+    }
+    hpx::cout << hpx::flush;
+}
+
 
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -51,6 +73,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     hpx::naming::id_type other_locality = dummy[0];
 
 
+    hpx::util::high_resolution_timer t;
+
     for(std::size_t i=0; i<n; ++i)
     {
         vec.push_back(hpx::async(act,other_locality));
@@ -69,6 +93,12 @@ int hpx_main(hpx::program_options::variables_map& vm)
                       <<received[n-1]<< "\n" << hpx::flush;
         }
     ).get();
+
+    double elapsed = t.elapsed();
+    hpx::cout << "Message rate: " << double(n) / elapsed << " parcels/s\n"
+              << hpx::flush;
+    print_buffer_pool_statistics();
+
     return hpx::finalize();
 }
 
@@ -0,0 +1,170 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Exercise the partitioned tables of a (separate) primary namespace instance:
+// bindings crossing partition blocks and credit decrements failing for some
+// of the requests of a batch.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime/agas/server/primary_namespace.hpp>
+#include <hpx/runtime/components/server/create_component.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::server::primary_namespace;
+using hpx::naming::gid_type;
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<int> destroyed(0);
+
+struct test_server
+  : hpx::components::simple_component_base<test_server>
+{
+    ~test_server()
+    {
+        ++destroyed;
+    }
+};
+
+typedef hpx::components::simple_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+///////////////////////////////////////////////////////////////////////////////
+// return the first id of the given range starting a partition block
+gid_type get_block_start(std::pair<gid_type, gid_type> const& range)
+{
+    std::uint64_t const block_size = std::uint64_t(1)
+        << primary_namespace::partition_block_bits;
+
+    std::uint64_t const lsb = range.first.get_lsb();
+    gid_type const start(range.first.get_msb(),
+        (lsb + block_size - 1) & ~(block_size - 1));
+
+    HPX_TEST(start + 4 * block_size <= range.second);
+    return start;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// bindings crossing a partition block are found from any of their ids
+void test_spanning_bindings(primary_namespace& ns)
+{
+    gid_type const locality = hpx::get_locality();
+    std::uint64_t const block_size = std::uint64_t(1)
+        << primary_namespace::partition_block_bits;
+
+    gid_type const start = get_block_start(ns.allocate(8 * block_size));
+    gid_type const id = start + block_size / 2;
+    std::uint64_t const count = 2 * block_size;
+
+    gva const g(locality, hpx::components::component_base_lco_with_value,
+        count, std::uint64_t(0x10000), 8);
+    HPX_TEST(ns.bind_gid(g, id, locality));
+
+    // the binding covers ids of three partition blocks
+    for (std::uint64_t i : {std::uint64_t(0), block_size / 2 + 1,
+             count / 2 + 1, count - 1})
+    {
+        primary_namespace::resolved_type r = ns.resolve_gid(id + i);
+        HPX_TEST_EQ(hpx::util::get<0>(r), id);
+        HPX_TEST_EQ(hpx::util::get<2>(r), locality);
+        HPX_TEST_EQ(
+            hpx::util::get<1>(r).resolve(id + i, id).lva(), 0x10000 + i * 8);
+    }
+
+    // the ids next to the binding are not bound
+    HPX_TEST_EQ(hpx::util::get<0>(ns.resolve_gid(id - 1)),
+        hpx::naming::invalid_gid);
+    HPX_TEST_EQ(hpx::util::get<0>(ns.resolve_gid(id + count)),
+        hpx::naming::invalid_gid);
+
+    // bindings are unbound from the table they were added to
+    hpx::naming::address const addr = ns.unbind_gid(count, id);
+    HPX_TEST_EQ(addr.address_, std::uint64_t(0x10000));
+    HPX_TEST_EQ(hpx::util::get<0>(ns.resolve_gid(id + block_size)),
+        hpx::naming::invalid_gid);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// bind a new component to the given id, the component is destroyed if its
+// last credit is released through the given primary namespace
+void bind_component(primary_namespace& ns, gid_type const& id)
+{
+    gid_type const gid = hpx::components::server::create<server_type>();
+
+    hpx::naming::address addr;
+    HPX_TEST(hpx::naming::get_agas_client().resolve_local(gid, addr));
+
+    gva const g(addr.locality_, addr.type_, 1, addr.address_);
+    HPX_TEST(ns.bind_gid(g, id, addr.locality_));
+}
+
+// a failing decrement must not leak the components freed by the other
+// requests of the same batch
+void test_decrement_credit_error(primary_namespace& ns)
+{
+    std::uint64_t const block_size = std::uint64_t(1)
+        << primary_namespace::partition_block_bits;
+
+    gid_type const start = get_block_start(ns.allocate(8 * block_size));
+
+    // the first two ids belong to the same partition, the last one to the
+    // next partition
+    gid_type const ids[] = {start, start + 1, start + block_size};
+    bind_component(ns, ids[0]);
+    bind_component(ns, ids[2]);
+
+    std::int64_t const credits = HPX_GLOBALCREDIT_INITIAL;
+
+    std::vector<hpx::util::tuple<std::int64_t, gid_type, gid_type>> requests;
+    requests.emplace_back(-credits, ids[0], ids[0]);
+
+    // this would make the reference count of an unused id negative
+    requests.emplace_back(-(credits + 1), ids[1], ids[1]);
+    requests.emplace_back(-credits, ids[2], ids[2]);
+
+    bool caught_exception = false;
+    try
+    {
+        ns.decrement_credit(requests);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.get_error(), hpx::invalid_data);
+    }
+    HPX_TEST(caught_exception);
+
+    // both components have been freed nevertheless
+    HPX_TEST_EQ(destroyed.load(), 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    {
+        primary_namespace ns;
+        ns.set_local_locality(hpx::get_locality());
+
+        test_spanning_bindings(ns);
+        test_decrement_credit_error(ns);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,108 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that messages whose actions don't request compression are
+// compressed if adaptive compression is enabled (hpx.parcel.compression).
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const vsize_default = 8192;
+std::size_t const numparcels_default = 100;
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t test_data(std::vector<double> const& data)
+{
+    return data.size();
+}
+
+HPX_PLAIN_ACTION(test_data, test_data_action);
+
+///////////////////////////////////////////////////////////////////////////////
+void send_compressible_data(hpx::id_type const& id)
+{
+    // constant data compresses well
+    std::vector<double> data(vsize_default, 42.0);
+
+    std::vector<hpx::future<std::size_t>> results;
+    results.reserve(numparcels_default);
+
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        results.push_back(hpx::async<test_data_action>(id, data));
+    }
+
+    for (hpx::future<std::size_t>& f : results)
+    {
+        HPX_TEST_EQ(f.get(), vsize_default);
+    }
+}
+
+std::int64_t query_counters(std::string const& name)
+{
+    using namespace hpx::performance_counters;
+
+    std::int64_t result = 0;
+    for (performance_counter const& c : discover_counters(name))
+    {
+        std::int64_t value =
+            c.get_counter_value(hpx::launch::sync).get_value<std::int64_t>();
+
+        std::cout << "counter: " << c.get_name(hpx::launch::sync)
+                  << ", value: " << value << std::endl;
+
+        result += value;
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        send_compressible_data(id);
+    }
+
+    // the first eligible message to each destination is always compressed
+    // to measure the compression ratio
+    HPX_TEST_LT(std::int64_t(0),
+        query_counters("/compression/count/*/messages"));
+    HPX_TEST_LT(std::int64_t(0),
+        query_counters("/compression/count/*/saved"));
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+#if defined(HPX_HAVE_COMPRESSION_BZIP2)
+        "hpx.parcel.compression=bzip2_serialization_filter",
+#elif defined(HPX_HAVE_COMPRESSION_ZLIB)
+        "hpx.parcel.compression=zlib_serialization_filter",
+#elif defined(HPX_HAVE_COMPRESSION_SNAPPY)
+        "hpx.parcel.compression=snappy_serialization_filter",
+#endif
+        "hpx.parcel.compression_min_size=1024"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -11,6 +11,7 @@
 #include <hpx/include/parcel_coalescing.hpp>
 #include <hpx/include/performance_counters.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
 
 #include <cstddef>
 #include <iostream>
@@ -258,6 +259,23 @@ int hpx_main(hpx::program_options::variables_map& vm)
     print_counters("/coalescing{locality#0/total}/count/messages@test1_action");
     print_counters("/coalescing{locality#0/total}/count/messages@test2_action");
 
+    // repeat the tests using the adaptive coalescing policy
+    hpx::set_config_entry(
+        "hpx.plugins.coalescing_message_handler.adaptive", "1");
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_plain_argument(id);
+        test_future_argument(id);
+        test_mixed_arguments(id);
+    }
+
+    // make sure the adaptive parameters are reported
+    print_counters(
+        "/coalescing{locality#0/total}/count/batch-size@test1_action");
+    print_counters(
+        "/coalescing{locality#0/total}/time/flush-interval@test1_action");
+
     return hpx::finalize();
 }
 